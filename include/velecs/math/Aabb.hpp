@@ -0,0 +1,132 @@
+/// @file    Aabb.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 00:12:36
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Vec3.hpp"
+
+#include <string>
+
+namespace velecs::math {
+
+/// @struct Aabb
+/// @brief An axis-aligned bounding box given by its minimum and maximum corners.
+///
+/// A box whose min exceeds its max on any axis is empty. EMPTY is the identity of Merge and
+/// Expand, so bounds can be accumulated starting from it.
+struct Aabb {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const Aabb EMPTY; /// @brief An empty box (min = +infinity, max = -infinity).
+
+    Vec3 min; /// @brief The minimum corner.
+    Vec3 max; /// @brief The maximum corner.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a box from its corners.
+    /// @param[in] min The minimum corner.
+    /// @param[in] max The maximum corner.
+    inline Aabb(const Vec3 min, const Vec3 max)
+        : min(min), max(max) {}
+
+    /// @brief Default destructor.
+    ~Aabb() = default;
+
+    // Public Methods
+
+    /// @brief Constructs the box spanning center +/- extents.
+    inline static Aabb FromCenterExtents(const Vec3 center, const Vec3 extents)
+    {
+        return Aabb(center - extents, center + extents);
+    }
+
+    /// @brief Whether the box contains no points.
+    inline bool IsEmpty() const
+    {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+    }
+
+    /// @brief The center of the box.
+    inline Vec3 Center() const
+    {
+        return (min + max) * 0.5f;
+    }
+
+    /// @brief The half-size of the box along each axis.
+    inline Vec3 Extents() const
+    {
+        return (max - min) * 0.5f;
+    }
+
+    /// @brief The full size of the box along each axis.
+    inline Vec3 Size() const
+    {
+        return max - min;
+    }
+
+    /// @brief Whether a point lies inside or on the boundary of the box.
+    inline bool Contains(const Vec3 point) const
+    {
+        return point.x >= min.x && point.x <= max.x
+            && point.y >= min.y && point.y <= max.y
+            && point.z >= min.z && point.z <= max.z;
+    }
+
+    /// @brief Whether two boxes overlap or touch.
+    inline bool Intersects(const Aabb& other) const
+    {
+        return min.x <= other.max.x && max.x >= other.min.x
+            && min.y <= other.max.y && max.y >= other.min.y
+            && min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    /// @brief Grows the box to contain a point.
+    inline Aabb& Expand(const Vec3 point)
+    {
+        min = Vec3::Min(min, point);
+        max = Vec3::Max(max, point);
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    /// @brief Computes the smallest box containing both boxes.
+    inline static Aabb Merge(const Aabb& a, const Aabb& b)
+    {
+        return Aabb(Vec3::Min(a.min, b.min), Vec3::Max(a.max, b.max));
+    }
+
+    inline bool operator==(const Aabb& other) const
+    {
+        return min == other.min && max == other.max;
+    }
+
+    inline bool operator!=(const Aabb& other) const
+    {
+        return !(*this == other);
+    }
+
+    /// @brief Converts the Aabb to a string representation.
+    std::string ToString() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::math
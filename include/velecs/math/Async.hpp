@@ -0,0 +1,339 @@
+/// @file    Async.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 02:04:18
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Awaitable versions of the batch operations, for coroutine-based job systems. Requires
+/// C++20; configure the library with VELECS_MATH_CXX20=ON.
+///
+/// Each operation is a lazy Task that splits its span into chunks and, before every chunk,
+/// hands itself back to an executor. A large job therefore never holds a worker thread
+/// for longer than one chunk, and other tasks queued on the executor run in between:
+///
+///     Task<> UpdateMesh(MyExecutor& executor)
+///     {
+///         co_await SkinAsync(bones, influences, bindPose, skinned, executor);
+///         const std::size_t count = co_await CullAsync(frustum, spheres, visible, executor);
+///     }
+///
+/// An executor is any type with a Schedule(std::coroutine_handle<>) member that resumes
+/// the handle later, on whichever thread it likes. It must outlive the task, as must the
+/// memory behind every span. Chunks of one operation run one after another, never at the
+/// same time, so executors with many threads are safe to use.
+
+#pragma once
+
+#if !defined(__cpp_impl_coroutine)
+    #error "velecs/math/Async.hpp requires C++20 coroutines; configure velecs-math with VELECS_MATH_CXX20=ON"
+#endif
+
+#include "velecs/math/Batch.hpp"
+#include "velecs/math/Frustum.hpp"
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Skinning.hpp"
+#include "velecs/math/Span.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace velecs::math {
+
+/// @brief A type that can resume a coroutine at a later point.
+template<typename E>
+concept AsyncExecutor = requires(E& executor, std::coroutine_handle<> handle) {
+    executor.Schedule(handle);
+};
+
+/// @brief Elements processed per chunk unless a chunk size is given.
+constexpr std::size_t ASYNC_CHUNK = 16384;
+
+template<typename T = void>
+class Task;
+
+namespace detail {
+
+/// @brief The promise state shared by every Task: who to resume on completion, any
+///        exception to rethrow there, and whether it has finished.
+struct TaskPromiseBase {
+public:
+    // Enums
+
+    // Public Fields
+
+    std::coroutine_handle<> continuation; /// @brief The awaiting coroutine, or null if the task was started directly.
+    std::exception_ptr exception;         /// @brief The exception that ended the task, if any.
+    std::atomic<bool> done{false};        /// @brief Set with release order once the result or exception is stored.
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+    /// @brief Marks the task done, then resumes the awaiting coroutine directly, without
+    ///        growing the stack.
+    struct FinalAwaiter {
+        inline bool await_ready() const noexcept { return false; }
+
+        template<typename Promise>
+        inline std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+        {
+            // Once done is set, a thread polling IsDone() may destroy the frame, so read
+            // everything needed from the promise first.
+            const std::coroutine_handle<> continuation = handle.promise().continuation;
+            handle.promise().done.store(true, std::memory_order_release);
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        inline void await_resume() const noexcept {}
+    };
+
+    inline std::suspend_always initial_suspend() const noexcept { return {}; }
+    inline FinalAwaiter final_suspend() const noexcept { return {}; }
+    inline void unhandled_exception() noexcept { exception = std::current_exception(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+template<typename T>
+struct TaskPromise : TaskPromiseBase {
+public:
+    std::optional<T> value; /// @brief The result, once returned.
+
+    inline Task<T> get_return_object() noexcept;
+
+    template<typename U>
+    inline void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+
+    inline T Take()
+    {
+        if (exception) std::rethrow_exception(exception);
+        return std::move(*value);
+    }
+};
+
+template<>
+struct TaskPromise<void> : TaskPromiseBase {
+public:
+    inline Task<void> get_return_object() noexcept;
+
+    inline void return_void() const noexcept {}
+
+    inline void Take() const
+    {
+        if (exception) std::rethrow_exception(exception);
+    }
+};
+
+/// @brief Suspends the current coroutine and queues it on an executor.
+template<AsyncExecutor Executor>
+struct ScheduleOn {
+public:
+    Executor& executor;
+
+    inline bool await_ready() const noexcept { return false; }
+    inline void await_suspend(std::coroutine_handle<> handle) const { executor.Schedule(handle); }
+    inline void await_resume() const noexcept {}
+};
+
+inline void RequireChunkSize(const std::size_t chunkSize)
+{
+    if (chunkSize == 0) throw std::invalid_argument("Async chunk size must be greater than 0");
+}
+
+} // namespace detail
+
+/// @class Task
+/// @brief A lazily started coroutine producing a T.
+/// @details Nothing runs until the task is awaited or started. Awaiting it from another
+///          coroutine returns its result or rethrows its exception. Move-only.
+/// @tparam T The result type, or void.
+template<typename T>
+class Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a task that refers to no coroutine.
+    Task() = default;
+
+    inline explicit Task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    inline Task(Task&& other) noexcept : _handle(std::exchange(other._handle, nullptr)) {}
+
+    inline Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other) {
+            if (_handle) _handle.destroy();
+            _handle = std::exchange(other._handle, nullptr);
+        }
+        return *this;
+    }
+
+    /// @brief Destroys the coroutine. A task must not be destroyed while it is running.
+    ~Task()
+    {
+        if (_handle) _handle.destroy();
+    }
+
+    // Public Methods
+
+    /// @brief Starts a task that no coroutine awaits, e.g. from a plain function. It runs
+    ///        until its first suspension; poll IsDone() and then call Result().
+    inline void Start() { _handle.resume(); }
+
+    /// @brief Whether the task has finished, by returning or throwing. Safe to poll from a
+    ///        thread other than the one running the task; once it returns true, Result()
+    ///        sees the finished result.
+    inline bool IsDone() const noexcept
+    {
+        return _handle && _handle.promise().done.load(std::memory_order_acquire);
+    }
+
+    /// @brief The result of a finished task started with Start().
+    /// @throws Whatever the task threw.
+    inline T Result() { return _handle.promise().Take(); }
+
+    inline bool await_ready() const noexcept { return false; }
+
+    inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        _handle.promise().continuation = awaiting;
+        return _handle;
+    }
+
+    inline T await_resume() { return _handle.promise().Take(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::coroutine_handle<promise_type> _handle;
+
+    // Private Methods
+};
+
+namespace detail {
+
+template<typename T>
+inline Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+} // namespace detail
+
+/// @brief Awaitable TransformPointsMany.
+/// @param mat The transform; copied into the task.
+/// @param points The points to transform.
+/// @param[out] out Receives one point per input.
+/// @param executor Resumes the task before each chunk.
+/// @param chunkSize The number of points per chunk.
+/// @throws std::invalid_argument (when awaited) if out is smaller than points or chunkSize is 0.
+template<AsyncExecutor Executor>
+Task<> TransformPointsAsync(const Mat4 mat, Span<const Vec3> points, Span<Vec3> out, Executor& executor, const std::size_t chunkSize = ASYNC_CHUNK)
+{
+    detail::RequireChunkSize(chunkSize);
+    if (out.size() < points.size()) {
+        throw std::invalid_argument("TransformPointsAsync output span is smaller than the input");
+    }
+
+    for (std::size_t begin = 0; begin < points.size(); begin += chunkSize) {
+        co_await detail::ScheduleOn<Executor>{ executor };
+        const std::size_t count = std::min(chunkSize, points.size() - begin);
+        TransformPointsMany(mat, points.subspan(begin, count), out.subspan(begin, count));
+    }
+}
+
+/// @brief Awaitable CullSpheres.
+/// @param frustum The view volume; copied into the task.
+/// @param spheres The spheres as (center.x, center.y, center.z, radius).
+/// @param[out] visible Receives the index of each visible sphere, in ascending order.
+/// @param executor Resumes the task before each chunk.
+/// @param chunkSize The number of spheres per chunk.
+/// @returns The number of indices written.
+/// @throws std::invalid_argument (when awaited) if visible is smaller than spheres or chunkSize is 0.
+template<AsyncExecutor Executor>
+Task<std::size_t> CullAsync(const Frustum frustum, Span<const Vec4> spheres, Span<std::uint32_t> visible, Executor& executor, const std::size_t chunkSize = ASYNC_CHUNK)
+{
+    detail::RequireChunkSize(chunkSize);
+    if (visible.size() < spheres.size()) {
+        throw std::invalid_argument("CullAsync output span is smaller than the input");
+    }
+
+    std::size_t written = 0;
+    for (std::size_t begin = 0; begin < spheres.size(); begin += chunkSize) {
+        co_await detail::ScheduleOn<Executor>{ executor };
+        const std::size_t count = std::min(chunkSize, spheres.size() - begin);
+        // written <= begin, so the rest of visible always has room for this chunk.
+        written += CullSpheres(frustum, spheres.subspan(begin, count), visible.subspan(written), static_cast<std::uint32_t>(begin));
+    }
+    co_return written;
+}
+
+/// @brief Awaitable SkinPointsMany.
+/// @param bones The skinning matrix of every bone.
+/// @param influences One entry per position.
+/// @param positions The bind-pose positions.
+/// @param[out] out Receives one skinned position per input.
+/// @param executor Resumes the task before each chunk.
+/// @param chunkSize The number of vertices per chunk.
+/// @throws std::invalid_argument (when awaited) if a span is too small or chunkSize is 0.
+/// @throws std::out_of_range (when awaited) if an influence refers to a bone outside bones;
+///         the chunks before the offending vertex will already have been written.
+template<AsyncExecutor Executor>
+Task<> SkinAsync(Span<const Mat4> bones, Span<const BoneInfluence> influences, Span<const Vec3> positions, Span<Vec3> out, Executor& executor, const std::size_t chunkSize = ASYNC_CHUNK)
+{
+    detail::RequireChunkSize(chunkSize);
+    if (influences.size() < positions.size()) {
+        throw std::invalid_argument("SkinAsync has fewer influences than vertices");
+    }
+    if (out.size() < positions.size()) {
+        throw std::invalid_argument("SkinAsync output span is smaller than the input");
+    }
+
+    for (std::size_t begin = 0; begin < positions.size(); begin += chunkSize) {
+        co_await detail::ScheduleOn<Executor>{ executor };
+        const std::size_t count = std::min(chunkSize, positions.size() - begin);
+        SkinPointsMany(bones, influences.subspan(begin, count), positions.subspan(begin, count), out.subspan(begin, count));
+    }
+}
+
+} // namespace velecs::math
@@ -0,0 +1,165 @@
+/// @file    Backend.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 05:41:08
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// The storage behind Mat4 and Quat, selected when the library is configured.
+///
+/// VELECS_MATH_BACKEND=GLM (the default) stores glm::mat4 and glm::quat, and the vector
+/// types convert implicitly to and from their GLM counterparts.
+///
+/// VELECS_MATH_BACKEND=NATIVE stores the library's own types and implements the matrix
+/// products with the Float4 kernels from Simd.hpp; no GLM header is included. Both storages
+/// are indexed the same way (internal_mat[col][row], internal_quat.x), so code written
+/// against either compiles with both. Interop with GLM is explicit through
+/// velecs/math/Glm.hpp.
+
+#pragma once
+
+#if defined(VELECS_MATH_BACKEND_NATIVE)
+
+#include "velecs/math/Simd.hpp"
+
+namespace velecs::math::detail {
+
+/// @struct NativeMat4
+/// @brief A column-major 4x4 float matrix, laid out like glm::mat4.
+struct alignas(16) NativeMat4 {
+public:
+    // Enums
+
+    // Public Fields
+
+    float columns[4][4]; /// @brief The elements, indexed [col][row].
+
+    // Constructors and Destructors
+
+    /// @brief Leaves the elements uninitialized, as glm::mat4's defaulted constructor does.
+    NativeMat4() = default;
+
+    /// @brief Constructs a matrix with the given value on the diagonal and zeros elsewhere.
+    explicit constexpr NativeMat4(const float diagonal)
+        : columns{
+            { diagonal, 0.0f, 0.0f, 0.0f },
+            { 0.0f, diagonal, 0.0f, 0.0f },
+            { 0.0f, 0.0f, diagonal, 0.0f },
+            { 0.0f, 0.0f, 0.0f, diagonal },
+        } {}
+
+    /// @brief Default destructor.
+    ~NativeMat4() = default;
+
+    // Public Methods
+
+    /// @brief The column at the given index; index it again for the row.
+    inline float* operator[](const int col) { return columns[col]; }
+
+    /// @copydoc operator[](const int)
+    inline const float* operator[](const int col) const { return columns[col]; }
+
+    /// @brief Loads a column into SIMD lanes.
+    inline Float4 Column(const int col) const { return Float4::LoadAligned(columns[col]); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @struct NativeQuat
+/// @brief A quaternion stored as x, y, z, w, laid out like glm::quat.
+struct NativeQuat {
+public:
+    // Enums
+
+    // Public Fields
+
+    float x; /// @brief The x component of the vector part.
+    float y; /// @brief The y component of the vector part.
+    float z; /// @brief The z component of the vector part.
+    float w; /// @brief The scalar part.
+
+    // Constructors and Destructors
+
+    /// @brief Leaves the components uninitialized.
+    NativeQuat() = default;
+
+    /// @brief Constructs a quaternion from its components, scalar first as glm::quat does.
+    constexpr NativeQuat(const float w, const float x, const float y, const float z)
+        : x(x), y(y), z(z), w(w) {}
+
+    /// @brief Default destructor.
+    ~NativeQuat() = default;
+
+    // Public Methods
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @brief Multiplies a matrix by the column vector (x, y, z, w).
+inline Float4 MultiplyColumn(const NativeMat4& m, const float x, const float y, const float z, const float w)
+{
+    return m.Column(0) * Float4(x) + m.Column(1) * Float4(y) + m.Column(2) * Float4(z) + m.Column(3) * Float4(w);
+}
+
+/// @brief The matrix product lhs * rhs, one result column per step.
+inline NativeMat4 operator*(const NativeMat4& lhs, const NativeMat4& rhs)
+{
+    NativeMat4 result;
+    for (int col = 0; col < 4; ++col) {
+        MultiplyColumn(lhs, rhs[col][0], rhs[col][1], rhs[col][2], rhs[col][3]).StoreAligned(result[col]);
+    }
+    return result;
+}
+
+/// @brief Whether every element compares equal, so 0.0f equals -0.0f and NaN equals nothing.
+inline bool operator==(const NativeMat4& lhs, const NativeMat4& rhs)
+{
+    Float4 equal = Float4::Equal(lhs.Column(0), rhs.Column(0));
+    for (int col = 1; col < 4; ++col) {
+        equal = equal & Float4::Equal(lhs.Column(col), rhs.Column(col));
+    }
+    return Float4::MoveMask(equal) == 0xF;
+}
+
+inline bool operator!=(const NativeMat4& lhs, const NativeMat4& rhs)
+{
+    return !(lhs == rhs);
+}
+
+using Mat4Storage = NativeMat4;
+using QuatStorage = NativeQuat;
+
+} // namespace velecs::math::detail
+
+#else
+
+#include <glm/mat4x4.hpp>
+#include <glm/ext/quaternion_float.hpp>
+
+namespace velecs::math::detail {
+
+using Mat4Storage = glm::mat4;
+using QuatStorage = glm::quat;
+
+} // namespace velecs::math::detail
+
+#endif
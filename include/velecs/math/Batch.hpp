@@ -0,0 +1,128 @@
+/// @file    Batch.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 00:20:11
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Bulk operations over spans of vectors, quaternions and matrices. Every function runs a
+/// SIMD kernel that handles four elements per step. Passing BatchExecution::Parallel also
+/// splits the span into chunks across the library's worker threads.
+///
+/// Outputs may alias their input exactly (in-place), but must not partially overlap it.
+/// Include velecs/math/BatchExecution.hpp for overloads taking std::execution policies.
+
+#pragma once
+
+#include "velecs/math/Aabb.hpp"
+#include "velecs/math/Fwd.hpp"
+#include "velecs/math/Span.hpp"
+
+#include <cstdint>
+
+namespace velecs::math {
+
+/// @enum BatchExecution
+/// @brief Whether a batch operation may use more than the calling thread.
+enum class BatchExecution : std::uint8_t {
+    Serial,   /// @brief Run on the calling thread only.
+    Parallel, /// @brief Split large spans across the library's worker threads.
+};
+
+/// @brief Transforms points (w=1) by an affine matrix, as Mat4 * Point3 does.
+/// @param mat The transform. No perspective divide is performed.
+/// @param points The points to transform.
+/// @param[out] out Receives one point per input.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if out is smaller than points.
+void TransformPointsMany(const Mat4& mat, Span<const Vec3> points, Span<Vec3> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Transforms directions (w=0) by a matrix, ignoring translation, as Mat4 * Dir3 does.
+/// @param mat The transform.
+/// @param directions The directions to transform. They are not renormalized.
+/// @param[out] out Receives one direction per input.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if out is smaller than directions.
+void TransformDirectionsMany(const Mat4& mat, Span<const Vec3> directions, Span<Vec3> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Computes mat * v for every vector.
+/// @param mat The transform.
+/// @param vectors The vectors to transform.
+/// @param[out] out Receives one vector per input.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if out is smaller than vectors.
+void TransformMany(const Mat4& mat, Span<const Vec4> vectors, Span<Vec4> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Computes mat * m for every matrix, e.g. to apply a parent transform.
+/// @param mat The matrix to pre-multiply with.
+/// @param matrices The matrices to transform.
+/// @param[out] out Receives one matrix per input.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if out is smaller than matrices.
+void TransformMany(const Mat4& mat, Span<const Mat4> matrices, Span<Mat4> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Normalizes every vector. Zero vectors become zero, as with Vec2::Normalize.
+/// @param vectors The vectors to normalize.
+/// @param[out] out Receives one vector per input.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if out is smaller than vectors.
+void NormalizeMany(Span<const Vec2> vectors, Span<Vec2> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @copydoc NormalizeMany(Span<const Vec2>, Span<Vec2>, const BatchExecution)
+void NormalizeMany(Span<const Vec3> vectors, Span<Vec3> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @copydoc NormalizeMany(Span<const Vec2>, Span<Vec2>, const BatchExecution)
+void NormalizeMany(Span<const Vec4> vectors, Span<Vec4> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Normalizes every quaternion. Zero quaternions become the identity.
+/// @param quats The quaternions to normalize.
+/// @param[out] out Receives one quaternion per input.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if out is smaller than quats.
+void NormalizeMany(Span<const Quat> quats, Span<Quat> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Linearly interpolates between corresponding vectors of two spans.
+/// @param a The values at t = 0.
+/// @param b The values at t = 1.
+/// @param t The interpolation factor, shared by every element.
+/// @param[out] out Receives one vector per pair.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if the spans differ in size or out is smaller than a.
+void LerpMany(Span<const Vec2> a, Span<const Vec2> b, const float t, Span<Vec2> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @copydoc LerpMany(Span<const Vec2>, Span<const Vec2>, const float, Span<Vec2>, const BatchExecution)
+void LerpMany(Span<const Vec3> a, Span<const Vec3> b, const float t, Span<Vec3> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @copydoc LerpMany(Span<const Vec2>, Span<const Vec2>, const float, Span<Vec2>, const BatchExecution)
+void LerpMany(Span<const Vec4> a, Span<const Vec4> b, const float t, Span<Vec4> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Interpolates between corresponding rotations with a normalized lerp along the shortest arc.
+/// @details See Quat::Slerp for constant angular velocity.
+/// @copydetails LerpMany(Span<const Vec2>, Span<const Vec2>, const float, Span<Vec2>, const BatchExecution)
+void LerpMany(Span<const Quat> a, Span<const Quat> b, const float t, Span<Quat> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Clamps every vector component-wise between min and max.
+/// @param vectors The vectors to clamp.
+/// @param min The lower bound of each component.
+/// @param max The upper bound of each component.
+/// @param[out] out Receives one vector per input.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if out is smaller than vectors.
+void ClampMany(Span<const Vec2> vectors, const Vec2& min, const Vec2& max, Span<Vec2> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @copydoc ClampMany(Span<const Vec2>, const Vec2&, const Vec2&, Span<Vec2>, const BatchExecution)
+void ClampMany(Span<const Vec3> vectors, const Vec3& min, const Vec3& max, Span<Vec3> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @copydoc ClampMany(Span<const Vec2>, const Vec2&, const Vec2&, Span<Vec2>, const BatchExecution)
+void ClampMany(Span<const Vec4> vectors, const Vec4& min, const Vec4& max, Span<Vec4> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Computes the smallest box containing every point.
+/// @param points The points to bound.
+/// @param execution Whether to use worker threads.
+/// @returns The bounds, or Aabb::EMPTY if there are no points.
+Aabb BoundsOf(Span<const Vec3> points, const BatchExecution execution = BatchExecution::Serial);
+
+} // namespace velecs::math
@@ -0,0 +1,244 @@
+/// @file    BatchExecution.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 00:34:57
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Overloads of the Batch.hpp operations that take a standard execution policy as their
+/// first argument, like the parallel STL algorithms:
+///
+///     NormalizeMany(std::execution::par_unseq, normals, normals);
+///
+/// Parallel policies split the span into chunks and hand them to std::for_each with the
+/// same policy, so the work runs on the standard library's scheduler alongside the rest
+/// of the program's parallel algorithms. Each chunk is processed by the library's SIMD
+/// kernel, so vectorization does not depend on the compiler seeing through a lambda.
+/// Where the standard library has no parallel algorithms, parallel policies fall back to
+/// BatchExecution::Parallel. Sequenced and unsequenced policies run on the calling thread.
+///
+/// This is a separate header because <execution> can require linking a parallel backend
+/// (e.g. TBB for libstdc++) as soon as it is included.
+
+#pragma once
+
+#include "velecs/math/Batch.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace velecs::math {
+
+namespace detail {
+
+/// @brief Enables an overload only for standard execution policy types.
+template<typename Policy>
+using EnableIfExecutionPolicy = std::enable_if_t<std::is_execution_policy_v<std::remove_cv_t<std::remove_reference_t<Policy>>>, int>;
+
+/// @brief Whether a policy allows running on more than one thread.
+template<typename Policy>
+constexpr bool IsParallelPolicy()
+{
+    using P = std::remove_cv_t<std::remove_reference_t<Policy>>;
+    return std::is_same_v<P, std::execution::parallel_policy>
+        || std::is_same_v<P, std::execution::parallel_unsequenced_policy>;
+}
+
+/// @brief Elements per chunk handed to the standard library.
+constexpr std::size_t POLICY_GRAIN = 4096;
+
+/// @brief The first index of every chunk of [0, count).
+inline std::vector<std::size_t> PolicyChunkStarts(const std::size_t count)
+{
+    std::vector<std::size_t> starts((count + POLICY_GRAIN - 1) / POLICY_GRAIN);
+    for (std::size_t i = 0; i < starts.size(); ++i) {
+        starts[i] = i * POLICY_GRAIN;
+    }
+    return starts;
+}
+
+/// @brief Runs chunk(begin, end) over [0, count) as the policy allows.
+/// @param fallback Called instead when the policy is parallel but the standard library
+///                 provides no parallel algorithms.
+template<typename Policy, typename Chunk, typename Fallback>
+void ForEachPolicyChunk(Policy&& policy, const std::size_t count, Chunk&& chunk, Fallback&& fallback)
+{
+    if constexpr (!IsParallelPolicy<Policy>()) {
+        chunk(std::size_t(0), count);
+    }
+    else {
+#if defined(__cpp_lib_parallel_algorithm)
+        (void)fallback;
+        if (count <= POLICY_GRAIN) {
+            chunk(std::size_t(0), count);
+            return;
+        }
+        const std::vector<std::size_t> starts = PolicyChunkStarts(count);
+        std::for_each(std::forward<Policy>(policy), starts.begin(), starts.end(), [&chunk, count](const std::size_t begin) {
+            chunk(begin, std::min(begin + POLICY_GRAIN, count));
+        });
+#else
+        (void)policy;
+        (void)chunk;
+        fallback();
+#endif
+    }
+}
+
+/// @brief Views a contiguous range (Span, std::vector, std::array, ...) as a read-only Span.
+template<typename Range>
+inline auto AsConstSpan(Range& range)
+{
+    using T = std::remove_const_t<std::remove_pointer_t<decltype(std::data(range))>>;
+    return Span<const T>(std::data(range), std::size(range));
+}
+
+/// @brief Views a contiguous range (Span, std::vector, std::array, ...) as a writable Span.
+template<typename Range>
+inline auto AsSpan(Range& range)
+{
+    using T = std::remove_pointer_t<decltype(std::data(range))>;
+    return Span<T>(std::data(range), std::size(range));
+}
+
+/// @brief Validates span sizes up front, since chunks cannot throw under a parallel policy.
+inline void RequirePolicySpans(const bool ok, const char* message)
+{
+    if (!ok) throw std::invalid_argument(message);
+}
+
+} // namespace detail
+
+/// @brief TransformPointsMany under an execution policy.
+template<typename Policy, detail::EnableIfExecutionPolicy<Policy> = 0>
+void TransformPointsMany(Policy&& policy, const Mat4& mat, Span<const Vec3> points, Span<Vec3> out)
+{
+    detail::RequirePolicySpans(out.size() >= points.size(), "TransformPointsMany output span is smaller than the input");
+    detail::ForEachPolicyChunk(std::forward<Policy>(policy), points.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            TransformPointsMany(mat, points.subspan(begin, end - begin), out.subspan(begin, end - begin));
+        },
+        [&] { TransformPointsMany(mat, points, out, BatchExecution::Parallel); }
+    );
+}
+
+/// @brief TransformDirectionsMany under an execution policy.
+template<typename Policy, detail::EnableIfExecutionPolicy<Policy> = 0>
+void TransformDirectionsMany(Policy&& policy, const Mat4& mat, Span<const Vec3> directions, Span<Vec3> out)
+{
+    detail::RequirePolicySpans(out.size() >= directions.size(), "TransformDirectionsMany output span is smaller than the input");
+    detail::ForEachPolicyChunk(std::forward<Policy>(policy), directions.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            TransformDirectionsMany(mat, directions.subspan(begin, end - begin), out.subspan(begin, end - begin));
+        },
+        [&] { TransformDirectionsMany(mat, directions, out, BatchExecution::Parallel); }
+    );
+}
+
+/// @brief TransformMany under an execution policy.
+/// @param values A contiguous range of Vec4 or Mat4.
+/// @param out A contiguous range of the same type.
+template<typename Policy, typename In, typename Out, detail::EnableIfExecutionPolicy<Policy> = 0>
+void TransformMany(Policy&& policy, const Mat4& mat, In&& values, Out&& out)
+{
+    const auto src = detail::AsConstSpan(values);
+    const auto dst = detail::AsSpan(out);
+    detail::RequirePolicySpans(dst.size() >= src.size(), "TransformMany output span is smaller than the input");
+    detail::ForEachPolicyChunk(std::forward<Policy>(policy), src.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            TransformMany(mat, src.subspan(begin, end - begin), dst.subspan(begin, end - begin));
+        },
+        [&] { TransformMany(mat, src, dst, BatchExecution::Parallel); }
+    );
+}
+
+/// @brief NormalizeMany under an execution policy.
+/// @param values A contiguous range of Vec2, Vec3, Vec4 or Quat.
+/// @param out A contiguous range of the same type.
+template<typename Policy, typename In, typename Out, detail::EnableIfExecutionPolicy<Policy> = 0>
+void NormalizeMany(Policy&& policy, In&& values, Out&& out)
+{
+    const auto src = detail::AsConstSpan(values);
+    const auto dst = detail::AsSpan(out);
+    detail::RequirePolicySpans(dst.size() >= src.size(), "NormalizeMany output span is smaller than the input");
+    detail::ForEachPolicyChunk(std::forward<Policy>(policy), src.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            NormalizeMany(src.subspan(begin, end - begin), dst.subspan(begin, end - begin));
+        },
+        [&] { NormalizeMany(src, dst, BatchExecution::Parallel); }
+    );
+}
+
+/// @brief LerpMany under an execution policy.
+/// @param a A contiguous range of Vec2, Vec3, Vec4 or Quat.
+/// @param b A contiguous range of the same type and size.
+/// @param out A contiguous range of the same type.
+template<typename Policy, typename A, typename B, typename Out, detail::EnableIfExecutionPolicy<Policy> = 0>
+void LerpMany(Policy&& policy, A&& a, B&& b, const float t, Out&& out)
+{
+    const auto srcA = detail::AsConstSpan(a);
+    const auto srcB = detail::AsConstSpan(b);
+    const auto dst = detail::AsSpan(out);
+    detail::RequirePolicySpans(srcA.size() == srcB.size(), "LerpMany input spans differ in size");
+    detail::RequirePolicySpans(dst.size() >= srcA.size(), "LerpMany output span is smaller than the input");
+    detail::ForEachPolicyChunk(std::forward<Policy>(policy), srcA.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            LerpMany(srcA.subspan(begin, end - begin), srcB.subspan(begin, end - begin), t, dst.subspan(begin, end - begin));
+        },
+        [&] { LerpMany(srcA, srcB, t, dst, BatchExecution::Parallel); }
+    );
+}
+
+/// @brief ClampMany under an execution policy.
+/// @param values A contiguous range of Vec2, Vec3 or Vec4.
+/// @param out A contiguous range of the same type.
+template<typename Policy, typename In, typename V, typename Out, detail::EnableIfExecutionPolicy<Policy> = 0>
+void ClampMany(Policy&& policy, In&& values, const V& min, const V& max, Out&& out)
+{
+    const auto src = detail::AsConstSpan(values);
+    const auto dst = detail::AsSpan(out);
+    detail::RequirePolicySpans(dst.size() >= src.size(), "ClampMany output span is smaller than the input");
+    detail::ForEachPolicyChunk(std::forward<Policy>(policy), src.size(),
+        [&](const std::size_t begin, const std::size_t end) {
+            ClampMany(src.subspan(begin, end - begin), min, max, dst.subspan(begin, end - begin));
+        },
+        [&] { ClampMany(src, min, max, dst, BatchExecution::Parallel); }
+    );
+}
+
+/// @brief BoundsOf under an execution policy, reduced with std::transform_reduce.
+template<typename Policy, detail::EnableIfExecutionPolicy<Policy> = 0>
+Aabb BoundsOf(Policy&& policy, Span<const Vec3> points)
+{
+    if constexpr (!detail::IsParallelPolicy<Policy>()) {
+        return BoundsOf(points);
+    }
+    else {
+#if defined(__cpp_lib_parallel_algorithm)
+        if (points.size() <= detail::POLICY_GRAIN) return BoundsOf(points);
+
+        const std::vector<std::size_t> starts = detail::PolicyChunkStarts(points.size());
+        return std::transform_reduce(std::forward<Policy>(policy), starts.begin(), starts.end(), Aabb::EMPTY,
+            [](const Aabb& a, const Aabb& b) { return Aabb::Merge(a, b); },
+            [points](const std::size_t begin) {
+                const std::size_t count = std::min(detail::POLICY_GRAIN, points.size() - begin);
+                return BoundsOf(points.subspan(begin, count));
+            }
+        );
+#else
+        (void)policy;
+        return BoundsOf(points, BatchExecution::Parallel);
+#endif
+    }
+}
+
+} // namespace velecs::math
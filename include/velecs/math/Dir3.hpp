@@ -0,0 +1,177 @@
+/// @file    Dir3.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 21:58:31
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <cmath>
+#include <string>
+
+namespace velecs::math {
+
+/// @struct Dir3
+/// @brief A direction or displacement in 3D space (implicit w=0).
+///
+/// Dir3 and Point3 let the type system track what a Vec3 means: transforming a Dir3
+/// by a Mat4 ignores translation, and only geometrically valid combinations compile
+/// (Point3 - Point3 is a Dir3, Point3 + Point3 does not exist). Neither needs a trip
+/// through Vec4 to be transformed.
+struct Dir3 {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const Dir3 RIGHT;    /// @brief The right direction in a right-handed coordinate system (1, 0, 0).
+    static const Dir3 LEFT;     /// @brief The left direction in a right-handed coordinate system (-1, 0, 0).
+    static const Dir3 UP;       /// @brief The up direction in a right-handed coordinate system (0, 1, 0).
+    static const Dir3 DOWN;     /// @brief The down direction in a right-handed coordinate system (0, -1, 0).
+    static const Dir3 FORWARD;  /// @brief The forward direction in a right-handed coordinate system (0, 0, -1).
+    static const Dir3 BACKWARD; /// @brief The backward direction in a right-handed coordinate system (0, 0, 1).
+
+    float x; /// @brief The x-component of the direction.
+    float y; /// @brief The y-component of the direction.
+    float z; /// @brief The z-component of the direction.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a Dir3 with specified x, y, and z components.
+    /// @param[in] x The x-component.
+    /// @param[in] y The y-component.
+    /// @param[in] z The z-component.
+    inline Dir3(const float x, const float y, const float z)
+        : x(x), y(y), z(z) {}
+
+    /// @brief Interprets a Vec3 as a direction.
+    /// @param[in] vec The vector to wrap.
+    inline explicit Dir3(const Vec3 vec)
+        : x(vec.x), y(vec.y), z(vec.z) {}
+
+    /// @brief Default destructor.
+    ~Dir3() = default;
+
+    // Public Methods
+
+    /// @brief Returns the untyped vector.
+    inline Vec3 ToVec3() const
+    {
+        return Vec3(x, y, z);
+    }
+
+    /// @brief Converts this direction to homogeneous coordinates (w=0).
+    inline Vec4 ToHomogeneous() const
+    {
+        return Vec4(x, y, z, 0.0f);
+    }
+
+    inline bool operator==(const Dir3 other) const
+    {
+        return x == other.x && y == other.y && z == other.z;
+    }
+
+    inline bool operator!=(const Dir3 other) const
+    {
+        return !(*this == other);
+    }
+
+    inline Dir3 operator-() const
+    {
+        return Dir3(-x, -y, -z);
+    }
+
+    inline Dir3& operator+=(const Dir3 other)
+    {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    inline Dir3& operator-=(const Dir3 other)
+    {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    inline Dir3& operator*=(const float scalar)
+    {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    /// @brief Computes the length of this direction.
+    inline float L2Norm() const
+    {
+        return std::sqrt(x*x + y*y + z*z);
+    }
+
+    /// @brief Alias for L2Norm.
+    inline float Magnitude() const { return L2Norm(); }
+
+    /// @brief Normalizes this direction, making its magnitude equal to 1.
+    /// @note If the original magnitude is 0, returns the zero direction.
+    inline Dir3 Normalize() const
+    {
+        return Dir3(ToVec3().Normalize());
+    }
+
+    /// @brief Computes the dot product of two directions.
+    inline static float Dot(const Dir3 a, const Dir3 b)
+    {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    /// @brief Computes the cross product of two directions.
+    inline static Dir3 Cross(const Dir3 a, const Dir3 b)
+    {
+        return Dir3(Vec3::Cross(a.ToVec3(), b.ToVec3()));
+    }
+
+    /// @brief Converts the Dir3 to a string representation.
+    std::string ToString() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+inline Dir3 operator+(const Dir3 lhs, const Dir3 rhs)
+{
+    return Dir3(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z);
+}
+
+inline Dir3 operator-(const Dir3 lhs, const Dir3 rhs)
+{
+    return Dir3(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z);
+}
+
+inline Dir3 operator*(const Dir3 lhs, const float rhs)
+{
+    return Dir3(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs);
+}
+
+inline Dir3 operator*(const float lhs, const Dir3 rhs)
+{
+    return rhs * lhs;
+}
+
+} // namespace velecs::math
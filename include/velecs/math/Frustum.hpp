@@ -0,0 +1,97 @@
+/// @file    Frustum.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 01:40:12
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Aabb.hpp"
+#include "velecs/math/Span.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::math {
+
+struct Mat4;
+
+/// @struct Frustum
+/// @brief The six clipping planes of a view volume, pointing inwards.
+///
+/// Each plane is stored as (nx, ny, nz, d) with a unit normal, so dot(n, p) + d is the
+/// signed distance of p from the plane and is non-negative inside.
+struct Frustum {
+public:
+    // Enums
+
+    /// @enum Plane
+    /// @brief The index of each plane in planes.
+    /// @details Unscoped so it indexes planes directly. The names are not upper case because
+    ///          windows.h defines NEAR and FAR as macros.
+    enum Plane : std::uint8_t {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+    };
+
+    // Public Fields
+
+    std::array<Vec4, 6> planes; /// @brief The planes, indexed by Plane.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a frustum from its planes.
+    /// @param planes The planes as (nx, ny, nz, d); they are normalized.
+    explicit Frustum(const std::array<Vec4, 6>& planes);
+
+    /// @brief Default destructor.
+    ~Frustum() = default;
+
+    // Public Methods
+
+    /// @brief Extracts the planes of a view-projection matrix (Gribb-Hartmann).
+    /// @param viewProjection The matrix mapping world space to clip space, with the [0, 1]
+    ///                       depth range used throughout the library.
+    /// @returns The world-space frustum.
+    static Frustum FromMatrix(const Mat4& viewProjection);
+
+    /// @brief Whether a sphere is at least partly inside the frustum.
+    /// @details Conservative: spheres near a frustum corner may pass although they lie outside.
+    bool IntersectsSphere(const Vec3 center, const float radius) const;
+
+    /// @brief Whether a box is at least partly inside the frustum. Conservative like IntersectsSphere.
+    bool IntersectsAabb(const Aabb& box) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @brief Finds the bounding spheres that intersect a frustum.
+/// @details Tests four spheres per step against all six planes.
+/// @param frustum The view volume.
+/// @param spheres The spheres as (center.x, center.y, center.z, radius).
+/// @param[out] visible Receives the index of each visible sphere, in ascending order.
+/// @param indexOffset Added to every written index, for culling a sub-range of a larger array.
+/// @returns The number of indices written.
+/// @throws std::invalid_argument if visible is smaller than spheres.
+std::size_t CullSpheres(const Frustum& frustum, Span<const Vec4> spheres, Span<std::uint32_t> visible, const std::uint32_t indexOffset = 0);
+
+} // namespace velecs::math
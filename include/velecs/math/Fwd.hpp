@@ -0,0 +1,48 @@
+/// @file    Fwd.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 05:10:12
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Forward declarations of the library's types, for headers that only name them in
+/// declarations (parameters, return types, pointers and references). Include the type's
+/// own header where its size or members are needed.
+
+#pragma once
+
+#include <cstdint>
+
+namespace velecs::math {
+
+struct Vec2;
+struct Vec3;
+struct Vec3A;
+struct Vec4;
+struct Dir3;
+struct Point3;
+struct Quat;
+struct Mat4;
+struct TaggedMat4;
+struct Aabb;
+struct Frustum;
+struct KdNeighbor;
+struct KdTree;
+struct LooseOctree;
+struct Rect;
+struct Quadtree;
+struct UniformGrid2D;
+struct BoneInfluence;
+struct TransformHierarchy;
+struct TransformSnapshotBuffer;
+struct TransformBuilder;
+
+template<typename T>
+class Span;
+
+enum class BatchExecution : std::uint8_t;
+
+} // namespace velecs::math
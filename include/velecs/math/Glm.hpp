@@ -0,0 +1,234 @@
+/// @file    Glm.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 06:02:19
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Explicit conversions between the library's types and GLM's, for either backend.
+///
+/// AsGlm views a value as its GLM counterpart without copying, e.g. to pass a Mat4 to code
+/// that takes a glm::mat4&. The layouts are checked at compile time. FromGlm goes the other
+/// way by value, because GLM's types may be less aligned than the native Mat4.
+///
+///     glm::mat4& view = AsGlm(worldMatrix);
+///     const Mat4 projection = FromGlm(glm::perspective(fov, aspect, zNear, zFar));
+///
+/// With the GLM backend, Mat4 and Quat already store GLM's types and AsGlm returns those.
+///
+/// The Span overloads do the same for whole arrays, in both directions, without copying:
+///
+///     std::vector<Vec4> colors = ...;
+///     Span<glm::vec4> glmColors = AsGlm(colors);
+///     Span<const Mat4> bones = FromGlm(Span<const glm::mat4>(glmBones));
+///
+/// Unlike the single-value FromGlm, FromGlm on a span returns a view; it throws
+/// std::invalid_argument if the GLM array is not aligned for the library's type.
+
+#pragma once
+
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Quat.hpp"
+#include "velecs/math/Span.hpp"
+#include "velecs/math/Vec2.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/ext/quaternion_float.hpp>
+
+#if defined(GLM_FORCE_QUAT_DATA_WXYZ)
+    #error "velecs/math/Glm.hpp expects glm::quat stored as x, y, z, w; do not define GLM_FORCE_QUAT_DATA_WXYZ"
+#endif
+
+namespace velecs::math {
+
+namespace detail {
+
+/// @brief Whether a From can be viewed as a To: same size, no stricter alignment, plain layout.
+template<typename From, typename To>
+constexpr bool IsGlmViewable = sizeof(From) == sizeof(To) && alignof(From) >= alignof(To)
+    && std::is_standard_layout_v<From> && std::is_standard_layout_v<To>;
+
+template<typename To, typename From>
+inline To& ViewAs(From& value)
+{
+    static_assert(IsGlmViewable<From, To>, "The types do not share a layout");
+    return reinterpret_cast<To&>(value);
+}
+
+template<typename To, typename From>
+inline const To& ViewAs(const From& value)
+{
+    static_assert(IsGlmViewable<From, To>, "The types do not share a layout");
+    return reinterpret_cast<const To&>(value);
+}
+
+/// @brief Maps each of the library's types to its GLM counterpart and back.
+template<typename T> struct GlmPair {};
+template<> struct GlmPair<Vec2> { using Glm = glm::vec2; };
+template<> struct GlmPair<Vec3> { using Glm = glm::vec3; };
+template<> struct GlmPair<Vec4> { using Glm = glm::vec4; };
+template<> struct GlmPair<Quat> { using Glm = glm::quat; };
+template<> struct GlmPair<Mat4> { using Glm = glm::mat4; };
+template<> struct GlmPair<glm::vec2> { using Velecs = Vec2; };
+template<> struct GlmPair<glm::vec3> { using Velecs = Vec3; };
+template<> struct GlmPair<glm::vec4> { using Velecs = Vec4; };
+template<> struct GlmPair<glm::quat> { using Velecs = Quat; };
+template<> struct GlmPair<glm::mat4> { using Velecs = Mat4; };
+
+/// @brief The GLM type for T, or for const T the const GLM type.
+template<typename T>
+using GlmOf = std::conditional_t<std::is_const_v<T>,
+    const typename GlmPair<std::remove_cv_t<T>>::Glm, typename GlmPair<std::remove_cv_t<T>>::Glm>;
+
+/// @brief The library's type for a GLM type T, keeping const.
+template<typename T>
+using VelecsOf = std::conditional_t<std::is_const_v<T>,
+    const typename GlmPair<std::remove_cv_t<T>>::Velecs, typename GlmPair<std::remove_cv_t<T>>::Velecs>;
+
+/// @brief The element type of a contiguous container.
+template<typename Container>
+using GlmElementOf = std::remove_pointer_t<decltype(std::data(std::declval<Container&>()))>;
+
+static_assert(IsGlmViewable<Vec2, glm::vec2> && IsGlmViewable<glm::vec2, Vec2>, "Vec2 and glm::vec2 do not share a layout");
+static_assert(IsGlmViewable<Vec3, glm::vec3> && IsGlmViewable<glm::vec3, Vec3>, "Vec3 and glm::vec3 do not share a layout");
+static_assert(IsGlmViewable<Vec4, glm::vec4> && IsGlmViewable<glm::vec4, Vec4>, "Vec4 and glm::vec4 do not share a layout");
+static_assert(IsGlmViewable<Quat, glm::quat>, "Quat and glm::quat do not share a layout");
+static_assert(IsGlmViewable<Mat4, glm::mat4>, "Mat4 and glm::mat4 do not share a layout");
+
+} // namespace detail
+
+/// @brief Views a Mat4 as a glm::mat4 without copying.
+inline glm::mat4& AsGlm(Mat4& mat)
+{
+#if defined(VELECS_MATH_BACKEND_NATIVE)
+    return detail::ViewAs<glm::mat4>(mat.internal_mat);
+#else
+    return mat.internal_mat;
+#endif
+}
+
+/// @copydoc AsGlm(Mat4&)
+inline const glm::mat4& AsGlm(const Mat4& mat)
+{
+#if defined(VELECS_MATH_BACKEND_NATIVE)
+    return detail::ViewAs<glm::mat4>(mat.internal_mat);
+#else
+    return mat.internal_mat;
+#endif
+}
+
+/// @brief Views a Quat as a glm::quat without copying.
+inline glm::quat& AsGlm(Quat& quat)
+{
+#if defined(VELECS_MATH_BACKEND_NATIVE)
+    return detail::ViewAs<glm::quat>(quat.internal_quat);
+#else
+    return quat.internal_quat;
+#endif
+}
+
+/// @copydoc AsGlm(Quat&)
+inline const glm::quat& AsGlm(const Quat& quat)
+{
+#if defined(VELECS_MATH_BACKEND_NATIVE)
+    return detail::ViewAs<glm::quat>(quat.internal_quat);
+#else
+    return quat.internal_quat;
+#endif
+}
+
+/// @brief Views a Vec2 as a glm::vec2 without copying.
+inline glm::vec2& AsGlm(Vec2& vec) { return detail::ViewAs<glm::vec2>(vec); }
+
+/// @copydoc AsGlm(Vec2&)
+inline const glm::vec2& AsGlm(const Vec2& vec) { return detail::ViewAs<glm::vec2>(vec); }
+
+/// @brief Views a Vec3 as a glm::vec3 without copying.
+inline glm::vec3& AsGlm(Vec3& vec) { return detail::ViewAs<glm::vec3>(vec); }
+
+/// @copydoc AsGlm(Vec3&)
+inline const glm::vec3& AsGlm(const Vec3& vec) { return detail::ViewAs<glm::vec3>(vec); }
+
+/// @brief Views a Vec4 as a glm::vec4 without copying.
+inline glm::vec4& AsGlm(Vec4& vec) { return detail::ViewAs<glm::vec4>(vec); }
+
+/// @copydoc AsGlm(Vec4&)
+inline const glm::vec4& AsGlm(const Vec4& vec) { return detail::ViewAs<glm::vec4>(vec); }
+
+/// @brief Converts a glm::mat4 to a Mat4.
+inline Mat4 FromGlm(const glm::mat4& mat)
+{
+#if defined(VELECS_MATH_BACKEND_NATIVE)
+    static_assert(sizeof(detail::Mat4Storage) == sizeof(glm::mat4), "The matrix layouts differ");
+    Mat4 result(1.0f);
+    std::memcpy(&result.internal_mat, &mat, sizeof(glm::mat4));
+    return result;
+#else
+    return Mat4(mat);
+#endif
+}
+
+/// @brief Converts a glm::quat to a Quat.
+inline Quat FromGlm(const glm::quat& quat) { return Quat(quat.x, quat.y, quat.z, quat.w); }
+
+/// @brief Converts a glm::vec2 to a Vec2.
+inline Vec2 FromGlm(const glm::vec2& vec) { return Vec2(vec.x, vec.y); }
+
+/// @brief Converts a glm::vec3 to a Vec3.
+inline Vec3 FromGlm(const glm::vec3& vec) { return Vec3(vec.x, vec.y, vec.z); }
+
+/// @brief Converts a glm::vec4 to a Vec4.
+inline Vec4 FromGlm(const glm::vec4& vec) { return Vec4(vec.x, vec.y, vec.z, vec.w); }
+
+/// @brief Views an array of Vec2, Vec3, Vec4, Quat or Mat4 as the GLM type without copying.
+/// @param values The elements to view. Constness carries over.
+template<typename T>
+inline Span<detail::GlmOf<T>> AsGlm(const Span<T> values) noexcept
+{
+    using Glm = detail::GlmOf<T>;
+    static_assert(detail::IsGlmViewable<std::remove_cv_t<T>, std::remove_cv_t<Glm>>, "The types do not share a layout");
+    return Span<Glm>(reinterpret_cast<Glm*>(values.data()), values.size());
+}
+
+/// @brief Views a contiguous container such as std::vector<Vec3> as the GLM type.
+/// @param values The container to view. Must outlive the span.
+template<typename Container, typename Element = detail::GlmElementOf<Container>, typename Glm = detail::GlmOf<Element>>
+inline Span<Glm> AsGlm(Container& values) noexcept
+{
+    return AsGlm(Span<Element>(values));
+}
+
+/// @brief Views an array of GLM vectors, quaternions or matrices as the library's type.
+/// @param values The elements to view. Constness carries over.
+/// @returns A span over the same memory.
+/// @throws std::invalid_argument If the array is not aligned for the library's type, which
+///         can only happen for Mat4 with the native backend.
+template<typename T>
+inline Span<detail::VelecsOf<T>> FromGlm(const Span<T> values)
+{
+    using Velecs = detail::VelecsOf<T>;
+    static_assert(sizeof(Velecs) == sizeof(T) && std::is_standard_layout_v<std::remove_cv_t<Velecs>>,
+        "The types do not share a layout");
+    if constexpr (alignof(Velecs) > alignof(T)) {
+        if (reinterpret_cast<std::uintptr_t>(values.data()) % alignof(Velecs) != 0) {
+            throw std::invalid_argument("The GLM array is not aligned for the library's type");
+        }
+    }
+    return Span<Velecs>(reinterpret_cast<Velecs*>(values.data()), values.size());
+}
+
+} // namespace velecs::math
@@ -0,0 +1,149 @@
+/// @file    Io.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 05:14:50
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Stream output and string conversion for the library's types.
+///
+/// The type headers do not include <iostream>, so that the many translation units that only
+/// do math neither parse it nor run its static initializer. Include this header where
+/// values are printed or logged:
+///
+///     #include "velecs/math/Io.hpp"
+///     std::cout << position << '\n' << worldMatrix;
+///
+/// The vector types keep their ToString() members; ToString() here covers every type,
+/// including Quat and Mat4.
+
+#pragma once
+
+#include "velecs/math/Aabb.hpp"
+#include "velecs/math/Dir3.hpp"
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Point3.hpp"
+#include "velecs/math/Quat.hpp"
+#include "velecs/math/Rect.hpp"
+#include "velecs/math/Vec2.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec3A.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+namespace velecs::math {
+
+/// @brief Outputs a Vec2 object to an output stream in a formatted manner.
+/// @param[in] os The output stream to write to.
+/// @param[in] vec The Vec2 object to output.
+/// @return The same output stream, for chaining.
+inline std::ostream& operator<<(std::ostream& os, const Vec2 vec)
+{
+    os << vec.ToString();
+    return os;
+}
+
+/// @brief Outputs a Vec3 object to an output stream in a formatted manner.
+/// @param[in] os The output stream to write to.
+/// @param[in] vec The Vec3 object to output.
+/// @return The same output stream, for chaining.
+inline std::ostream& operator<<(std::ostream& os, const Vec3 vec)
+{
+    os << vec.ToString();
+    return os;
+}
+
+/// @brief Outputs a Vec3A object to an output stream in a formatted manner.
+/// @param[in] os The output stream to write to.
+/// @param[in] vec The Vec3A object to output.
+/// @return The same output stream, for chaining.
+inline std::ostream& operator<<(std::ostream& os, const Vec3A vec)
+{
+    os << vec.ToString();
+    return os;
+}
+
+/// @brief Outputs a Vec4 object to an output stream in a formatted manner.
+/// @param[in] os The output stream to write to.
+/// @param[in] vec The Vec4 object to output.
+/// @return The same output stream, for chaining.
+inline std::ostream& operator<<(std::ostream& os, const Vec4 vec)
+{
+    os << vec.ToString();
+    return os;
+}
+
+/// @brief Outputs a Dir3 object to an output stream in a formatted manner.
+inline std::ostream& operator<<(std::ostream& os, const Dir3 dir)
+{
+    os << dir.ToString();
+    return os;
+}
+
+/// @brief Outputs a Point3 object to an output stream in a formatted manner.
+inline std::ostream& operator<<(std::ostream& os, const Point3 point)
+{
+    os << point.ToString();
+    return os;
+}
+
+/// @brief Outputs an Aabb object to an output stream in a formatted manner.
+inline std::ostream& operator<<(std::ostream& os, const Aabb& box)
+{
+    os << box.ToString();
+    return os;
+}
+
+/// @brief Outputs a Rect object to an output stream in a formatted manner.
+inline std::ostream& operator<<(std::ostream& os, const Rect& rect)
+{
+    os << rect.ToString();
+    return os;
+}
+
+/// @brief Outputs a Quat object to an output stream as (x, y, z, w).
+/// @param[in] os The output stream to write to.
+/// @param[in] quat The Quat object to output.
+/// @return The same output stream, for chaining.
+inline std::ostream& operator<<(std::ostream& os, const Quat& quat)
+{
+    const detail::QuatStorage& q = quat.internal_quat;
+    os << '(' << q.x << ", " << q.y << ", " << q.z << ", " << q.w << ')';
+    return os;
+}
+
+/// @brief Outputs a Mat4 object to an output stream in a formatted manner.
+/// @param[in] os The output stream to write to.
+/// @param[in] mat The Mat4 object to output.
+/// @return The same output stream, for chaining.
+inline std::ostream& operator<<(std::ostream& os, const Mat4& mat)
+{
+    for (int row = 0; row < 4; ++row) {
+        os << "| ";
+        for (int col = 0; col < 4; ++col) {
+            os << std::setw(10) << std::setprecision(4) << mat.internal_mat[col][row] << " ";
+        }
+        os << "|" << std::endl;
+    }
+    return os;
+}
+
+/// @brief Converts any of the library's types to the string its operator<< writes.
+/// @param[in] value The value to convert.
+/// @returns The string representation.
+template<typename T>
+inline std::string ToString(const T& value)
+{
+    std::ostringstream oss;
+    oss << value;
+    return oss.str();
+}
+
+} // namespace velecs::math
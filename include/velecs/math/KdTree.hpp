@@ -0,0 +1,155 @@
+/// @file    KdTree.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 07:04:26
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Batch.hpp"
+#include "velecs/math/Span.hpp"
+#include "velecs/math/Vec3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace velecs::math {
+
+/// @struct KdNeighbor
+/// @brief A point found by a KdTree query.
+struct KdNeighbor {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr std::uint32_t NONE = 0xFFFFFFFFu; /// @brief The index of an empty result slot.
+
+    std::uint32_t index{NONE};                                 /// @brief The index of the point in the span the tree was built from.
+    float distanceSq{std::numeric_limits<float>::infinity()}; /// @brief The squared distance from the query.
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @struct KdTree
+/// @brief A static k-d tree over a point cloud for nearest-neighbor and radius queries.
+///
+/// The tree is complete and balanced: every split halves its range at the median along the
+/// axis of largest extent, until the leaves hold at most LEAF_SIZE points. Nodes are stored
+/// implicitly in breadth-first order (the children of node i are 2i+1 and 2i+2), so a node
+/// is just its split value and axis. The points are copied into structure-of-arrays leaf
+/// blocks of equal, SIMD-padded stride, and each leaf is scanned four points at a time.
+///
+/// Queries take an epsilon for approximate search: a subtree is skipped unless it could
+/// hold a point closer than the current k-th distance divided by (1 + epsilon), so every
+/// reported distance is within a factor of (1 + epsilon) of the true one. 0 is exact.
+///
+/// Rebuild the tree when the points change; it keeps its own copy of them.
+struct KdTree {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr std::size_t LEAF_SIZE = 16; /// @brief The most points a leaf holds.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs an empty tree; every query finds nothing.
+    KdTree() = default;
+
+    /// @brief Builds a tree over a point cloud.
+    /// @param points The points. Indices in query results refer to this span.
+    /// @param execution Whether to build subtrees on worker threads.
+    /// @throws std::invalid_argument if there are 2^32 - 1 or more points.
+    explicit KdTree(Span<const Vec3> points, const BatchExecution execution = BatchExecution::Serial);
+
+    /// @brief Default destructor.
+    ~KdTree() = default;
+
+    // Public Methods
+
+    /// @brief The number of points in the tree.
+    inline std::size_t Size() const { return _size; }
+
+    /// @brief Whether the tree holds no points.
+    inline bool IsEmpty() const { return _size == 0; }
+
+    /// @brief Finds the point closest to a query.
+    /// @param query The query position.
+    /// @param epsilon The allowed relative error; 0 for an exact search.
+    /// @returns The nearest point, or an empty KdNeighbor if the tree is empty.
+    KdNeighbor Nearest(const Vec3 query, const float epsilon = 0.0f) const;
+
+    /// @brief Finds the k points closest to a query.
+    /// @param query The query position.
+    /// @param[out] out Receives the neighbors by increasing distance; its size is k. Slots past
+    ///                 the number of points in the tree are left empty.
+    /// @param epsilon The allowed relative error; 0 for an exact search.
+    /// @returns The number of neighbors found, min(k, Size()).
+    std::size_t KNearest(const Vec3 query, Span<KdNeighbor> out, const float epsilon = 0.0f) const;
+
+    /// @brief Finds every point within a radius of a query.
+    /// @param query The query position.
+    /// @param radius The search radius; points at exactly this distance are included.
+    /// @param[out] out Cleared, then receives the points found in no particular order.
+    void Radius(const Vec3 query, const float radius, std::vector<KdNeighbor>& out) const;
+
+    /// @brief Nearest for every query.
+    /// @param queries The query positions.
+    /// @param[out] out Receives one neighbor per query.
+    /// @param epsilon The allowed relative error; 0 for an exact search.
+    /// @param execution Whether to use worker threads.
+    /// @throws std::invalid_argument if out is smaller than queries.
+    void NearestMany(Span<const Vec3> queries, Span<KdNeighbor> out, const float epsilon = 0.0f,
+        const BatchExecution execution = BatchExecution::Serial) const;
+
+    /// @brief KNearest for every query.
+    /// @param queries The query positions.
+    /// @param k The number of neighbors per query.
+    /// @param[out] out Receives k neighbors per query, query i at [i * k, i * k + k).
+    /// @param epsilon The allowed relative error; 0 for an exact search.
+    /// @param execution Whether to use worker threads.
+    /// @throws std::invalid_argument if out is smaller than queries.size() * k.
+    void KNearestMany(Span<const Vec3> queries, const std::size_t k, Span<KdNeighbor> out, const float epsilon = 0.0f,
+        const BatchExecution execution = BatchExecution::Serial) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::size_t _size{0};                /// @brief The number of points.
+    std::size_t _stride{0};              /// @brief The slots per leaf, a multiple of 4; unused slots lie at infinity.
+    std::vector<float> _splits;          /// @brief The split value of each internal node, breadth-first.
+    std::vector<std::uint8_t> _axes;     /// @brief The split axis of each internal node, 0 to 2.
+    std::vector<float> _xs;              /// @brief The x coordinate of each leaf slot.
+    std::vector<float> _ys;              /// @brief The y coordinate of each leaf slot.
+    std::vector<float> _zs;              /// @brief The z coordinate of each leaf slot.
+    std::vector<std::uint32_t> _indices; /// @brief The input index of each leaf slot, or KdNeighbor::NONE.
+
+    // Private Methods
+};
+
+} // namespace velecs::math
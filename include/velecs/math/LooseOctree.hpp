@@ -0,0 +1,174 @@
+/// @file    LooseOctree.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 07:48:13
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Aabb.hpp"
+#include "velecs/math/Fwd.hpp"
+#include "velecs/math/Vec3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace velecs::math {
+
+/// @struct LooseOctree
+/// @brief A loose octree of bounding spheres for scenes whose objects move every frame.
+///
+/// Every node's bounds are its cell expanded by half the cell size on each side, so an
+/// object fits in any cell of at least twice its radius that holds its center. Insert and
+/// Move therefore pick the node directly: the depth follows from the radius and the cell
+/// from the center, and the node is found through a hash of (depth, cell). Moving an
+/// object within its node only rewrites its sphere.
+///
+/// Nodes come from one pool and are recycled once they hold no objects and no children.
+/// Queries walk the tree from the root and test the eight children of a node four at a
+/// time with SIMD before descending. Objects whose center lies outside the world bounds
+/// are kept in the root, so they are still found, just without culling.
+struct LooseOctree {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFFu; /// @brief An id that names no object.
+    static constexpr std::uint32_t MAX_DEPTH = 16;        /// @brief The deepest maxDepth the tree supports.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs an empty tree over a region.
+    /// @param worldBounds The region to subdivide. It is extended to a cube around its center.
+    /// @param maxDepth The deepest level; cells there have 1 / 2^maxDepth of the world size.
+    /// @throws std::invalid_argument if worldBounds is empty or maxDepth exceeds MAX_DEPTH.
+    explicit LooseOctree(const Aabb& worldBounds, const std::uint32_t maxDepth = 8);
+
+    /// @brief Default destructor.
+    ~LooseOctree() = default;
+
+    // Public Methods
+
+    /// @brief The number of objects in the tree.
+    inline std::size_t Size() const { return _objects.size() - _freeObjects.size(); }
+
+    /// @brief The number of nodes currently allocated, including the root.
+    inline std::size_t NodeCount() const { return _nodes.size() - _freeNodes.size(); }
+
+    /// @brief Adds an object.
+    /// @param center The center of its bounding sphere.
+    /// @param radius The radius of its bounding sphere; negative values are treated as 0.
+    /// @returns The object's id, valid until it is removed. Ids of removed objects are reused.
+    std::uint32_t Insert(const Vec3 center, const float radius);
+
+    /// @brief Updates an object's bounding sphere, relinking it only if it changes node.
+    /// @throws std::out_of_range if id does not name an object.
+    void Move(const std::uint32_t id, const Vec3 center, const float radius);
+
+    /// @brief Removes an object.
+    /// @throws std::out_of_range if id does not name an object.
+    void Remove(const std::uint32_t id);
+
+    /// @brief Removes every object and node.
+    void Clear();
+
+    /// @brief Finds the objects whose sphere intersects a sphere.
+    /// @param[out] out Cleared, then receives the ids found in no particular order.
+    void QuerySphere(const Vec3 center, const float radius, std::vector<std::uint32_t>& out) const;
+
+    /// @brief Finds the objects whose sphere intersects a box.
+    /// @param[out] out Cleared, then receives the ids found in no particular order.
+    void QueryAabb(const Aabb& box, std::vector<std::uint32_t>& out) const;
+
+    /// @brief Finds the objects whose sphere is at least partly inside a frustum.
+    /// @details Conservative like Frustum::IntersectsSphere.
+    /// @param[out] out Cleared, then receives the ids found in no particular order.
+    void QueryFrustum(const Frustum& frustum, std::vector<std::uint32_t>& out) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    /// @struct Entry
+    /// @brief An object's sphere as stored in its node.
+    struct Entry {
+        float x;
+        float y;
+        float z;
+        float radius;
+        std::uint32_t id;
+    };
+
+    /// @struct Node
+    /// @brief One cell. Its loose bounds are center +/- HalfSize(depth).
+    struct Node {
+        float center[3];
+        std::uint32_t depth;
+        std::uint64_t key;                /// @brief (depth, cell) as used by _lookup.
+        std::uint32_t parent;
+        std::uint32_t children[8];        /// @brief Indexed by x | y << 1 | z << 2, each 1 for the upper half.
+        std::uint8_t childMask;           /// @brief Bit i is set when children[i] exists.
+        std::vector<Entry> entries;
+    };
+
+    /// @struct Location
+    /// @brief Where an object is stored.
+    struct Location {
+        std::uint32_t node; /// @brief INVALID for a free id.
+        std::uint32_t slot; /// @brief The index in the node's entries.
+    };
+
+    // Private Fields
+
+    Vec3 _min;                                          /// @brief The minimum corner of the world cube.
+    float _size;                                        /// @brief The edge length of the world cube.
+    std::uint32_t _maxDepth;
+    std::vector<Node> _nodes;                           /// @brief The node pool; the root is node 0.
+    std::vector<std::uint32_t> _freeNodes;
+    std::unordered_map<std::uint64_t, std::uint32_t> _lookup; /// @brief Node index by (depth, cell).
+    std::vector<Location> _objects;                     /// @brief Indexed by id.
+    std::vector<std::uint32_t> _freeObjects;
+
+    // Private Methods
+
+    /// @brief The node an object with this sphere belongs in, created if necessary.
+    std::uint32_t NodeFor(const Vec3 center, const float radius);
+
+    /// @brief The deepest level whose cells are at least twice a radius across.
+    std::uint32_t DepthFor(const float radius) const;
+
+    /// @brief The node for a cell, creating it and its missing ancestors.
+    std::uint32_t FindOrCreate(const std::uint32_t depth, const std::uint32_t ix, const std::uint32_t iy, const std::uint32_t iz);
+
+    /// @brief Stores an entry in a node and records its location.
+    void Link(const std::uint32_t node, const Entry& entry);
+
+    /// @brief Removes an object's entry from its node, without pruning the node.
+    /// @returns The node the object was in.
+    std::uint32_t Unlink(const std::uint32_t id);
+
+    /// @brief Returns a node and its emptied ancestors to the pool.
+    void Prune(std::uint32_t node);
+
+    /// @brief Throws std::out_of_range unless id names an object.
+    void RequireObject(const std::uint32_t id) const;
+
+    /// @brief Half the edge of a node's loose bounds at a depth, which equals its cell's full edge.
+    inline float HalfSize(const std::uint32_t depth) const { return _size / static_cast<float>(1u << depth); }
+
+    /// @brief Collects the ids of the entries that entryTest accepts, descending only into
+    ///        children whose loose bounds nodeTest accepts.
+    template<typename NodeTest, typename EntryTest>
+    void Query(NodeTest&& nodeTest, EntryTest&& entryTest, std::vector<std::uint32_t>& out) const;
+};
+
+} // namespace velecs::math
@@ -10,26 +10,24 @@
 
 #pragma once
 
+#include "velecs/math/Backend.hpp"
 #include "velecs/math/Consts.hpp"
 #include "velecs/math/Vec4.hpp"
-
-#include <iostream>
-#include <iomanip>
-
-#include <glm/mat4x4.hpp>
-#include <glm/ext/matrix_transform.hpp>
+#include "velecs/math/Span.hpp"
 
 namespace velecs::math {
 
 struct Vec3;
+struct Vec3A;
+struct Point3;
+struct Dir3;
 struct Quat;
 
 /// @struct Mat4
-/// @brief A wrapper struct for glm::mat4 to provide consistent interfaces with other math classes.
+/// @brief A column-major 4x4 matrix with a consistent interface with the other math classes.
 ///
-/// This class wraps the glm::mat4 type to provide a consistent interface with other
-/// classes in the velecs math library, while still allowing easy access to the
-/// underlying glm functionality.
+/// The elements are stored in a glm::mat4 or in the library's own matrix type, depending on
+/// the configured backend (see Backend.hpp). Both are indexed internal_mat[col][row].
 struct Mat4 {
 public:
     // Enums
@@ -40,13 +38,13 @@ public:
     static const Mat4 ZERO;         /// @brief A 4x4 zero matrix with all elements set to zero.
     static const Mat4 NEG_IDENTITY; /// @brief A 4x4 negative identity matrix with -1 on the main diagonal.
 
-    glm::mat4 internal_mat; /// @brief The internal GLM matrix.
+    detail::Mat4Storage internal_mat; /// @brief The elements, indexed [col][row].
 
     // Constructors and Destructors
 
-    /// @brief Constructs a Mat4 from a glm::mat4.
-    /// @param mat The glm::mat4 to initialize this Mat4 with.
-    inline Mat4(const glm::mat4& mat)
+    /// @brief Constructs a Mat4 from the backend's matrix, e.g. a glm::mat4 with the GLM backend.
+    /// @param mat The matrix to initialize this Mat4 with.
+    inline Mat4(const detail::Mat4Storage& mat)
         : internal_mat(mat) {}
 
     /// @brief Constructs a Mat4 with the specified value along the main diagonal.
@@ -146,19 +144,21 @@ public:
 
     /// @brief Modifies this matrix by applying a translation and returns a reference to this matrix.
     /// @details Applies the displacement to this matrix, allowing for method chaining.
+    ///          Only the translation column is written.
     /// @param displacement The vector representing how far to move in each direction.
     /// @return A reference to this matrix after applying the translation.
     Mat4& Translate(const Vec3& displacement);
 
     /// @brief Modifies this matrix by applying scaling and returns a reference to this matrix.
     /// @details Applies the scale factors to this matrix, allowing for method chaining.
+    ///          Only the three basis columns are written.
     /// @param scale The scale factors for x, y, and z axes.
     /// @return A reference to this matrix after applying the scaling.
     Mat4& Scale(const Vec3& scale);
 
     /// @brief Modifies this matrix by applying rotation around an axis and returns a reference to this matrix.
     /// @details Rotates this matrix around the specified axis by the given angle in radians, 
-    ///          allowing for method chaining.
+    ///          allowing for method chaining. Only the three basis columns are written.
     /// @param angleRad The rotation angle in radians.
     /// @param axis The axis to rotate around (should be normalized).
     /// @return A reference to this matrix after applying the rotation.
@@ -190,6 +190,7 @@ public:
     /// @brief Modifies this matrix by applying quaternion rotation and returns a reference to this matrix.
     /// @details Applies the rotation represented by the quaternion to this matrix,
     ///          allowing for method chaining. Using quaternions helps avoid gimbal lock issues.
+    ///          Only the three basis columns are written.
     /// @param quat The quaternion representing the rotation to apply.
     /// @return A reference to this matrix after applying the rotation.
     Mat4& Rotate(const Quat& quat);
@@ -199,7 +200,7 @@ public:
     ///          Useful for converting between coordinate spaces or creating view matrices.
     /// @returns A reference to this matrix after computing its inverse.
     /// @note This operation may fail if the matrix is singular (determinant is zero).
-    inline Mat4& Mat4::Inverse()
+    inline Mat4& Inverse()
     {
         return *this = WithInverse();
     }
@@ -208,7 +209,7 @@ public:
     /// @details Swaps rows and columns of this matrix in-place, allowing for method chaining.
     ///          Used in certain graphics operations such as normal transformation.
     /// @returns A reference to this matrix after computing its transpose.
-    inline Mat4& Mat4::Transpose()
+    inline Mat4& Transpose()
     {
         return *this = WithTranspose();
     }
@@ -278,6 +279,56 @@ public:
     /// @returns A new matrix representing the transpose of this matrix.
     Mat4 WithTranspose() const;
 
+    /// @brief Creates the inverse of this matrix assuming it is affine.
+    /// @details Inverts only the upper 3x3 and derives the translation from it, skipping the
+    ///          work a general 4x4 inverse spends on the bottom row.
+    /// @returns The inverse of this matrix, with a bottom row of (0, 0, 0, 1).
+    /// @note The bottom row of this matrix must be (0, 0, 0, 1); the result is unspecified
+    ///       for projective matrices and non-finite for singular ones.
+    Mat4 WithAffineInverse() const;
+
+    /// @brief Creates the inverse of this matrix assuming it is a rotation plus translation.
+    /// @details The inverse of a rigid transform [R | t] is [R^T | -R^T t], so no division or
+    ///          determinant is needed.
+    /// @returns The inverse of this matrix.
+    /// @note Only valid when the upper 3x3 is orthonormal (no scale or shear).
+    Mat4 WithRigidInverse() const;
+
+    /// @brief Multiplies two matrices assuming both are affine.
+    /// @details Computes lhs * rhs using 3x4 arithmetic, skipping the bottom row.
+    /// @param lhs The left-hand side affine matrix.
+    /// @param rhs The right-hand side affine matrix.
+    /// @returns The affine product, with a bottom row of (0, 0, 0, 1).
+    static Mat4 MultiplyAffine(const Mat4& lhs, const Mat4& rhs);
+
+    /// @brief Transforms a point (w=1) by this matrix in SSE registers.
+    /// @details Performs the perspective divide, so projection matrices are handled too;
+    ///          for affine matrices the divide is by 1.
+    /// @param point The point to transform.
+    /// @returns The transformed point.
+    Vec3A TransformPoint(const Vec3A& point) const;
+
+    /// @brief Transforms a direction (w=0) by this matrix in SSE registers, ignoring translation.
+    /// @param direction The direction to transform.
+    /// @returns The transformed direction. Not renormalized.
+    Vec3A TransformDirection(const Vec3A& direction) const;
+
+    /// @brief Inverts many matrices.
+    /// @details Processes four matrices at a time in transposed SIMD lanes (one matrix per
+    ///          lane), falling back to one at a time for the remainder.
+    /// @param matrices The matrices to invert.
+    /// @param[out] inverses Receives one inverse per matrix. May alias matrices exactly.
+    /// @throws std::invalid_argument if inverses is smaller than matrices.
+    /// @note Singular matrices produce non-finite results, as with WithInverse.
+    static void InverseMany(Span<const Mat4> matrices, Span<Mat4> inverses);
+
+    /// @brief Inverts many affine matrices.
+    /// @details The batched counterpart of WithAffineInverse; see InverseMany.
+    /// @param matrices The affine matrices to invert.
+    /// @param[out] inverses Receives one inverse per matrix. May alias matrices exactly.
+    /// @throws std::invalid_argument if inverses is smaller than matrices.
+    static void AffineInverseMany(Span<const Mat4> matrices, Span<Mat4> inverses);
+
     /// @brief Performs component-wise multiplication of two matrices.
     /// @details Multiplies each component of lhs with the corresponding component of rhs.
     /// @param lhs The first matrix.
@@ -325,21 +376,46 @@ public:
     /// @returns A Vec4 containing the translation/position component.
     inline Vec4 Position() const { return Translation(); }
 
-    /// @brief Outputs a Mat4 object to an output stream in a formatted manner.
-    /// @param[in] os The output stream to write to.
-    /// @param[in] mat The Mat4 object to output.
-    /// @return The same output stream, for chaining.
-    friend std::ostream& operator<<(std::ostream& os, const Mat4& mat)
-    {
-        for (int row = 0; row < 4; ++row) {
-            os << "| ";
-            for (int col = 0; col < 4; ++col) {
-                os << std::setw(10) << std::setprecision(4) << mat.internal_mat[col][row] << " ";
-            }
-            os << "|" << std::endl;
-        }
-        return os;
-    }
+    /// @brief Decomposes this matrix into translation, rotation and scale.
+    /// @details Handles arbitrary affine matrices (a non-unit w is divided out). Any shear is
+    ///          removed by Gram-Schmidt orthogonalization of the basis vectors, so the result is
+    ///          the closest TRS with the same axis lengths. Reflections (negative determinant)
+    ///          are reported as a negative x scale, so a mirrored matrix round-trips through
+    ///          FromPosition * Rotation * FromScale.
+    /// @param[out] translation The translation component.
+    /// @param[out] rotation The rotation component as a unit quaternion.
+    /// @param[out] scale The scale factors along the local x, y, and z axes.
+    /// @returns True on success. False if the matrix is projective (all outputs are set to the
+    ///          identity transform) or has a zero-length axis (rotation is set to identity).
+    bool Decompose(Vec3& translation, Quat& rotation, Vec3& scale) const;
+
+    /// @brief Fast-path decomposition for matrices known to be affine TRS compositions.
+    /// @details Skips the projective checks, the w division and the shear removal performed by
+    ///          Decompose, reading scale directly from the basis lengths. Use it for matrices
+    ///          built from FromPosition/FromRotation*/FromScale products (e.g. physics bodies).
+    ///          Results are unspecified for matrices containing shear or perspective.
+    /// @param[out] translation The translation component.
+    /// @param[out] rotation The rotation component as a unit quaternion.
+    /// @param[out] scale The scale factors along the local x, y, and z axes.
+    void DecomposeAffine(Vec3& translation, Quat& rotation, Vec3& scale) const;
+
+    /// @brief Decomposes many matrices into translation, rotation and scale.
+    /// @details Equivalent to calling Decompose (or DecomposeAffine when knownAffine is set)
+    ///          on each element, without per-call overhead.
+    /// @param matrices The matrices to decompose.
+    /// @param[out] translations Receives one translation per matrix.
+    /// @param[out] rotations Receives one rotation per matrix.
+    /// @param[out] scales Receives one scale per matrix.
+    /// @param knownAffine Whether all inputs are shear-free affine TRS matrices.
+    /// @returns The number of matrices for which Decompose returned false.
+    /// @throws std::invalid_argument if the output spans are smaller than the input.
+    static std::size_t DecomposeMany(
+        Span<const Mat4> matrices,
+        Span<Vec3> translations,
+        Span<Quat> rotations,
+        Span<Vec3> scales,
+        const bool knownAffine = false
+    );
 
 protected:
     // Protected Fields
@@ -350,6 +426,12 @@ private:
     // Private Fields
 
     // Private Methods
+
+    /// @brief Right-multiplies the basis columns by a 3x3 matrix in place.
+    /// @details Computes M * R for an affine R with no translation, which only changes
+    ///          columns 0-2 of M.
+    /// @param r The 3x3 matrix stored column-major (r[col][row]).
+    void MultiplyBasis(const float (&r)[3][3]);
 };
 
 /// @brief Overloads the multiplication operator to multiply two matrices.
@@ -369,7 +451,29 @@ inline Mat4 operator*(const Mat4& lhs, const Mat4& rhs)
 /// @returns A new vector representing the transformation of the vector by the matrix.
 inline Vec4 operator*(const Mat4& lhs, const Vec4& rhs)
 {
+#if defined(VELECS_MATH_BACKEND_NATIVE)
+    Vec4 result(0.0f, 0.0f, 0.0f, 0.0f);
+    detail::MultiplyColumn(lhs.internal_mat, rhs.x, rhs.y, rhs.z, rhs.w).Store(&result.x);
+    return result;
+#else
     return Vec4(lhs.internal_mat * static_cast<glm::vec4>(rhs));
+#endif
 }
 
+/// @brief Transforms a point by an affine matrix.
+/// @details Uses the 3x4 part of the matrix only: translation is applied, the bottom row
+///          is skipped and no perspective divide is performed. For projection matrices,
+///          go through Vec4 instead.
+/// @param[in] lhs The affine matrix operand.
+/// @param[in] rhs The point operand.
+/// @returns The transformed point.
+Point3 operator*(const Mat4& lhs, const Point3& rhs);
+
+/// @brief Transforms a direction by an affine matrix, ignoring translation.
+/// @details Uses the upper 3x3 of the matrix only. The result is not renormalized.
+/// @param[in] lhs The affine matrix operand.
+/// @param[in] rhs The direction operand.
+/// @returns The transformed direction.
+Dir3 operator*(const Mat4& lhs, const Dir3& rhs);
+
 } // namespace velecs::math
@@ -0,0 +1,241 @@
+/// @file    Mat4xN.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 21:18:05
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/QuatxN.hpp"
+#include "velecs/math/Vec3xN.hpp"
+#include "velecs/math/Simd.hpp"
+
+#include <cstdint>
+
+namespace velecs::math {
+
+/// @struct Mat4xN
+/// @brief A packet of Mat4s stored as one lane register per element (AoSoA).
+///
+/// Element m[col][row] holds that element of every matrix in the packet, matching
+/// Mat4's column-major indexing. Use the Mat4x4 and Mat4x8 aliases (4 and 8 matrices,
+/// not matrix dimensions) rather than naming the template directly.
+/// @tparam F The lane type, Float4 or Float8.
+template<typename F>
+struct Mat4xN {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr int WIDTH = F::WIDTH; /// @brief The number of matrices in the packet.
+
+    F m[4][4]; /// @brief The matrix elements, indexed [col][row].
+
+    // Constructors and Destructors
+
+    /// @brief Constructs with uninitialized lanes.
+    Mat4xN() = default;
+
+    /// @brief Broadcasts one matrix to every lane.
+    inline explicit Mat4xN(const Mat4& mat)
+    {
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 4; ++row) {
+                m[col][row] = F(mat.internal_mat[col][row]);
+            }
+        }
+    }
+
+    /// @brief Default destructor.
+    ~Mat4xN() = default;
+
+    // Public Methods
+
+    /// @brief Loads WIDTH consecutive matrices from an array of Mat4.
+    /// @param src Pointer to the first of WIDTH matrices.
+    static inline Mat4xN Load(const Mat4* src)
+    {
+        Mat4xN result;
+        float lanes[WIDTH];
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 4; ++row) {
+                for (int i = 0; i < WIDTH; ++i) {
+                    lanes[i] = src[i].internal_mat[col][row];
+                }
+                result.m[col][row] = F::Load(lanes);
+            }
+        }
+        return result;
+    }
+
+    /// @brief Loads WIDTH matrices from arbitrary positions of an array of Mat4.
+    /// @param base The array to gather from.
+    /// @param indices WIDTH indices into base.
+    static inline Mat4xN Gather(const Mat4* base, const std::uint32_t* indices)
+    {
+        Mat4xN result;
+        float lanes[WIDTH];
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 4; ++row) {
+                for (int i = 0; i < WIDTH; ++i) {
+                    lanes[i] = base[indices[i]].internal_mat[col][row];
+                }
+                result.m[col][row] = F::Load(lanes);
+            }
+        }
+        return result;
+    }
+
+    /// @brief Stores the packet to WIDTH consecutive matrices of an array of Mat4.
+    /// @param dst Pointer to the first of WIDTH matrices.
+    inline void Store(Mat4* dst) const
+    {
+        float lanes[WIDTH];
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 4; ++row) {
+                m[col][row].Store(lanes);
+                for (int i = 0; i < WIDTH; ++i) {
+                    dst[i].internal_mat[col][row] = lanes[i];
+                }
+            }
+        }
+    }
+
+    /// @brief Stores the packet to arbitrary positions of an array of Mat4.
+    /// @param base The array to scatter into.
+    /// @param indices WIDTH indices into base. Duplicate indices keep the highest lane.
+    inline void Scatter(Mat4* base, const std::uint32_t* indices) const
+    {
+        float lanes[WIDTH];
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 4; ++row) {
+                m[col][row].Store(lanes);
+                for (int i = 0; i < WIDTH; ++i) {
+                    base[indices[i]].internal_mat[col][row] = lanes[i];
+                }
+            }
+        }
+    }
+
+    /// @brief Extracts one matrix. Intended for tails and debugging, not hot loops.
+    /// @param lane The index of the matrix, in [0, WIDTH).
+    inline Mat4 Get(const int lane) const
+    {
+        Mat4 result(0.0f);
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 4; ++row) {
+                result.internal_mat[col][row] = m[col][row][lane];
+            }
+        }
+        return result;
+    }
+
+    /// @brief Builds rotation matrices from a packet of unit quaternions.
+    static inline Mat4xN FromRotation(const QuatxN<F>& rotation)
+    {
+        return FromTRS(Vec3xN<F>(F(0.0f), F(0.0f), F(0.0f)), rotation, Vec3xN<F>(F(1.0f), F(1.0f), F(1.0f)));
+    }
+
+    /// @brief Builds translation * rotation * scale matrices, lane by lane.
+    /// @param position The translations.
+    /// @param rotation The rotations. Must be normalized.
+    /// @param scale The scale factors.
+    static inline Mat4xN FromTRS(const Vec3xN<F>& position, const QuatxN<F>& rotation, const Vec3xN<F>& scale)
+    {
+        const F one(1.0f);
+        const F two(2.0f);
+        const F zero(0.0f);
+
+        const F& x = rotation.x;
+        const F& y = rotation.y;
+        const F& z = rotation.z;
+        const F& w = rotation.w;
+        const F xx = x * x, yy = y * y, zz = z * z;
+        const F xy = x * y, xz = x * z, yz = y * z;
+        const F wx = w * x, wy = w * y, wz = w * z;
+
+        Mat4xN result;
+        result.m[0][0] = (one - two * (yy + zz)) * scale.x;
+        result.m[0][1] = two * (xy + wz) * scale.x;
+        result.m[0][2] = two * (xz - wy) * scale.x;
+        result.m[0][3] = zero;
+        result.m[1][0] = two * (xy - wz) * scale.y;
+        result.m[1][1] = (one - two * (xx + zz)) * scale.y;
+        result.m[1][2] = two * (yz + wx) * scale.y;
+        result.m[1][3] = zero;
+        result.m[2][0] = two * (xz + wy) * scale.z;
+        result.m[2][1] = two * (yz - wx) * scale.z;
+        result.m[2][2] = (one - two * (xx + yy)) * scale.z;
+        result.m[2][3] = zero;
+        result.m[3][0] = position.x;
+        result.m[3][1] = position.y;
+        result.m[3][2] = position.z;
+        result.m[3][3] = one;
+        return result;
+    }
+
+    /// @brief Transforms a packet of points (w=1), assuming affine matrices.
+    /// @param point The points to transform.
+    /// @returns The transformed points. No perspective divide is performed.
+    inline Vec3xN<F> TransformPoint(const Vec3xN<F>& point) const
+    {
+        return Vec3xN<F>
+        (
+            m[0][0] * point.x + m[1][0] * point.y + m[2][0] * point.z + m[3][0],
+            m[0][1] * point.x + m[1][1] * point.y + m[2][1] * point.z + m[3][1],
+            m[0][2] * point.x + m[1][2] * point.y + m[2][2] * point.z + m[3][2]
+        );
+    }
+
+    /// @brief Transforms a packet of directions (w=0), ignoring translation.
+    /// @param direction The directions to transform.
+    /// @returns The transformed directions. Not renormalized.
+    inline Vec3xN<F> TransformDirection(const Vec3xN<F>& direction) const
+    {
+        return Vec3xN<F>
+        (
+            m[0][0] * direction.x + m[1][0] * direction.y + m[2][0] * direction.z,
+            m[0][1] * direction.x + m[1][1] * direction.y + m[2][1] * direction.z,
+            m[0][2] * direction.x + m[1][2] * direction.y + m[2][2] * direction.z
+        );
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @brief Multiplies two packets of matrices lane by lane.
+/// @returns The products, applying rhs first and then lhs, as with Mat4.
+template<typename F>
+inline Mat4xN<F> operator*(const Mat4xN<F>& lhs, const Mat4xN<F>& rhs)
+{
+    Mat4xN<F> result;
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            result.m[col][row] =
+                lhs.m[0][row] * rhs.m[col][0] +
+                lhs.m[1][row] * rhs.m[col][1] +
+                lhs.m[2][row] * rhs.m[col][2] +
+                lhs.m[3][row] * rhs.m[col][3];
+        }
+    }
+    return result;
+}
+
+using Mat4x4 = Mat4xN<Float4>; /// @brief Four Mat4s in SSE lanes.
+using Mat4x8 = Mat4xN<Float8>; /// @brief Eight Mat4s in AVX lanes.
+
+} // namespace velecs::math
@@ -0,0 +1,147 @@
+/// @file    Numa.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 01:14:26
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// NUMA placement for arrays processed with BatchExecution::Parallel.
+///
+/// The batch worker threads are pinned to NUMA nodes, and every parallel batch call gives
+/// node n the n-th of NodeCount() equal slices of its span. Linux places a page on the
+/// node of the thread that first writes it, so an array whose slices were first written
+/// by the matching node's workers is processed without cross-socket traffic. NumaArray
+/// does that on construction; use one per component array of an SoA layout:
+///
+///     NumaArray<Vec3> positions(count, Vec3::ZERO);
+///     NumaArray<Mat4> world(count, Mat4::IDENTITY);
+///     TransformPointsMany(mat, positions, positions, BatchExecution::Parallel);
+///
+/// Keep arrays that are processed together the same length, since the slices are
+/// proportional to the span size. On single-node machines this is an ordinary array.
+
+#pragma once
+
+#include "velecs/math/Span.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace velecs::math {
+
+/// @brief The number of NUMA nodes the batch worker threads are spread across.
+std::size_t NumaNodeCount();
+
+namespace detail {
+
+/// @brief Calls fn(context, begin, end) over [0, count) on the batch workers, using the
+///        same node partition as every parallel batch operation.
+void ParallelForNuma(const std::size_t count, const std::size_t grain, void (*fn)(void*, std::size_t, std::size_t), void* context);
+
+} // namespace detail
+
+/// @class NumaArray
+/// @brief A fixed-size array whose pages are first touched by the batch workers of the
+///        node that will process them.
+/// @tparam T The element type. Must be trivially destructible, like every math type.
+template<typename T>
+class NumaArray {
+public:
+    static_assert(std::is_trivially_destructible_v<T>, "NumaArray elements must be trivially destructible");
+
+    // Enums
+
+    // Public Fields
+
+    static constexpr std::size_t PAGE_SIZE = 4096; /// @brief The allocation alignment, so slices start on their own pages.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs an empty array.
+    NumaArray() = default;
+
+    /// @brief Allocates count elements and initializes them to value in parallel, so each
+    ///        page is first touched on the node that owns its slice.
+    /// @param count The number of elements.
+    /// @param value The initial value of every element.
+    NumaArray(const std::size_t count, const T& value)
+        : _data(count == 0 ? nullptr : static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(PAGE_SIZE)))),
+          _size(count)
+    {
+        struct Fill {
+            T* data;
+            const T* value;
+        } fill{ _data, &value };
+
+        // One page worth of elements per chunk, so no page is shared between two chunks'
+        // first writes more than necessary.
+        const std::size_t grain = sizeof(T) >= PAGE_SIZE ? 1 : PAGE_SIZE / sizeof(T);
+        detail::ParallelForNuma(count, grain, [](void* context, const std::size_t begin, const std::size_t end) {
+            const Fill& f = *static_cast<const Fill*>(context);
+            for (std::size_t i = begin; i < end; ++i) {
+                new (f.data + i) T(*f.value);
+            }
+        }, &fill);
+    }
+
+    NumaArray(const NumaArray&) = delete;
+    NumaArray& operator=(const NumaArray&) = delete;
+
+    inline NumaArray(NumaArray&& other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)) {}
+
+    inline NumaArray& operator=(NumaArray&& other) noexcept
+    {
+        if (this != &other) {
+            Release();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    /// @brief Frees the array.
+    ~NumaArray() { Release(); }
+
+    // Public Methods
+
+    inline T* data() noexcept { return _data; }
+    inline const T* data() const noexcept { return _data; }
+    inline std::size_t size() const noexcept { return _size; }
+    inline bool empty() const noexcept { return _size == 0; }
+
+    inline T* begin() noexcept { return _data; }
+    inline T* end() noexcept { return _data + _size; }
+    inline const T* begin() const noexcept { return _data; }
+    inline const T* end() const noexcept { return _data + _size; }
+
+    inline T& operator[](const std::size_t index) { return _data[index]; }
+    inline const T& operator[](const std::size_t index) const { return _data[index]; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    T* _data = nullptr;
+    std::size_t _size = 0;
+
+    // Private Methods
+
+    inline void Release()
+    {
+        if (_data != nullptr) {
+            ::operator delete(_data, std::align_val_t(PAGE_SIZE));
+        }
+    }
+};
+
+} // namespace velecs::math
@@ -0,0 +1,111 @@
+/// @file    Packing.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 22:41:27
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Fwd.hpp"
+#include "velecs/math/Span.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::math {
+
+/// @enum BufferLayout
+/// @brief The GLSL memory layout of the buffer being written.
+enum class BufferLayout : std::uint8_t {
+    Std140, /// @brief Uniform buffers: array elements and matrix columns are padded to 16 bytes.
+    Std430, /// @brief Storage buffers: vec3 is aligned to 16 bytes, otherwise tightly packed.
+    Scalar, /// @brief VK_EXT_scalar_block_layout: components aligned to their own size only.
+};
+
+/// @enum MatrixPacking
+/// @brief How each Mat4 is stored.
+enum class MatrixPacking : std::uint8_t {
+    Full,      /// @brief All four columns (GLSL mat4).
+    Affine3x4, /// @brief The top three rows as three vec4s, dropping the constant bottom row.
+               ///        A shader reconstructs the transform as transpose(mat3x4).
+    Normal3x3, /// @brief The inverse transpose of the upper 3x3, for transforming normals (GLSL mat3).
+};
+
+/// @enum StoreHint
+/// @brief Whether writes should bypass the CPU cache.
+enum class StoreHint : std::uint8_t {
+    Auto,      /// @brief Stream large uploads (64 KiB and up) to 16-byte aligned destinations.
+    Cached,    /// @brief Always use regular stores.
+    Streaming, /// @brief Always use non-temporal stores when the destination is 16-byte aligned.
+};
+
+/// @struct PackOptions
+/// @brief Describes the destination format of a PackInto call.
+struct PackOptions {
+    BufferLayout layout = BufferLayout::Std430;    /// @brief The buffer layout rules to follow.
+    MatrixPacking matrix = MatrixPacking::Full;    /// @brief How matrices are stored. Ignored for vectors.
+    bool halfPrecision = false;                    /// @brief Store components as IEEE fp16 (requires 16-bit storage on the device).
+    StoreHint store = StoreHint::Auto;             /// @brief Whether to use non-temporal stores.
+};
+
+/// @struct PackedLayout
+/// @brief The size and placement of one array element in a GPU buffer.
+struct PackedLayout {
+    std::size_t stride;       /// @brief Bytes between consecutive array elements.
+    std::size_t alignment;    /// @brief Required alignment of the array's offset in the buffer.
+    std::size_t columnStride; /// @brief Bytes between matrix columns; equals stride for vectors.
+};
+
+/// @brief Computes the array element layout of T under the given options.
+/// @tparam T One of Vec2, Vec3, Vec4 or Mat4.
+/// @param options The destination format.
+/// @returns The stride, alignment and column stride of one element.
+template<typename T>
+PackedLayout LayoutOf(const PackOptions& options);
+
+template<> PackedLayout LayoutOf<Vec2>(const PackOptions& options);
+template<> PackedLayout LayoutOf<Vec3>(const PackOptions& options);
+template<> PackedLayout LayoutOf<Vec4>(const PackOptions& options);
+template<> PackedLayout LayoutOf<Mat4>(const PackOptions& options);
+
+/// @brief Packs vectors into a mapped GPU buffer as an array.
+/// @details Padding bytes are written as zero. When the source layout already matches the
+///          destination it is copied in bulk; otherwise elements are packed into a small
+///          cache-resident staging block that is then written out sequentially, so
+///          write-combined memory only sees full, contiguous writes.
+/// @param mapped The destination, positioned at the start of the array.
+/// @param src The vectors to pack.
+/// @param options The destination format.
+/// @returns The number of bytes written, src.size() * LayoutOf<T>(options).stride.
+std::size_t PackInto(void* mapped, Span<const Vec2> src, const PackOptions& options = {});
+
+/// @copydoc PackInto(void*, Span<const Vec2>, const PackOptions&)
+std::size_t PackInto(void* mapped, Span<const Vec3> src, const PackOptions& options = {});
+
+/// @copydoc PackInto(void*, Span<const Vec2>, const PackOptions&)
+std::size_t PackInto(void* mapped, Span<const Vec4> src, const PackOptions& options = {});
+
+/// @brief Packs matrices into a mapped GPU buffer as an array, column-major.
+/// @details See the vector overloads. options.matrix selects full, affine 3x4 or
+///          normal-matrix storage.
+/// @param mapped The destination, positioned at the start of the array.
+/// @param src The matrices to pack.
+/// @param options The destination format.
+/// @returns The number of bytes written, src.size() * LayoutOf<Mat4>(options).stride.
+std::size_t PackInto(void* mapped, Span<const Mat4> src, const PackOptions& options = {});
+
+/// @brief Converts a float to IEEE 754 half precision, rounding to nearest even.
+/// @param value The value to convert. Out of range values become infinity.
+/// @returns The half precision bit pattern.
+std::uint16_t FloatToHalf(const float value);
+
+/// @brief Converts an IEEE 754 half precision bit pattern to float. Exact.
+/// @param half The half precision bit pattern.
+/// @returns The value as a float.
+float HalfToFloat(const std::uint16_t half);
+
+} // namespace velecs::math
@@ -0,0 +1,146 @@
+/// @file    Point3.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 21:58:47
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Dir3.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <string>
+
+namespace velecs::math {
+
+/// @struct Point3
+/// @brief A position in 3D space (implicit w=1).
+///
+/// Transforming a Point3 by a Mat4 applies translation. Points can be offset by a Dir3
+/// and subtracted from each other, but not added or scaled. See Dir3.
+struct Point3 {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const Point3 ORIGIN; /// @brief The origin (0, 0, 0).
+
+    float x; /// @brief The x-coordinate of the point.
+    float y; /// @brief The y-coordinate of the point.
+    float z; /// @brief The z-coordinate of the point.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a Point3 with specified x, y, and z coordinates.
+    /// @param[in] x The x-coordinate.
+    /// @param[in] y The y-coordinate.
+    /// @param[in] z The z-coordinate.
+    inline Point3(const float x, const float y, const float z)
+        : x(x), y(y), z(z) {}
+
+    /// @brief Interprets a Vec3 as a position.
+    /// @param[in] vec The vector to wrap.
+    inline explicit Point3(const Vec3 vec)
+        : x(vec.x), y(vec.y), z(vec.z) {}
+
+    /// @brief Default destructor.
+    ~Point3() = default;
+
+    // Public Methods
+
+    /// @brief Returns the untyped vector.
+    inline Vec3 ToVec3() const
+    {
+        return Vec3(x, y, z);
+    }
+
+    /// @brief Converts this point to homogeneous coordinates (w=1).
+    inline Vec4 ToHomogeneous() const
+    {
+        return Vec4(x, y, z, 1.0f);
+    }
+
+    inline bool operator==(const Point3 other) const
+    {
+        return x == other.x && y == other.y && z == other.z;
+    }
+
+    inline bool operator!=(const Point3 other) const
+    {
+        return !(*this == other);
+    }
+
+    inline Point3& operator+=(const Dir3 offset)
+    {
+        x += offset.x;
+        y += offset.y;
+        z += offset.z;
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    inline Point3& operator-=(const Dir3 offset)
+    {
+        x -= offset.x;
+        y -= offset.y;
+        z -= offset.z;
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    /// @brief Computes the distance between two points.
+    inline static float Distance(const Point3 a, const Point3 b)
+    {
+        return Vec3(b.x - a.x, b.y - a.y, b.z - a.z).L2Norm();
+    }
+
+    /// @brief Computes a linear interpolation between two points.
+    /// @param t The interpolation factor. A value of 0 returns a, and a value of 1 returns b.
+    inline static Point3 Lerp(const Point3 a, const Point3 b, const float t)
+    {
+        return Point3(Vec3::Lerp(a.ToVec3(), b.ToVec3(), t));
+    }
+
+    /// @brief Converts the Point3 to a string representation.
+    std::string ToString() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @brief Offsets a point by a direction.
+inline Point3 operator+(const Point3 lhs, const Dir3 rhs)
+{
+    return Point3(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z);
+}
+
+/// @brief Offsets a point by a direction.
+inline Point3 operator+(const Dir3 lhs, const Point3 rhs)
+{
+    return rhs + lhs;
+}
+
+/// @brief Offsets a point by the negation of a direction.
+inline Point3 operator-(const Point3 lhs, const Dir3 rhs)
+{
+    return Point3(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z);
+}
+
+/// @brief Computes the displacement from rhs to lhs.
+inline Dir3 operator-(const Point3 lhs, const Point3 rhs)
+{
+    return Dir3(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z);
+}
+
+} // namespace velecs::math
@@ -0,0 +1,323 @@
+/// @file    Profile.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 02:31:09
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Instrumentation of the library's hot paths. Configure with VELECS_MATH_PROFILE=ON to
+/// enable it; otherwise the zone macros expand to nothing, the API below is not declared,
+/// and the library is compiled exactly as without this header.
+///
+/// Every batch kernel and the expensive scalar functions (inverses, Euler conversions,
+/// projections, slerp, ...) open a zone. A zone adds to per-operation counters of calls,
+/// elements and time, which are always collected, and reports a ProfileEvent to the
+/// installed sink, if any:
+///
+///     RingBufferSink ring(1 << 16);
+///     SetProfileSink(&ring);
+///     ...
+///     SetProfileSink(nullptr);
+///     ChromeTraceSink::Write("frame.json", ring.Events()); // open in chrome://tracing or Perfetto
+///     for (const ProfileStats& op : GetProfileStats()) { ... }
+
+#pragma once
+
+#if defined(VELECS_MATH_PROFILE)
+
+#include "velecs/math/Span.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace velecs::math {
+
+/// @struct ProfileEvent
+/// @brief One execution of a zone.
+struct ProfileEvent {
+public:
+    // Enums
+
+    // Public Fields
+
+    const char* name;         /// @brief The operation, e.g. "Mat4::WithInverse". A string literal.
+    std::uint64_t startNs;    /// @brief Start time in nanoseconds since the first zone of the process.
+    std::uint64_t durationNs; /// @brief Time spent inside the zone, in nanoseconds.
+    std::uint64_t elements;   /// @brief Elements processed; 1 for scalar functions.
+    std::uint32_t thread;     /// @brief A small id of the calling thread, in order of first use.
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @struct ProfileStats
+/// @brief The accumulated counters of one operation.
+struct ProfileStats {
+public:
+    // Enums
+
+    // Public Fields
+
+    const char* name;       /// @brief The operation.
+    std::uint64_t calls;    /// @brief Number of times the zone was entered.
+    std::uint64_t elements; /// @brief Total elements processed.
+    std::uint64_t totalNs;  /// @brief Total time spent, in nanoseconds. Nested zones are counted by both.
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @class ProfileSink
+/// @brief Receives every zone as it closes.
+/// @details OnZone is called concurrently from any thread that runs library code, including
+///          the batch worker threads, so implementations must be thread-safe.
+class ProfileSink {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    virtual ~ProfileSink() = default;
+
+    // Public Methods
+
+    /// @brief Called when a zone closes.
+    virtual void OnZone(const ProfileEvent& event) = 0;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @class RingBufferSink
+/// @brief Keeps the most recent events in a fixed-size buffer, overwriting the oldest.
+class RingBufferSink : public ProfileSink {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Constructs an empty buffer.
+    /// @param capacity The number of events kept.
+    /// @throws std::invalid_argument if capacity is 0.
+    explicit RingBufferSink(const std::size_t capacity);
+
+    // Public Methods
+
+    void OnZone(const ProfileEvent& event) override;
+
+    /// @brief The buffered events, oldest first.
+    std::vector<ProfileEvent> Events() const;
+
+    /// @brief The number of events overwritten since the last Clear().
+    std::uint64_t Dropped() const;
+
+    /// @brief Discards all buffered events.
+    void Clear();
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    mutable std::mutex _mutex;
+    std::size_t _capacity;
+    std::vector<ProfileEvent> _events;
+    std::size_t _next = 0;
+    std::uint64_t _total = 0;
+
+    // Private Methods
+};
+
+/// @class ChromeTraceSink
+/// @brief Collects events and writes them in the Chrome trace event format, which
+///        chrome://tracing and Perfetto open directly.
+class ChromeTraceSink : public ProfileSink {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a sink that writes to a file when flushed or destroyed.
+    /// @param path The JSON file to write.
+    explicit ChromeTraceSink(std::string path);
+
+    /// @brief Writes the collected events, if any are left unwritten.
+    ~ChromeTraceSink() override;
+
+    // Public Methods
+
+    void OnZone(const ProfileEvent& event) override;
+
+    /// @brief Writes every event collected so far to the file, replacing its contents.
+    /// @returns Whether the file was written.
+    bool Flush();
+
+    /// @brief Writes events as a Chrome trace JSON document.
+    static void Write(std::ostream& out, Span<const ProfileEvent> events);
+
+    /// @brief Writes events to a Chrome trace JSON file.
+    /// @returns Whether the file was written.
+    static bool Write(const std::string& path, Span<const ProfileEvent> events);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::string _path;
+    std::mutex _mutex;
+    std::vector<ProfileEvent> _events;
+    bool _dirty = false;
+
+    // Private Methods
+};
+
+/// @brief Installs the sink that receives events, replacing the previous one.
+/// @param sink The sink, or nullptr to only collect counters. It must stay alive until it
+///             has been replaced and every zone running at that point has closed.
+void SetProfileSink(ProfileSink* sink);
+
+/// @brief The counters of every operation that has run, most total time first.
+std::vector<ProfileStats> GetProfileStats();
+
+/// @brief Zeroes every operation's counters.
+void ResetProfileStats();
+
+namespace detail {
+
+/// @brief The counters of one zone site. Registers itself on construction, which happens
+///        once per site as a function-local static.
+struct ProfileCounter {
+public:
+    // Enums
+
+    // Public Fields
+
+    const char* const name;
+    std::atomic<std::uint64_t> calls{ 0 };
+    std::atomic<std::uint64_t> elements{ 0 };
+    std::atomic<std::uint64_t> totalNs{ 0 };
+    ProfileCounter* next = nullptr; /// @brief The previously registered counter.
+
+    // Constructors and Destructors
+
+    explicit ProfileCounter(const char* name);
+
+    // Public Methods
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @brief Times the enclosing scope and reports it to its counter and the sink.
+class ProfileZone {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    ProfileZone(ProfileCounter& counter, const std::uint64_t elements);
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+    ~ProfileZone();
+
+    // Public Methods
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    ProfileCounter& _counter;
+    std::uint64_t _elements;
+    std::uint64_t _start;
+
+    // Private Methods
+};
+
+} // namespace detail
+
+} // namespace velecs::math
+
+#define VELECS_MATH_PROFILE_CONCAT_IMPL(a, b) a##b
+#define VELECS_MATH_PROFILE_CONCAT(a, b) VELECS_MATH_PROFILE_CONCAT_IMPL(a, b)
+
+/// @brief Opens a zone covering the rest of the enclosing scope.
+/// @param name A string literal naming the operation.
+/// @param elements The number of elements the scope processes.
+#define VELECS_MATH_ZONE_N(name, elements)                                                                    \
+    static ::velecs::math::detail::ProfileCounter VELECS_MATH_PROFILE_CONCAT(velecsProfileCounter, __LINE__){ name }; \
+    const ::velecs::math::detail::ProfileZone VELECS_MATH_PROFILE_CONCAT(velecsProfileZone, __LINE__)(           \
+        VELECS_MATH_PROFILE_CONCAT(velecsProfileCounter, __LINE__), static_cast<std::uint64_t>(elements))
+
+#else
+
+#define VELECS_MATH_ZONE_N(name, elements) ((void)0)
+
+#endif
+
+/// @brief Opens a zone around a scalar operation, counting one element.
+#define VELECS_MATH_ZONE(name) VELECS_MATH_ZONE_N(name, 1)
@@ -0,0 +1,122 @@
+/// @file    Quadtree.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 08:34:40
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Rect.hpp"
+#include "velecs/math/Span.hpp"
+#include "velecs/math/Vec2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::math {
+
+/// @struct Quadtree
+/// @brief A static region quadtree over rectangles, for hit-testing and 2D overlap queries.
+///
+/// The root covers the bounds of all items and every node splits its cell into four equal
+/// quadrants. An item is stored in the deepest node whose cell contains it, so items that
+/// straddle a split stay higher up. Nodes with at most LEAF_SIZE items, or at maxDepth,
+/// are not split.
+///
+/// The four children of a node are stored together and tested against a query at once with
+/// SIMD, and each node's items are stored as structure-of-arrays bounds padded to a multiple
+/// of four, so they are tested four at a time as well. Rebuild the tree when items change;
+/// for many moving items, UniformGrid2D is cheaper to rebuild.
+struct Quadtree {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFFu; /// @brief Returned by HitTest when no item is hit.
+    static constexpr std::size_t LEAF_SIZE = 8;           /// @brief The most items a node holds before it is split.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs an empty tree; every query finds nothing.
+    Quadtree() = default;
+
+    /// @brief Builds a tree over a set of rectangles.
+    /// @param items The rectangles. Ids in query results are indices into this span. Empty
+    ///              rectangles are kept but never found.
+    /// @param maxDepth The deepest level the tree splits to.
+    /// @throws std::invalid_argument if there are 2^32 - 1 or more items.
+    explicit Quadtree(Span<const Rect> items, const std::uint32_t maxDepth = 8);
+
+    /// @brief Default destructor.
+    ~Quadtree() = default;
+
+    // Public Methods
+
+    /// @brief The number of items in the tree.
+    inline std::size_t Size() const { return _size; }
+
+    /// @brief The number of nodes, including the root.
+    inline std::size_t NodeCount() const { return _nodes.size(); }
+
+    /// @brief Finds the items that contain a point, boundary included.
+    /// @param[out] out Cleared, then receives the ids found in no particular order.
+    void QueryPoint(const Vec2 point, std::vector<std::uint32_t>& out) const;
+
+    /// @brief Finds the items that overlap or touch a rectangle.
+    /// @param[out] out Cleared, then receives the ids found in no particular order.
+    void QueryRect(const Rect& rect, std::vector<std::uint32_t>& out) const;
+
+    /// @brief Finds the items that overlap or touch a circle.
+    /// @param[out] out Cleared, then receives the ids found in no particular order.
+    void QueryRadius(const Vec2 center, const float radius, std::vector<std::uint32_t>& out) const;
+
+    /// @brief Finds the topmost item under a point: the one with the highest id, as items
+    ///        later in draw order are drawn on top.
+    /// @returns The id of the item, or INVALID if no item contains the point.
+    std::uint32_t HitTest(const Vec2 point) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    /// @struct Node
+    /// @brief One cell and the items stored in it.
+    struct Node {
+        float center[2];          /// @brief The center of the cell.
+        float half[2];            /// @brief The half-size of the cell.
+        std::uint32_t firstChild; /// @brief The first of four consecutive children, or INVALID for a leaf.
+        std::uint32_t first;      /// @brief The first slot of the node's items.
+        std::uint32_t slots;      /// @brief The number of item slots, a multiple of 4; padding is never found.
+    };
+
+    // Private Fields
+
+    std::size_t _size{0};
+    std::vector<Node> _nodes;       /// @brief Depth-first, with each node's children adjacent.
+    std::vector<float> _minX;       /// @brief The minimum x of each item slot.
+    std::vector<float> _minY;       /// @brief The minimum y of each item slot.
+    std::vector<float> _maxX;       /// @brief The maximum x of each item slot.
+    std::vector<float> _maxY;       /// @brief The maximum y of each item slot.
+    std::vector<std::uint32_t> _ids; /// @brief The id of each item slot, or INVALID for padding.
+
+    // Private Methods
+
+    /// @brief Stores items in a node, moving those that fit a quadrant into new children.
+    void Build(const std::uint32_t node, Span<const Rect> items, std::vector<std::uint32_t>& ids,
+        const std::uint32_t depth, const std::uint32_t maxDepth);
+
+    /// @brief Calls visit(id) for every item that itemTest accepts, descending only into
+    ///        children whose cells nodeTest accepts.
+    template<typename NodeTest, typename ItemTest, typename Visit>
+    void Query(NodeTest&& nodeTest, ItemTest&& itemTest, Visit&& visit) const;
+};
+
+} // namespace velecs::math
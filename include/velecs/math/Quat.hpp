@@ -10,10 +10,9 @@
 
 #pragma once
 
+#include "velecs/math/Backend.hpp"
 #include "velecs/math/Mat4.hpp"
 
-#include <glm/ext/quaternion_float.hpp>
-
 namespace velecs::math {
 
 struct Vec3;
@@ -22,7 +21,8 @@ struct Vec3;
 /// @brief A quaternion class for representing 3D rotations.
 ///
 /// Quaternions efficiently represent 3D rotations while avoiding gimbal lock.
-/// This class wraps GLM's quaternion with a consistent interface using the
+/// This class stores a glm::quat or the library's own quaternion, depending on the
+/// configured backend (see Backend.hpp), with a consistent interface using the
 /// game engine convention of (x,y,z,w) component ordering.
 struct Quat {
 public:
@@ -32,13 +32,13 @@ public:
 
     static const Quat IDENTITY; /// @brief Identity quaternion that represents no rotation (0, 0, 0, 1).
 
-    glm::quat internal_quat; /// @brief The internal GLM quaternion.
+    detail::QuatStorage internal_quat; /// @brief The components, read as .x, .y, .z and .w.
 
     // Constructors and Destructors
 
-    /// @brief Construct from glm::quat
-    /// @param quat The GLM quaternion to copy
-    inline Quat(const glm::quat& quat)
+    /// @brief Construct from the backend's quaternion, e.g. a glm::quat with the GLM backend.
+    /// @param quat The quaternion to copy
+    inline Quat(const detail::QuatStorage& quat)
         : internal_quat(quat) {}
 
     /// @brief Construct a quaternion from components
@@ -81,6 +81,31 @@ public:
     /// @return A quaternion representing the specified rotation
     static Quat FromEulerAnglesDeg(const Vec3& angles);
 
+    /// @brief Create a quaternion from an orthonormal basis
+    /// @details The basis vectors are the columns of a pure rotation matrix. Uses Shepperd's
+    ///          method, branching on the largest diagonal term for numerical stability.
+    /// @param xAxis The rotated x-axis (first column of the rotation matrix)
+    /// @param yAxis The rotated y-axis (second column of the rotation matrix)
+    /// @param zAxis The rotated z-axis (third column of the rotation matrix)
+    /// @return A unit quaternion representing the rotation of the basis
+    /// @note The basis must be orthonormal and right-handed; use Mat4::Decompose for
+    ///       matrices that contain scale, shear or reflection.
+    static Quat FromBasis(const Vec3& xAxis, const Vec3& yAxis, const Vec3& zAxis);
+
+    /// @brief Create a quaternion from the upper 3x3 of a pure rotation matrix
+    /// @param mat The rotation matrix; translation is ignored
+    /// @return A unit quaternion representing the same rotation
+    static Quat FromRotationMatrix(const Mat4& mat);
+
+    /// @brief Spherical linear interpolation between two rotations
+    /// @details Takes the shortest arc. Nearly identical rotations fall back to a normalized
+    ///          lerp, where slerp's sin(theta) denominator loses precision.
+    /// @param a The rotation at t = 0 (should be normalized)
+    /// @param b The rotation at t = 1 (should be normalized)
+    /// @param t The interpolation factor
+    /// @return A unit quaternion between a and b at constant angular velocity in t
+    static Quat Slerp(const Quat& a, const Quat& b, const float t);
+
     /// @brief Convert this quaternion to Euler angles
     /// @return A Vec3 containing the Euler angles in radians (x, y, z)
     Vec3 ToEulerAnglesRad() const;
@@ -93,6 +118,14 @@ public:
     /// @return A Mat4 representing the rotation described by this quaternion
     Mat4 ToMatrix() const;
 
+    /// @brief Converts many quaternions to rotation matrices
+    /// @details Processes four quaternions at a time in transposed SIMD lanes, falling back
+    ///          to one at a time for the remainder.
+    /// @param quats The quaternions to convert (should be normalized)
+    /// @param[out] matrices Receives one rotation matrix per quaternion
+    /// @throws std::invalid_argument if matrices is smaller than quats
+    static void ToMatrixMany(Span<const Quat> quats, Span<Mat4> matrices);
+
 protected:
     // Protected Fields
 
@@ -0,0 +1,212 @@
+/// @file    QuatxN.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 21:10:42
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Quat.hpp"
+#include "velecs/math/Vec3xN.hpp"
+#include "velecs/math/Simd.hpp"
+
+#include <cstdint>
+
+namespace velecs::math {
+
+/// @struct QuatxN
+/// @brief A packet of quaternions stored as one lane register per component (AoSoA).
+///
+/// The wide counterpart of Quat; see Vec3xN for the layout. Use the Quatx4 and Quatx8
+/// aliases rather than naming the template directly.
+/// @tparam F The lane type, Float4 or Float8.
+template<typename F>
+struct QuatxN {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr int WIDTH = F::WIDTH; /// @brief The number of quaternions in the packet.
+
+    F x; /// @brief The x-components of the quaternions.
+    F y; /// @brief The y-components of the quaternions.
+    F z; /// @brief The z-components of the quaternions.
+    F w; /// @brief The w-components of the quaternions.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs with uninitialized lanes.
+    QuatxN() = default;
+
+    /// @brief Constructs from per-component lanes.
+    inline QuatxN(const F x, const F y, const F z, const F w)
+        : x(x), y(y), z(z), w(w) {}
+
+    /// @brief Broadcasts one quaternion to every lane.
+    inline explicit QuatxN(const Quat& quat)
+        : x(quat.internal_quat.x), y(quat.internal_quat.y), z(quat.internal_quat.z), w(quat.internal_quat.w) {}
+
+    /// @brief Default destructor.
+    ~QuatxN() = default;
+
+    // Public Methods
+
+    /// @brief Loads WIDTH consecutive quaternions from an array of Quat.
+    /// @param src Pointer to the first of WIDTH quaternions.
+    static inline QuatxN Load(const Quat* src)
+    {
+        float xs[WIDTH], ys[WIDTH], zs[WIDTH], ws[WIDTH];
+        for (int i = 0; i < WIDTH; ++i) {
+            xs[i] = src[i].internal_quat.x;
+            ys[i] = src[i].internal_quat.y;
+            zs[i] = src[i].internal_quat.z;
+            ws[i] = src[i].internal_quat.w;
+        }
+        return QuatxN(F::Load(xs), F::Load(ys), F::Load(zs), F::Load(ws));
+    }
+
+    /// @brief Loads WIDTH quaternions from arbitrary positions of an array of Quat.
+    /// @param base The array to gather from.
+    /// @param indices WIDTH indices into base.
+    static inline QuatxN Gather(const Quat* base, const std::uint32_t* indices)
+    {
+        float xs[WIDTH], ys[WIDTH], zs[WIDTH], ws[WIDTH];
+        for (int i = 0; i < WIDTH; ++i) {
+            const Quat& q = base[indices[i]];
+            xs[i] = q.internal_quat.x;
+            ys[i] = q.internal_quat.y;
+            zs[i] = q.internal_quat.z;
+            ws[i] = q.internal_quat.w;
+        }
+        return QuatxN(F::Load(xs), F::Load(ys), F::Load(zs), F::Load(ws));
+    }
+
+    /// @brief Stores the packet to WIDTH consecutive quaternions of an array of Quat.
+    /// @param dst Pointer to the first of WIDTH quaternions.
+    inline void Store(Quat* dst) const
+    {
+        float xs[WIDTH], ys[WIDTH], zs[WIDTH], ws[WIDTH];
+        x.Store(xs);
+        y.Store(ys);
+        z.Store(zs);
+        w.Store(ws);
+        for (int i = 0; i < WIDTH; ++i) {
+            dst[i] = Quat(xs[i], ys[i], zs[i], ws[i]);
+        }
+    }
+
+    /// @brief Stores the packet to arbitrary positions of an array of Quat.
+    /// @param base The array to scatter into.
+    /// @param indices WIDTH indices into base. Duplicate indices keep the highest lane.
+    inline void Scatter(Quat* base, const std::uint32_t* indices) const
+    {
+        float xs[WIDTH], ys[WIDTH], zs[WIDTH], ws[WIDTH];
+        x.Store(xs);
+        y.Store(ys);
+        z.Store(zs);
+        w.Store(ws);
+        for (int i = 0; i < WIDTH; ++i) {
+            base[indices[i]] = Quat(xs[i], ys[i], zs[i], ws[i]);
+        }
+    }
+
+    /// @brief Extracts one quaternion. Intended for tails and debugging, not hot loops.
+    /// @param lane The index of the quaternion, in [0, WIDTH).
+    inline Quat Get(const int lane) const
+    {
+        return Quat(x[lane], y[lane], z[lane], w[lane]);
+    }
+
+    /// @brief Returns the conjugate of each quaternion, the inverse of a unit quaternion.
+    inline QuatxN Conjugate() const
+    {
+        return QuatxN(-x, -y, -z, w);
+    }
+
+    /// @brief Normalizes each quaternion, making its magnitude equal to 1.
+    /// @note Lanes with a magnitude of 0 become the identity quaternion.
+    inline QuatxN Normalize() const
+    {
+        const F magnitude = F::Sqrt(Dot(*this, *this));
+        const F zero(0.0f);
+        const F isZero = F::Equal(magnitude, zero);
+        const F inv = F::Select(isZero, zero, F(1.0f) / magnitude);
+        return QuatxN(x * inv, y * inv, z * inv, F::Select(isZero, F(1.0f), w * inv));
+    }
+
+    /// @brief Rotates a packet of vectors, lane by lane.
+    /// @param vec The vectors to rotate.
+    /// @returns The rotated vectors. The quaternions must be normalized.
+    inline Vec3xN<F> Rotate(const Vec3xN<F>& vec) const
+    {
+        // v' = v + w * t + q x t, where t = 2 * (q x v)
+        const Vec3xN<F> q(x, y, z);
+        const Vec3xN<F> t = Vec3xN<F>::Cross(q, vec) * F(2.0f);
+        return vec + t * w + Vec3xN<F>::Cross(q, t);
+    }
+
+    /// @brief Computes the per-lane dot product of two packets.
+    static inline F Dot(const QuatxN& a, const QuatxN& b)
+    {
+        return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    }
+
+    /// @brief Computes a per-lane normalized linear interpolation (nlerp) along the shortest arc.
+    /// @param t The interpolation factor per lane; 0 returns a, 1 returns b.
+    /// @details Cheaper than slerp and accurate enough for the small steps between frames or
+    ///          animation keys.
+    static inline QuatxN Lerp(const QuatxN& a, const QuatxN& b, const F t)
+    {
+        const F flip = F::Less(Dot(a, b), F(0.0f));
+        const F sign = F::Select(flip, F(-1.0f), F(1.0f));
+        const F tb = t * sign;
+        const F ta = F(1.0f) - t;
+        return QuatxN
+        (
+            a.x * ta + b.x * tb,
+            a.y * ta + b.y * tb,
+            a.z * ta + b.z * tb,
+            a.w * ta + b.w * tb
+        ).Normalize();
+    }
+
+    /// @brief Picks quaternions from a where mask is set, otherwise from b.
+    static inline QuatxN Select(const F mask, const QuatxN& a, const QuatxN& b)
+    {
+        return QuatxN(F::Select(mask, a.x, b.x), F::Select(mask, a.y, b.y), F::Select(mask, a.z, b.z), F::Select(mask, a.w, b.w));
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @brief Multiplies two packets of quaternions lane by lane (Hamilton product).
+/// @returns The combined rotations: rhs is applied first, then lhs, as with Quat.
+template<typename F>
+inline QuatxN<F> operator*(const QuatxN<F>& lhs, const QuatxN<F>& rhs)
+{
+    return QuatxN<F>
+    (
+        lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y,
+        lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x,
+        lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w,
+        lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z
+    );
+}
+
+using Quatx4 = QuatxN<Float4>; /// @brief Four quaternions in SSE lanes.
+using Quatx8 = QuatxN<Float8>; /// @brief Eight quaternions in AVX lanes.
+
+} // namespace velecs::math
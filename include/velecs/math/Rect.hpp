@@ -0,0 +1,157 @@
+/// @file    Rect.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 08:21:57
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Vec2.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace velecs::math {
+
+/// @struct Rect
+/// @brief An axis-aligned rectangle given by its minimum and maximum corners.
+///
+/// The corners are per-axis minima and maxima, so the type is independent of the direction
+/// of y: in the screen space of Vec2::UP = (0, -1), min is the top-left corner. A rectangle
+/// whose min exceeds its max on either axis is empty. EMPTY is the identity of Merge and
+/// Expand, as with Aabb.
+struct Rect {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const Rect EMPTY; /// @brief An empty rectangle (min = +infinity, max = -infinity).
+
+    Vec2 min; /// @brief The minimum corner.
+    Vec2 max; /// @brief The maximum corner.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a rectangle from its corners.
+    /// @param[in] min The minimum corner.
+    /// @param[in] max The maximum corner.
+    inline Rect(const Vec2 min, const Vec2 max)
+        : min(min), max(max) {}
+
+    /// @brief Default destructor.
+    ~Rect() = default;
+
+    // Public Methods
+
+    /// @brief Constructs the rectangle spanning center +/- extents.
+    inline static Rect FromCenterExtents(const Vec2 center, const Vec2 extents)
+    {
+        return Rect(center - extents, center + extents);
+    }
+
+    /// @brief Constructs the rectangle with a given minimum corner and size, as UI layouts give them.
+    inline static Rect FromPositionSize(const Vec2 position, const Vec2 size)
+    {
+        return Rect(position, position + size);
+    }
+
+    /// @brief Whether the rectangle contains no points.
+    inline bool IsEmpty() const
+    {
+        return min.x > max.x || min.y > max.y;
+    }
+
+    /// @brief The center of the rectangle.
+    inline Vec2 Center() const
+    {
+        return (min + max) * 0.5f;
+    }
+
+    /// @brief The half-size of the rectangle along each axis.
+    inline Vec2 Extents() const
+    {
+        return (max - min) * 0.5f;
+    }
+
+    /// @brief The full size of the rectangle along each axis.
+    inline Vec2 Size() const
+    {
+        return max - min;
+    }
+
+    /// @brief Whether a point lies inside or on the boundary of the rectangle.
+    inline bool Contains(const Vec2 point) const
+    {
+        return point.x >= min.x && point.x <= max.x
+            && point.y >= min.y && point.y <= max.y;
+    }
+
+    /// @brief Whether another rectangle lies entirely inside this one.
+    inline bool Contains(const Rect& other) const
+    {
+        return other.min.x >= min.x && other.max.x <= max.x
+            && other.min.y >= min.y && other.max.y <= max.y;
+    }
+
+    /// @brief Whether two rectangles overlap or touch.
+    inline bool Intersects(const Rect& other) const
+    {
+        return min.x <= other.max.x && max.x >= other.min.x
+            && min.y <= other.max.y && max.y >= other.min.y;
+    }
+
+    /// @brief Whether a circle overlaps or touches the rectangle.
+    inline bool IntersectsCircle(const Vec2 center, const float radius) const
+    {
+        const float dx = std::max({ min.x - center.x, 0.0f, center.x - max.x });
+        const float dy = std::max({ min.y - center.y, 0.0f, center.y - max.y });
+        return dx * dx + dy * dy <= radius * radius;
+    }
+
+    /// @brief Grows the rectangle to contain a point.
+    inline Rect& Expand(const Vec2 point)
+    {
+        min = Vec2(std::min(min.x, point.x), std::min(min.y, point.y));
+        max = Vec2(std::max(max.x, point.x), std::max(max.y, point.y));
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    /// @brief Computes the smallest rectangle containing both rectangles.
+    inline static Rect Merge(const Rect& a, const Rect& b)
+    {
+        return Rect(
+            Vec2(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y)),
+            Vec2(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y))
+        );
+    }
+
+    inline bool operator==(const Rect& other) const
+    {
+        return min == other.min && max == other.max;
+    }
+
+    inline bool operator!=(const Rect& other) const
+    {
+        return !(*this == other);
+    }
+
+    /// @brief Converts the Rect to a string representation.
+    std::string ToString() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::math
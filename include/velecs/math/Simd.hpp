@@ -0,0 +1,488 @@
+/// @file    Simd.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 20:10:24
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// SSE2 is part of the x86-64 baseline; define VELECS_MATH_NO_SIMD to force the scalar fallback.
+#if !defined(VELECS_MATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define VELECS_MATH_SSE 1
+    #include <emmintrin.h>
+#endif
+
+// AVX is opt-in through the compiler's target flags (-mavx, /arch:AVX); without it Float8 is two Float4.
+// The VELECS_MATH_AVX CMake option sets those flags on the library and everything linking it.
+#if defined(VELECS_MATH_SSE) && defined(__AVX__)
+    #define VELECS_MATH_AVX 1
+    #include <immintrin.h>
+#endif
+
+// Float8 changes layout with the flags above, so each variant lives in its own inline namespace.
+// Translation units built with and without AVX then name different types (Vec3xN<Float8> and the
+// other lane templates mangle differently) rather than silently sharing one name with two layouts.
+#if defined(VELECS_MATH_AVX)
+    #define VELECS_MATH_FLOAT8_ABI avx
+#else
+    #define VELECS_MATH_FLOAT8_ABI emulated
+#endif
+
+namespace velecs::math {
+
+/// @struct Float4
+/// @brief Four float lanes processed together, backed by an SSE register when available.
+///
+/// Batch kernels are written once against this type in "transposed" form, where each
+/// lane holds the same component of a different object, and run four objects per
+/// instruction. The same kernel source instantiated with plain float handles the tail.
+/// Comparison results are lane masks (all bits set or clear) meant for Select.
+struct Float4 {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr int WIDTH = 4; /// @brief The number of lanes.
+
+#if defined(VELECS_MATH_SSE)
+    __m128 v; /// @brief The lanes.
+#else
+    float v[4]; /// @brief The lanes.
+#endif
+
+    // Constructors and Destructors
+
+    /// @brief Constructs with uninitialized lanes.
+    Float4() = default;
+
+#if defined(VELECS_MATH_SSE)
+    /// @brief Constructs from a raw SSE register.
+    inline Float4(const __m128 v) : v(v) {}
+
+    /// @brief Broadcasts a scalar to all lanes.
+    inline Float4(const float s) : v(_mm_set1_ps(s)) {}
+
+    /// @brief Constructs from four lane values.
+    inline Float4(const float a, const float b, const float c, const float d) : v(_mm_setr_ps(a, b, c, d)) {}
+#else
+    /// @brief Broadcasts a scalar to all lanes.
+    inline Float4(const float s) : v{ s, s, s, s } {}
+
+    /// @brief Constructs from four lane values.
+    inline Float4(const float a, const float b, const float c, const float d) : v{ a, b, c, d } {}
+#endif
+
+    /// @brief Default destructor.
+    ~Float4() = default;
+
+    // Public Methods
+
+    /// @brief Loads four consecutive floats; no alignment requirement.
+    static inline Float4 Load(const float* src)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_loadu_ps(src));
+#else
+        return Float4(src[0], src[1], src[2], src[3]);
+#endif
+    }
+
+    /// @brief Stores the lanes to four consecutive floats; no alignment requirement.
+    inline void Store(float* dst) const
+    {
+#if defined(VELECS_MATH_SSE)
+        _mm_storeu_ps(dst, v);
+#else
+        std::memcpy(dst, v, sizeof(v));
+#endif
+    }
+
+    /// @brief Reads a single lane. Intended for tails and debugging, not hot loops.
+    inline float operator[](const int lane) const
+    {
+        float lanes[4];
+        Store(lanes);
+        return lanes[lane];
+    }
+
+    /// @brief Loads four consecutive floats from a 16-byte aligned address.
+    static inline Float4 LoadAligned(const float* src)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_load_ps(src));
+#else
+        return Load(src);
+#endif
+    }
+
+    /// @brief Stores the lanes to four consecutive floats at a 16-byte aligned address.
+    inline void StoreAligned(float* dst) const
+    {
+#if defined(VELECS_MATH_SSE)
+        _mm_store_ps(dst, v);
+#else
+        Store(dst);
+#endif
+    }
+
+    /// @brief Stores the lanes to a 16-byte aligned address, bypassing the cache.
+    /// @details For large writes to memory that will not be read back soon, such as
+    ///          write-combined GPU mappings. Call StreamFence once the writes are done.
+    inline void StoreStream(float* dst) const
+    {
+#if defined(VELECS_MATH_SSE)
+        _mm_stream_ps(dst, v);
+#else
+        Store(dst);
+#endif
+    }
+
+    /// @brief Orders preceding StoreStream writes before any later stores.
+    static inline void StreamFence()
+    {
+#if defined(VELECS_MATH_SSE)
+        _mm_sfence();
+#endif
+    }
+
+    /// @brief Reads lane 0; a register move rather than a store with SSE.
+    inline float First() const
+    {
+#if defined(VELECS_MATH_SSE)
+        return _mm_cvtss_f32(v);
+#else
+        return v[0];
+#endif
+    }
+
+    /// @brief Rearranges lanes: lane i of the result is lane Ii of a.
+    template<int I0, int I1, int I2, int I3>
+    static inline Float4 Shuffle(const Float4 a)
+    {
+        static_assert(I0 >= 0 && I0 < 4 && I1 >= 0 && I1 < 4 && I2 >= 0 && I2 < 4 && I3 >= 0 && I3 < 4, "Shuffle lane out of range");
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(I3, I2, I1, I0)));
+#else
+        return Float4(a.v[I0], a.v[I1], a.v[I2], a.v[I3]);
+#endif
+    }
+
+    static inline Float4 Min(const Float4 a, const Float4 b)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_min_ps(a.v, b.v));
+#else
+        return Float4(std::fmin(a.v[0], b.v[0]), std::fmin(a.v[1], b.v[1]), std::fmin(a.v[2], b.v[2]), std::fmin(a.v[3], b.v[3]));
+#endif
+    }
+
+    static inline Float4 Max(const Float4 a, const Float4 b)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_max_ps(a.v, b.v));
+#else
+        return Float4(std::fmax(a.v[0], b.v[0]), std::fmax(a.v[1], b.v[1]), std::fmax(a.v[2], b.v[2]), std::fmax(a.v[3], b.v[3]));
+#endif
+    }
+
+    static inline Float4 Sqrt(const Float4 a)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_sqrt_ps(a.v));
+#else
+        return Float4(std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3]));
+#endif
+    }
+
+    static inline Float4 Abs(const Float4 a)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_andnot_ps(_mm_set1_ps(-0.0f), a.v));
+#else
+        return Float4(std::fabs(a.v[0]), std::fabs(a.v[1]), std::fabs(a.v[2]), std::fabs(a.v[3]));
+#endif
+    }
+
+    /// @brief Lane mask of a < b.
+    static inline Float4 Less(const Float4 a, const Float4 b)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_cmplt_ps(a.v, b.v));
+#else
+        return FromMask(a.v[0] < b.v[0], a.v[1] < b.v[1], a.v[2] < b.v[2], a.v[3] < b.v[3]);
+#endif
+    }
+
+    /// @brief Lane mask of a <= b.
+    static inline Float4 LessEqual(const Float4 a, const Float4 b)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_cmple_ps(a.v, b.v));
+#else
+        return FromMask(a.v[0] <= b.v[0], a.v[1] <= b.v[1], a.v[2] <= b.v[2], a.v[3] <= b.v[3]);
+#endif
+    }
+
+    /// @brief Lane mask of a == b.
+    static inline Float4 Equal(const Float4 a, const Float4 b)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_cmpeq_ps(a.v, b.v));
+#else
+        return FromMask(a.v[0] == b.v[0], a.v[1] == b.v[1], a.v[2] == b.v[2], a.v[3] == b.v[3]);
+#endif
+    }
+
+    /// @brief Picks lanes from a where mask is set, otherwise from b.
+    static inline Float4 Select(const Float4 mask, const Float4 a, const Float4 b)
+    {
+#if defined(VELECS_MATH_SSE)
+        return Float4(_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)));
+#else
+        Float4 result;
+        for (int i = 0; i < 4; ++i) {
+            result.v[i] = IsSet(mask.v[i]) ? a.v[i] : b.v[i];
+        }
+        return result;
+#endif
+    }
+
+    /// @brief Gets a bit per lane, set where the mask lane is set.
+    static inline int MoveMask(const Float4 mask)
+    {
+#if defined(VELECS_MATH_SSE)
+        return _mm_movemask_ps(mask.v);
+#else
+        return (IsSet(mask.v[0]) ? 1 : 0) | (IsSet(mask.v[1]) ? 2 : 0) | (IsSet(mask.v[2]) ? 4 : 0) | (IsSet(mask.v[3]) ? 8 : 0);
+#endif
+    }
+
+    /// @brief Transposes four rows of four lanes in place.
+    static inline void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3)
+    {
+#if defined(VELECS_MATH_SSE)
+        _MM_TRANSPOSE4_PS(r0.v, r1.v, r2.v, r3.v);
+#else
+        for (int i = 0; i < 4; ++i) {
+            for (int j = i + 1; j < 4; ++j) {
+                Float4* rows[4] = { &r0, &r1, &r2, &r3 };
+                const float tmp = rows[i]->v[j];
+                rows[i]->v[j] = rows[j]->v[i];
+                rows[j]->v[i] = tmp;
+            }
+        }
+#endif
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+
+#if !defined(VELECS_MATH_SSE)
+    static inline bool IsSet(const float lane)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &lane, sizeof(bits));
+        return bits != 0;
+    }
+
+    static inline Float4 FromMask(const bool a, const bool b, const bool c, const bool d)
+    {
+        const std::uint32_t bits[4] = { a ? ~0u : 0u, b ? ~0u : 0u, c ? ~0u : 0u, d ? ~0u : 0u };
+        Float4 result;
+        std::memcpy(result.v, bits, sizeof(bits));
+        return result;
+    }
+#endif
+};
+
+#if defined(VELECS_MATH_SSE)
+inline Float4 operator+(const Float4 a, const Float4 b) { return Float4(_mm_add_ps(a.v, b.v)); }
+inline Float4 operator-(const Float4 a, const Float4 b) { return Float4(_mm_sub_ps(a.v, b.v)); }
+inline Float4 operator*(const Float4 a, const Float4 b) { return Float4(_mm_mul_ps(a.v, b.v)); }
+inline Float4 operator/(const Float4 a, const Float4 b) { return Float4(_mm_div_ps(a.v, b.v)); }
+inline Float4 operator-(const Float4 a) { return Float4(_mm_xor_ps(a.v, _mm_set1_ps(-0.0f))); }
+inline Float4 operator&(const Float4 a, const Float4 b) { return Float4(_mm_and_ps(a.v, b.v)); }
+inline Float4 operator|(const Float4 a, const Float4 b) { return Float4(_mm_or_ps(a.v, b.v)); }
+#else
+inline Float4 operator+(const Float4 a, const Float4 b) { return Float4(a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]); }
+inline Float4 operator-(const Float4 a, const Float4 b) { return Float4(a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]); }
+inline Float4 operator*(const Float4 a, const Float4 b) { return Float4(a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]); }
+inline Float4 operator/(const Float4 a, const Float4 b) { return Float4(a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]); }
+inline Float4 operator-(const Float4 a) { return Float4(-a.v[0], -a.v[1], -a.v[2], -a.v[3]); }
+inline Float4 operator&(const Float4 a, const Float4 b)
+{
+    std::uint32_t x[4], y[4];
+    std::memcpy(x, a.v, sizeof(x));
+    std::memcpy(y, b.v, sizeof(y));
+    for (int i = 0; i < 4; ++i) x[i] &= y[i];
+    Float4 result;
+    std::memcpy(result.v, x, sizeof(x));
+    return result;
+}
+inline Float4 operator|(const Float4 a, const Float4 b)
+{
+    std::uint32_t x[4], y[4];
+    std::memcpy(x, a.v, sizeof(x));
+    std::memcpy(y, b.v, sizeof(y));
+    for (int i = 0; i < 4; ++i) x[i] |= y[i];
+    Float4 result;
+    std::memcpy(result.v, x, sizeof(x));
+    return result;
+}
+#endif
+
+inline Float4& operator+=(Float4& a, const Float4 b) { return a = a + b; }
+inline Float4& operator-=(Float4& a, const Float4 b) { return a = a - b; }
+inline Float4& operator*=(Float4& a, const Float4 b) { return a = a * b; }
+inline Float4& operator/=(Float4& a, const Float4 b) { return a = a / b; }
+
+inline namespace VELECS_MATH_FLOAT8_ABI {
+
+/// @struct Float8
+/// @brief Eight float lanes processed together, backed by an AVX register when available.
+///
+/// Has the same interface as Float4. Without AVX it is emulated with two Float4 halves,
+/// so code written against it stays portable.
+struct Float8 {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr int WIDTH = 8; /// @brief The number of lanes.
+
+#if defined(VELECS_MATH_AVX)
+    __m256 v; /// @brief The lanes.
+#else
+    Float4 lo; /// @brief Lanes 0-3.
+    Float4 hi; /// @brief Lanes 4-7.
+#endif
+
+    // Constructors and Destructors
+
+    /// @brief Constructs with uninitialized lanes.
+    Float8() = default;
+
+#if defined(VELECS_MATH_AVX)
+    /// @brief Constructs from a raw AVX register.
+    inline Float8(const __m256 v) : v(v) {}
+
+    /// @brief Broadcasts a scalar to all lanes.
+    inline Float8(const float s) : v(_mm256_set1_ps(s)) {}
+#else
+    /// @brief Constructs from two four-lane halves.
+    inline Float8(const Float4 lo, const Float4 hi) : lo(lo), hi(hi) {}
+
+    /// @brief Broadcasts a scalar to all lanes.
+    inline Float8(const float s) : lo(s), hi(s) {}
+#endif
+
+    /// @brief Default destructor.
+    ~Float8() = default;
+
+    // Public Methods
+
+    /// @brief Loads eight consecutive floats; no alignment requirement.
+    static inline Float8 Load(const float* src)
+    {
+#if defined(VELECS_MATH_AVX)
+        return Float8(_mm256_loadu_ps(src));
+#else
+        return Float8(Float4::Load(src), Float4::Load(src + 4));
+#endif
+    }
+
+    /// @brief Stores the lanes to eight consecutive floats; no alignment requirement.
+    inline void Store(float* dst) const
+    {
+#if defined(VELECS_MATH_AVX)
+        _mm256_storeu_ps(dst, v);
+#else
+        lo.Store(dst);
+        hi.Store(dst + 4);
+#endif
+    }
+
+    /// @brief Reads a single lane. Intended for tails and debugging, not hot loops.
+    inline float operator[](const int lane) const
+    {
+        float lanes[8];
+        Store(lanes);
+        return lanes[lane];
+    }
+
+#if defined(VELECS_MATH_AVX)
+    static inline Float8 Min(const Float8 a, const Float8 b) { return Float8(_mm256_min_ps(a.v, b.v)); }
+    static inline Float8 Max(const Float8 a, const Float8 b) { return Float8(_mm256_max_ps(a.v, b.v)); }
+    static inline Float8 Sqrt(const Float8 a) { return Float8(_mm256_sqrt_ps(a.v)); }
+    static inline Float8 Abs(const Float8 a) { return Float8(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v)); }
+    static inline Float8 Less(const Float8 a, const Float8 b) { return Float8(_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)); }
+    static inline Float8 LessEqual(const Float8 a, const Float8 b) { return Float8(_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)); }
+    static inline Float8 Equal(const Float8 a, const Float8 b) { return Float8(_mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ)); }
+    static inline Float8 Select(const Float8 mask, const Float8 a, const Float8 b) { return Float8(_mm256_blendv_ps(b.v, a.v, mask.v)); }
+    static inline int MoveMask(const Float8 mask) { return _mm256_movemask_ps(mask.v); }
+#else
+    static inline Float8 Min(const Float8 a, const Float8 b) { return Float8(Float4::Min(a.lo, b.lo), Float4::Min(a.hi, b.hi)); }
+    static inline Float8 Max(const Float8 a, const Float8 b) { return Float8(Float4::Max(a.lo, b.lo), Float4::Max(a.hi, b.hi)); }
+    static inline Float8 Sqrt(const Float8 a) { return Float8(Float4::Sqrt(a.lo), Float4::Sqrt(a.hi)); }
+    static inline Float8 Abs(const Float8 a) { return Float8(Float4::Abs(a.lo), Float4::Abs(a.hi)); }
+    static inline Float8 Less(const Float8 a, const Float8 b) { return Float8(Float4::Less(a.lo, b.lo), Float4::Less(a.hi, b.hi)); }
+    static inline Float8 LessEqual(const Float8 a, const Float8 b) { return Float8(Float4::LessEqual(a.lo, b.lo), Float4::LessEqual(a.hi, b.hi)); }
+    static inline Float8 Equal(const Float8 a, const Float8 b) { return Float8(Float4::Equal(a.lo, b.lo), Float4::Equal(a.hi, b.hi)); }
+    static inline Float8 Select(const Float8 mask, const Float8 a, const Float8 b) { return Float8(Float4::Select(mask.lo, a.lo, b.lo), Float4::Select(mask.hi, a.hi, b.hi)); }
+    static inline int MoveMask(const Float8 mask) { return Float4::MoveMask(mask.lo) | (Float4::MoveMask(mask.hi) << 4); }
+#endif
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+#if defined(VELECS_MATH_AVX)
+inline Float8 operator+(const Float8 a, const Float8 b) { return Float8(_mm256_add_ps(a.v, b.v)); }
+inline Float8 operator-(const Float8 a, const Float8 b) { return Float8(_mm256_sub_ps(a.v, b.v)); }
+inline Float8 operator*(const Float8 a, const Float8 b) { return Float8(_mm256_mul_ps(a.v, b.v)); }
+inline Float8 operator/(const Float8 a, const Float8 b) { return Float8(_mm256_div_ps(a.v, b.v)); }
+inline Float8 operator-(const Float8 a) { return Float8(_mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f))); }
+inline Float8 operator&(const Float8 a, const Float8 b) { return Float8(_mm256_and_ps(a.v, b.v)); }
+inline Float8 operator|(const Float8 a, const Float8 b) { return Float8(_mm256_or_ps(a.v, b.v)); }
+#else
+inline Float8 operator+(const Float8 a, const Float8 b) { return Float8(a.lo + b.lo, a.hi + b.hi); }
+inline Float8 operator-(const Float8 a, const Float8 b) { return Float8(a.lo - b.lo, a.hi - b.hi); }
+inline Float8 operator*(const Float8 a, const Float8 b) { return Float8(a.lo * b.lo, a.hi * b.hi); }
+inline Float8 operator/(const Float8 a, const Float8 b) { return Float8(a.lo / b.lo, a.hi / b.hi); }
+inline Float8 operator-(const Float8 a) { return Float8(-a.lo, -a.hi); }
+inline Float8 operator&(const Float8 a, const Float8 b) { return Float8(a.lo & b.lo, a.hi & b.hi); }
+inline Float8 operator|(const Float8 a, const Float8 b) { return Float8(a.lo | b.lo, a.hi | b.hi); }
+#endif
+
+inline Float8& operator+=(Float8& a, const Float8 b) { return a = a + b; }
+inline Float8& operator-=(Float8& a, const Float8 b) { return a = a - b; }
+inline Float8& operator*=(Float8& a, const Float8 b) { return a = a * b; }
+inline Float8& operator/=(Float8& a, const Float8 b) { return a = a / b; }
+
+} // namespace VELECS_MATH_FLOAT8_ABI
+
+} // namespace velecs::math
@@ -0,0 +1,75 @@
+/// @file    Skinning.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 01:52:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Linear blend skinning on the CPU. Each vertex is moved by the weighted sum of up to
+/// four bone matrices, where a bone matrix is the bone's current world transform times
+/// its inverse bind pose.
+
+#pragma once
+
+#include "velecs/math/Batch.hpp"
+#include "velecs/math/Fwd.hpp"
+#include "velecs/math/Span.hpp"
+
+#include <cstdint>
+
+namespace velecs::math {
+
+/// @struct BoneInfluence
+/// @brief The bones that move a vertex and how strongly.
+/// @details Unused slots should have a weight of 0; their bone index must still be valid.
+///          Weights are used as given, so they should sum to 1.
+struct BoneInfluence {
+public:
+    // Enums
+
+    // Public Fields
+
+    std::uint32_t bones[4]; /// @brief Indices into the bone matrix span.
+    float weights[4];       /// @brief The weight of each bone.
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @brief Skins vertex positions (w=1).
+/// @param bones The skinning matrix of every bone.
+/// @param influences One entry per position.
+/// @param positions The bind-pose positions.
+/// @param[out] out Receives one skinned position per input. May alias positions exactly.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if influences or out is smaller than positions.
+/// @throws std::out_of_range if an influence refers to a bone outside bones.
+void SkinPointsMany(Span<const Mat4> bones, Span<const BoneInfluence> influences, Span<const Vec3> positions, Span<Vec3> out, const BatchExecution execution = BatchExecution::Serial);
+
+/// @brief Skins vertex normals or tangents (w=0), ignoring translation.
+/// @details The results are not renormalized, and non-uniformly scaled bones need their
+///          inverse transpose for normals, as with TransformDirectionsMany.
+/// @param bones The skinning matrix of every bone.
+/// @param influences One entry per direction.
+/// @param directions The bind-pose directions.
+/// @param[out] out Receives one skinned direction per input. May alias directions exactly.
+/// @param execution Whether to use worker threads.
+/// @throws std::invalid_argument if influences or out is smaller than directions.
+/// @throws std::out_of_range if an influence refers to a bone outside bones.
+void SkinDirectionsMany(Span<const Mat4> bones, Span<const BoneInfluence> influences, Span<const Vec3> directions, Span<Vec3> out, const BatchExecution execution = BatchExecution::Serial);
+
+} // namespace velecs::math
@@ -0,0 +1,133 @@
+/// @file    Span.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 18:31:07
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <iterator>
+
+namespace velecs::math {
+
+/// @class Span
+/// @brief A non-owning view over a contiguous sequence of elements.
+///
+/// The library targets C++17, which does not provide std::span, so batch APIs take
+/// this minimal equivalent instead. It can be constructed from a pointer and a count,
+/// a C array, or any contiguous container exposing data() and size() (std::vector,
+/// std::array, ...). A Span<T> converts implicitly to a Span<const T>.
+template<typename T>
+class Span {
+public:
+    // Enums
+
+    // Public Fields
+
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    // Constructors and Destructors
+
+    /// @brief Constructs an empty span.
+    constexpr Span() noexcept = default;
+
+    /// @brief Constructs a span over count elements starting at data.
+    /// @param data Pointer to the first element.
+    /// @param count The number of elements in the span.
+    constexpr Span(T* data, const std::size_t count) noexcept
+        : _data(data), _size(count) {}
+
+    /// @brief Constructs a span over a C array.
+    /// @param arr The array to view.
+    template<std::size_t N>
+    constexpr Span(T (&arr)[N]) noexcept
+        : _data(arr), _size(N) {}
+
+    /// @brief Constructs a span over a contiguous container such as std::vector or std::array.
+    /// @param container The container to view. Must outlive the span.
+    template<
+        typename Container,
+        typename = std::enable_if_t<
+            !std::is_same_v<std::remove_cv_t<Container>, Span> &&
+            std::is_convertible_v<decltype(std::data(std::declval<Container&>())), T*>
+        >
+    >
+    constexpr Span(Container& container) noexcept
+        : _data(std::data(container)), _size(std::size(container)) {}
+
+    /// @brief Converting constructor, e.g. from Span<T> to Span<const T>.
+    /// @param other The span to convert from.
+    template<
+        typename U,
+        typename = std::enable_if_t<!std::is_same_v<U, T> && std::is_convertible_v<U(*)[], T(*)[]>>
+    >
+    constexpr Span(const Span<U>& other) noexcept
+        : _data(other.data()), _size(other.size()) {}
+
+    /// @brief Default destructor.
+    ~Span() = default;
+
+    // Public Methods
+
+    /// @brief Gets a pointer to the first element.
+    constexpr T* data() const noexcept { return _data; }
+
+    /// @brief Gets the number of elements in the span.
+    constexpr std::size_t size() const noexcept { return _size; }
+
+    /// @brief Gets the size of the viewed memory in bytes.
+    constexpr std::size_t size_bytes() const noexcept { return _size * sizeof(T); }
+
+    /// @brief Checks whether the span contains no elements.
+    constexpr bool empty() const noexcept { return _size == 0; }
+
+    /// @brief Unchecked element access.
+    /// @param index The index of the element to access.
+    constexpr T& operator[](const std::size_t index) const noexcept { return _data[index]; }
+
+    constexpr T* begin() const noexcept { return _data; }
+    constexpr T* end() const noexcept { return _data + _size; }
+
+    /// @brief Gets a sub-view of this span.
+    /// @param offset The index of the first element of the sub-view.
+    /// @param count The number of elements in the sub-view.
+    /// @returns A span over [offset, offset + count).
+    constexpr Span subspan(const std::size_t offset, const std::size_t count) const noexcept
+    {
+        return Span(_data + offset, count);
+    }
+
+    /// @brief Gets a sub-view from offset to the end of this span.
+    /// @param offset The index of the first element of the sub-view.
+    /// @returns A span over [offset, size()).
+    constexpr Span subspan(const std::size_t offset) const noexcept
+    {
+        return Span(_data + offset, _size - offset);
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    T* _data{nullptr};
+    std::size_t _size{0};
+
+    // Private Methods
+};
+
+} // namespace velecs::math
@@ -0,0 +1,127 @@
+/// @file    SpanCast.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 06:31:44
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Zero-copy reinterpretation of arrays of the library's types as raw floats and back.
+///
+/// Vec2, Vec3, Vec4, Quat and Mat4 are tightly packed floats, which is checked below at
+/// compile time, so an array of them can be handed to code that takes a float buffer
+/// without copying:
+///
+///     std::vector<Vec3> positions = ...;
+///     Span<float> floats = AsFloats(positions);          // 3 * positions.size() floats
+///     Span<const Vec3> back = FromFloats<const Vec3>(floats);
+///
+/// FromFloats checks at run time that the buffer holds a whole number of elements and is
+/// aligned for the element type, and throws std::invalid_argument otherwise. The GLM
+/// counterparts of these views are in velecs/math/Glm.hpp.
+
+#pragma once
+
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Quat.hpp"
+#include "velecs/math/Span.hpp"
+#include "velecs/math/Vec2.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace velecs::math {
+
+namespace detail {
+
+/// @brief The number of floats in a T, for the types that may be viewed as floats.
+template<typename T>
+constexpr std::size_t FloatCount = 0;
+
+template<> constexpr std::size_t FloatCount<Vec2> = 2;
+template<> constexpr std::size_t FloatCount<Vec3> = 3;
+template<> constexpr std::size_t FloatCount<Vec4> = 4;
+template<> constexpr std::size_t FloatCount<Quat> = 4;
+template<> constexpr std::size_t FloatCount<Mat4> = 16;
+
+/// @brief Whether a T is exactly FloatCount<T> floats with no padding or hidden state.
+template<typename T>
+constexpr bool IsFloatPacked = FloatCount<T> != 0
+    && sizeof(T) == FloatCount<T> * sizeof(float)
+    && alignof(T) >= alignof(float)
+    && std::is_standard_layout_v<T>
+    && std::is_trivially_destructible_v<T>;
+
+static_assert(IsFloatPacked<Vec2>, "Vec2 must be 2 tightly packed floats");
+static_assert(IsFloatPacked<Vec3>, "Vec3 must be 3 tightly packed floats");
+static_assert(IsFloatPacked<Vec4>, "Vec4 must be 4 tightly packed floats");
+static_assert(IsFloatPacked<Quat>, "Quat must be 4 tightly packed floats");
+static_assert(IsFloatPacked<Mat4>, "Mat4 must be 16 tightly packed floats");
+
+/// @brief To, with the const qualification of From.
+template<typename From, typename To>
+using LikeConst = std::conditional_t<std::is_const_v<From>, const To, To>;
+
+/// @brief The element type of a contiguous container.
+template<typename Container>
+using ElementOf = std::remove_pointer_t<decltype(std::data(std::declval<Container&>()))>;
+
+/// @brief Checks that count floats at data form whole, suitably aligned Ts.
+template<typename T>
+inline void CheckFloatView(const void* data, const std::size_t count)
+{
+    if (count % FloatCount<T> != 0) {
+        throw std::invalid_argument("The float count is not a multiple of the element size");
+    }
+    if (reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0) {
+        throw std::invalid_argument("The float buffer is not aligned for the element type");
+    }
+}
+
+} // namespace detail
+
+/// @brief Views an array of Vec2, Vec3, Vec4, Quat or Mat4 as its floats without copying.
+/// @param values The elements to view. Constness carries over to the floats.
+/// @returns A span over values.size() times the element's float count.
+template<typename T, typename = std::enable_if_t<detail::IsFloatPacked<std::remove_cv_t<T>>>>
+inline Span<detail::LikeConst<T, float>> AsFloats(const Span<T> values) noexcept
+{
+    using Float = detail::LikeConst<T, float>;
+    return Span<Float>(reinterpret_cast<Float*>(values.data()),
+        values.size() * detail::FloatCount<std::remove_cv_t<T>>);
+}
+
+/// @brief Views a contiguous container such as std::vector<Vec3> as its floats.
+/// @param values The container to view. Must outlive the span.
+template<
+    typename Container,
+    typename Element = detail::ElementOf<Container>,
+    typename = std::enable_if_t<detail::IsFloatPacked<std::remove_cv_t<Element>>>
+>
+inline Span<detail::LikeConst<Element, float>> AsFloats(Container& values) noexcept
+{
+    return AsFloats(Span<Element>(values));
+}
+
+/// @brief Views a float buffer as an array of T without copying.
+/// @tparam T Vec2, Vec3, Vec4, Quat or Mat4, const-qualified to view a const buffer.
+/// @param floats The floats to view; a whole number of Ts, aligned for T.
+/// @returns A span over floats.size() / the element's float count Ts.
+/// @throws std::invalid_argument If the size or alignment does not fit T.
+template<typename T>
+inline Span<T> FromFloats(const Span<detail::LikeConst<T, float>> floats)
+{
+    using Element = std::remove_cv_t<T>;
+    static_assert(detail::IsFloatPacked<Element>, "FromFloats supports Vec2, Vec3, Vec4, Quat and Mat4");
+    detail::CheckFloatView<Element>(floats.data(), floats.size());
+    return Span<T>(reinterpret_cast<T*>(floats.data()), floats.size() / detail::FloatCount<Element>);
+}
+
+} // namespace velecs::math
@@ -0,0 +1,164 @@
+/// @file    Stats.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 03:02:51
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Call statistics for finding redundant work, such as inverting the same matrix every
+/// frame. Configure with VELECS_MATH_STATS=ON to enable them; otherwise the macros expand
+/// to nothing and the API below is not declared.
+///
+/// The commonly misused functions (inverses, projections, Euler and matrix conversions,
+/// normalization, ...) count their calls and hash their inputs. Each call site remembers
+/// the hashes of its last few distinct inputs, so a call whose inputs were seen recently
+/// counts as a repeat: a result that could have been cached.
+///
+/// When the program exits, a report ranked by repeats is written to stderr, or to the file
+/// named by the VELECS_MATH_STATS_REPORT environment variable. GetCallStats() and
+/// WriteCallStatsReport() give the same data on demand.
+
+#pragma once
+
+#if defined(VELECS_MATH_STATS)
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <type_traits>
+#include <vector>
+
+namespace velecs::math {
+
+/// @struct CallStats
+/// @brief The counters of one function.
+struct CallStats {
+public:
+    // Enums
+
+    // Public Fields
+
+    const char* name;      /// @brief The function, e.g. "Mat4::WithInverse".
+    std::uint64_t calls;   /// @brief Number of calls.
+    std::uint64_t repeats; /// @brief Calls whose inputs matched one of the recent inputs of that call site.
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+    /// @brief The fraction of calls that were repeats.
+    inline double RepeatRatio() const { return calls == 0 ? 0.0 : static_cast<double>(repeats) / static_cast<double>(calls); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @brief The counters of every function that has been called, most repeats first.
+std::vector<CallStats> GetCallStats();
+
+/// @brief Writes the ranked report that is printed at exit.
+void WriteCallStatsReport(std::ostream& out);
+
+/// @brief Zeroes every counter and forgets all remembered inputs.
+void ResetCallStats();
+
+namespace detail {
+
+/// @brief The counters and input cache of one call site. Registers itself on construction,
+///        which happens once per site as a function-local static.
+/// @details Trivially destructible, so the report at exit can still read every counter.
+struct CallCounter {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr std::size_t CACHE_SLOTS = 64; /// @brief Remembered inputs per call site.
+
+    const char* const name;
+    std::atomic<std::uint64_t> calls{ 0 };
+    std::atomic<std::uint64_t> repeats{ 0 };
+    std::atomic<std::uint64_t> cache[CACHE_SLOTS] = {}; /// @brief Recent input hashes, direct-mapped by hash bits. 0 is empty.
+    CallCounter* next = nullptr;                        /// @brief The previously registered counter.
+
+    // Constructors and Destructors
+
+    explicit CallCounter(const char* name);
+
+    // Public Methods
+
+    /// @brief Counts a call with the given input hash.
+    inline void Record(std::uint64_t hash)
+    {
+        hash |= 1; // Keep 0 free to mark empty slots.
+        calls.fetch_add(1, std::memory_order_relaxed);
+        if (cache[(hash >> 1) % CACHE_SLOTS].exchange(hash, std::memory_order_relaxed) == hash) {
+            repeats.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+static_assert(std::is_trivially_destructible_v<CallCounter>, "CallCounter must outlive static destruction");
+
+/// @brief Adds the bytes of a value to an FNV-1a hash.
+template<typename T>
+inline std::uint64_t HashInput(std::uint64_t hash, const T& value)
+{
+    static_assert(std::is_standard_layout_v<T> && std::is_trivially_destructible_v<T>, "Call statistics can only hash plain value inputs");
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/// @brief Hashes every input of a call.
+template<typename... Inputs>
+inline std::uint64_t HashInputs(const Inputs&... inputs)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    ((hash = HashInput(hash, inputs)), ...);
+    return hash;
+}
+
+} // namespace detail
+
+} // namespace velecs::math
+
+#define VELECS_MATH_STATS_CONCAT_IMPL(a, b) a##b
+#define VELECS_MATH_STATS_CONCAT(a, b) VELECS_MATH_STATS_CONCAT_IMPL(a, b)
+
+/// @brief Counts a call of the enclosing function and whether its inputs are a repeat.
+/// @param name A string literal naming the function.
+/// @param ... The inputs that determine the result, e.g. *this and the arguments. They are
+///            hashed byte by byte, so they must be plain values without padding.
+#define VELECS_MATH_STAT(name, ...)                                                                            \
+    static ::velecs::math::detail::CallCounter VELECS_MATH_STATS_CONCAT(velecsCallCounter, __LINE__){ name }; \
+    VELECS_MATH_STATS_CONCAT(velecsCallCounter, __LINE__).Record(::velecs::math::detail::HashInputs(__VA_ARGS__))
+
+#else
+
+#define VELECS_MATH_STAT(name, ...) ((void)0)
+
+#endif
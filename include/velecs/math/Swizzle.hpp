@@ -0,0 +1,135 @@
+/// @file    Swizzle.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 22:14:09
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Shader-style swizzle accessors (.xzy(), .ww(), .xyz(), ...) for the vector types.
+///
+/// Every combination of 2, 3 and 4 components is generated by the preprocessor from the
+/// component list of a type. As in GLSL, a swizzle is a value: .xz() returns a new vector
+/// and never aliases the source. Writing goes through the matching setter, which is only
+/// usable when no component repeats:
+///
+///     v.SetZx(Vec2(1.0f, 2.0f)); // v.z = 1, v.x = 2
+///     float len = v.xz().Magnitude();
+///
+/// The result types are template parameters defaulted to Vec2/Vec3/Vec4, so a vector header
+/// only needs the others forward-declared. Include the header of the result type to call a
+/// swizzle that returns it, e.g. Vec2.hpp for Vec3::xz().
+///
+/// A type opts in by invoking VELECS_MATH_SWIZZLES(components, Vec3Type) in its public
+/// section and providing a private `template<typename V, int... I> V Swizzle() const`.
+
+#pragma once
+
+namespace velecs::math {
+
+struct Vec2;
+struct Vec3;
+struct Vec4;
+
+namespace detail {
+
+/// @brief Whether no component index appears twice, i.e. the swizzle can be written to.
+template<int... I>
+constexpr bool SwizzleIndicesDistinct()
+{
+    const int indices[] = { I... };
+    constexpr int count = sizeof...(I);
+    for (int i = 0; i < count; ++i) {
+        for (int j = i + 1; j < count; ++j) {
+            if (indices[i] == indices[j]) return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Writes the components of value to the components I of target, in order.
+/// @details Reads all of value before writing, so value may alias target, e.g. v.SetYx(v) on a Vec2.
+template<int... I, typename V>
+inline void SwizzleStore(float* target, const V& value)
+{
+    static_assert(SwizzleIndicesDistinct<I...>(), "Cannot assign to a swizzle that repeats a component");
+    constexpr int count = sizeof...(I);
+    const float* src = &value.x;
+    float copy[count];
+    for (int k = 0; k < count; ++k) {
+        copy[k] = src[k];
+    }
+    int k = 0;
+    ((target[I] = copy[k++]), ...);
+}
+
+} // namespace detail
+
+} // namespace velecs::math
+
+// Emitters: one swizzle, as a const value accessor plus a setter. The setters are templates
+// so that those repeating a component only fail when called.
+
+#define VELECS_MATH_SWIZZLE_EMIT2(T3, a, A, ia, b, B, ib) \
+    template<typename V = ::velecs::math::Vec2> \
+    constexpr V a##b() const { return this->template Swizzle<V, ia, ib>(); } \
+    template<typename V = ::velecs::math::Vec2> \
+    inline auto& Set##A##b(const V& value) { ::velecs::math::detail::SwizzleStore<ia, ib>(&x, value); return *this; }
+
+#define VELECS_MATH_SWIZZLE_EMIT3(T3, a, A, ia, b, B, ib, c, C, ic) \
+    template<typename V = T3> \
+    constexpr V a##b##c() const { return this->template Swizzle<V, ia, ib, ic>(); } \
+    template<typename V = T3> \
+    inline auto& Set##A##b##c(const V& value) { ::velecs::math::detail::SwizzleStore<ia, ib, ic>(&x, value); return *this; }
+
+#define VELECS_MATH_SWIZZLE_EMIT4(T3, a, A, ia, b, B, ib, c, C, ic, d, D, id) \
+    template<typename V = ::velecs::math::Vec4> \
+    constexpr V a##b##c##d() const { return this->template Swizzle<V, ia, ib, ic, id>(); } \
+    template<typename V = ::velecs::math::Vec4> \
+    inline auto& Set##A##b##c##d(const V& value) { ::velecs::math::detail::SwizzleStore<ia, ib, ic, id>(&x, value); return *this; }
+
+// Component lists, each component as (name, capitalized name, index). The preprocessor will
+// not re-expand a macro inside its own expansion, so each nesting level of the combination
+// loops gets its own copy.
+
+#define VELECS_MATH_SWIZZLE_XY_L1(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1)
+#define VELECS_MATH_SWIZZLE_XY_L2(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1)
+#define VELECS_MATH_SWIZZLE_XY_L3(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1)
+#define VELECS_MATH_SWIZZLE_XY_L4(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1)
+
+#define VELECS_MATH_SWIZZLE_XYZ_L1(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1) M(__VA_ARGS__, z, Z, 2)
+#define VELECS_MATH_SWIZZLE_XYZ_L2(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1) M(__VA_ARGS__, z, Z, 2)
+#define VELECS_MATH_SWIZZLE_XYZ_L3(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1) M(__VA_ARGS__, z, Z, 2)
+#define VELECS_MATH_SWIZZLE_XYZ_L4(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1) M(__VA_ARGS__, z, Z, 2)
+
+#define VELECS_MATH_SWIZZLE_XYZW_L1(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1) M(__VA_ARGS__, z, Z, 2) M(__VA_ARGS__, w, W, 3)
+#define VELECS_MATH_SWIZZLE_XYZW_L2(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1) M(__VA_ARGS__, z, Z, 2) M(__VA_ARGS__, w, W, 3)
+#define VELECS_MATH_SWIZZLE_XYZW_L3(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1) M(__VA_ARGS__, z, Z, 2) M(__VA_ARGS__, w, W, 3)
+#define VELECS_MATH_SWIZZLE_XYZW_L4(M, ...) M(__VA_ARGS__, x, X, 0) M(__VA_ARGS__, y, Y, 1) M(__VA_ARGS__, z, Z, 2) M(__VA_ARGS__, w, W, 3)
+
+// Glue between nesting levels: each step appends one component and descends a level.
+
+#define VELECS_MATH_SWIZZLE_G2(L2, T3, a, A, ia) \
+    L2(VELECS_MATH_SWIZZLE_EMIT2, T3, a, A, ia)
+
+#define VELECS_MATH_SWIZZLE_G3A(L2, L3, T3, a, A, ia) \
+    L2(VELECS_MATH_SWIZZLE_G3B, L3, T3, a, A, ia)
+#define VELECS_MATH_SWIZZLE_G3B(L3, T3, a, A, ia, b, B, ib) \
+    L3(VELECS_MATH_SWIZZLE_EMIT3, T3, a, A, ia, b, B, ib)
+
+#define VELECS_MATH_SWIZZLE_G4A(L2, L3, L4, T3, a, A, ia) \
+    L2(VELECS_MATH_SWIZZLE_G4B, L3, L4, T3, a, A, ia)
+#define VELECS_MATH_SWIZZLE_G4B(L3, L4, T3, a, A, ia, b, B, ib) \
+    L3(VELECS_MATH_SWIZZLE_G4C, L4, T3, a, A, ia, b, B, ib)
+#define VELECS_MATH_SWIZZLE_G4C(L4, T3, a, A, ia, b, B, ib, c, C, ic) \
+    L4(VELECS_MATH_SWIZZLE_EMIT4, T3, a, A, ia, b, B, ib, c, C, ic)
+
+/// @brief Declares every 2, 3 and 4 component swizzle of a vector type.
+/// @param S The component list: VELECS_MATH_SWIZZLE_XY, _XYZ or _XYZW.
+/// @param T3 The default result type of 3 component swizzles (Vec3, or Vec3A for Vec3A).
+#define VELECS_MATH_SWIZZLES(S, T3) \
+    S##_L1(VELECS_MATH_SWIZZLE_G2, S##_L2, T3) \
+    S##_L1(VELECS_MATH_SWIZZLE_G3A, S##_L2, S##_L3, T3) \
+    S##_L1(VELECS_MATH_SWIZZLE_G4A, S##_L2, S##_L3, S##_L4, T3)
@@ -0,0 +1,159 @@
+/// @file    TaggedMat4.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 19:41:12
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <cstdint>
+
+namespace velecs::math {
+
+struct Quat;
+
+/// @struct TaggedMat4
+/// @brief A Mat4 paired with a tag describing what kind of transform it holds.
+///
+/// Mat4 itself stays a plain 64-byte matrix so it can be uploaded and reinterpreted
+/// freely; TaggedMat4 is the opt-in variant for code that wants multiplication,
+/// inversion and vector transforms to skip work the matrix structure makes unnecessary.
+/// The factory functions set the tag automatically, and the operators keep it up to date.
+struct TaggedMat4 {
+public:
+    // Enums
+
+    /// @enum Kind
+    /// @brief The structure of a matrix, from most to least specialized.
+    /// @details Kinds are ordered so that the product of two matrices is at most the
+    ///          larger of their kinds.
+    enum class Kind : std::uint8_t {
+        Identity,    /// @brief The identity matrix.
+        Translation, /// @brief A translation only; the upper 3x3 is the identity.
+        Rigid,       /// @brief A rotation plus translation; the upper 3x3 is orthonormal.
+        Affine,      /// @brief Any affine transform; the bottom row is (0, 0, 0, 1).
+        Projective,  /// @brief A general 4x4 matrix, such as a perspective projection.
+    };
+
+    // Public Fields
+
+    static const TaggedMat4 IDENTITY; /// @brief The identity matrix, tagged as Kind::Identity.
+
+    Mat4 mat;  /// @brief The underlying matrix.
+    Kind kind; /// @brief The structure of mat. Must never be more specialized than the matrix really is.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a tagged matrix from a matrix of a known kind.
+    /// @param mat The matrix.
+    /// @param kind The kind of the matrix. Passing a too-specialized kind gives wrong results.
+    inline TaggedMat4(const Mat4& mat, const Kind kind)
+        : mat(mat), kind(kind) {}
+
+    /// @brief Constructs a tagged matrix from an untagged one, classifying it by inspection.
+    /// @param mat The matrix to wrap.
+    explicit TaggedMat4(const Mat4& mat);
+
+    /// @brief Default destructor.
+    ~TaggedMat4() = default;
+
+    // Public Methods
+
+    /// @brief Determines the most specialized kind that exactly describes a matrix.
+    /// @param mat The matrix to inspect.
+    /// @param epsilon The tolerance used when checking the upper 3x3 for orthonormality.
+    /// @returns The kind of the matrix.
+    static Kind Classify(const Mat4& mat, const float epsilon = 1e-5f);
+
+    /// @brief Creates a translation matrix, tagged as Kind::Translation.
+    /// @param position The position vector to use for translation.
+    static TaggedMat4 FromPosition(const Vec3& position);
+
+    /// @brief Creates a scaling matrix, tagged as Kind::Affine.
+    /// @param scale The scale factors for the x, y, and z axes.
+    static TaggedMat4 FromScale(const Vec3& scale);
+
+    /// @brief Creates a rotation matrix from Euler angles in radians, tagged as Kind::Rigid.
+    /// @param rotationRad The rotation vector in radians (x=pitch, y=yaw, z=roll).
+    static TaggedMat4 FromRotationRad(const Vec3& rotationRad);
+
+    /// @brief Creates a rotation matrix from Euler angles in degrees, tagged as Kind::Rigid.
+    /// @param rotationDeg The rotation vector in degrees (x=pitch, y=yaw, z=roll).
+    static TaggedMat4 FromRotationDeg(const Vec3& rotationDeg);
+
+    /// @brief Creates a rotation matrix from a quaternion, tagged as Kind::Rigid.
+    /// @param rotation The quaternion representing the rotation (should be normalized).
+    static TaggedMat4 FromRotation(const Quat& rotation);
+
+    /// @brief Creates a Vulkan perspective projection matrix, tagged as Kind::Projective.
+    /// @see Mat4::FromPerspectiveRad
+    static TaggedMat4 FromPerspectiveRad(float verticalFovRad, float aspectRatio, float nearPlane, float farPlane);
+
+    /// @brief Creates a Vulkan orthographic projection matrix, tagged as Kind::Affine.
+    /// @see Mat4::FromOrthographic
+    static TaggedMat4 FromOrthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane);
+
+    /// @brief Creates a centered Vulkan orthographic projection matrix, tagged as Kind::Affine.
+    /// @see Mat4::FromOrthographic
+    static TaggedMat4 FromOrthographic(float width, float height, float nearPlane, float farPlane);
+
+    /// @brief Converts back to a plain Mat4.
+    inline operator const Mat4&() const { return mat; }
+
+    /// @brief Multiplies this matrix by another and assigns the result to this matrix.
+    /// @param[in] other The matrix to multiply with this matrix.
+    /// @returns A reference to this matrix after the multiplication.
+    TaggedMat4& operator*=(const TaggedMat4& other);
+
+    /// @brief Creates the inverse of this matrix using the cheapest kernel for its kind.
+    /// @details Identity and translation inverses are trivial, rigid inverses transpose the
+    ///          rotation, affine inverses only invert the upper 3x3.
+    /// @returns The inverse matrix, with the same kind as this matrix.
+    TaggedMat4 WithInverse() const;
+
+    /// @brief Transforms a point (w=1) by this matrix.
+    /// @details Affine kinds skip the bottom row entirely; projective matrices perform the
+    ///          perspective divide.
+    /// @param point The point to transform.
+    /// @returns The transformed point.
+    Vec3 TransformPoint(const Vec3& point) const;
+
+    /// @brief Transforms a direction (w=0) by this matrix, ignoring translation.
+    /// @param direction The direction to transform.
+    /// @returns The transformed direction. Not renormalized.
+    Vec3 TransformDirection(const Vec3& direction) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @brief Multiplies two tagged matrices, dispatching on their kinds.
+/// @details Identity operands are skipped, two translations just add, and affine operands
+///          use the 3x4 kernel; only projective operands take the general 4x4 path.
+/// @param[in] lhs The left-hand side matrix operand.
+/// @param[in] rhs The right-hand side matrix operand.
+/// @returns The product, tagged with the larger of the two kinds.
+TaggedMat4 operator*(const TaggedMat4& lhs, const TaggedMat4& rhs);
+
+/// @brief Multiplies a tagged matrix by a vector, skipping the bottom row for affine kinds.
+/// @param[in] lhs The matrix operand.
+/// @param[in] rhs The vector operand.
+/// @returns The transformed vector.
+Vec4 operator*(const TaggedMat4& lhs, const Vec4& rhs);
+
+} // namespace velecs::math
@@ -0,0 +1,152 @@
+/// @file    TransformBuilder.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 19:02:41
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Quat.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::math {
+
+/// @struct TransformBuilder
+/// @brief Lazily composes translation, rotation and scale steps into a single Mat4.
+///
+/// Steps follow the same post-multiplication order as the Mat4::With* methods, so
+/// `TransformBuilder().Translate(t).Rotate(r).Scale(s).Build()` equals
+/// `Mat4::IDENTITY.WithTranslation(t).WithRotation(r).WithScale(s)`.
+/// Instead of a 4x4 product per step, the steps are recorded and collapsed at Build()
+/// time into a 3x3 linear part plus a translation: consecutive steps of the same kind
+/// are merged, a T-R-S chain is assembled directly from its parts, and any other chain
+/// is composed with 3x3 arithmetic only.
+struct TransformBuilder {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a builder that starts from the identity matrix.
+    TransformBuilder();
+
+    /// @brief Constructs a builder whose steps are applied on top of an existing matrix.
+    /// @param base The matrix to post-multiply the composed transform onto. May be projective.
+    explicit TransformBuilder(const Mat4& base);
+
+    /// @brief Default destructor.
+    ~TransformBuilder() = default;
+
+    // Public Methods
+
+    /// @brief Records a translation step.
+    /// @param displacement The vector representing how far to move in each direction.
+    /// @return A reference to this builder, for chaining.
+    TransformBuilder& Translate(const Vec3& displacement);
+
+    /// @brief Records a scaling step.
+    /// @param scale The scale factors for x, y, and z axes.
+    /// @return A reference to this builder, for chaining.
+    TransformBuilder& Scale(const Vec3& scale);
+
+    /// @brief Records a quaternion rotation step.
+    /// @param rotation The quaternion representing the rotation to apply.
+    /// @return A reference to this builder, for chaining.
+    TransformBuilder& Rotate(const Quat& rotation);
+
+    /// @brief Records a rotation step around an axis.
+    /// @param angleRad The rotation angle in radians.
+    /// @param axis The axis to rotate around (normalized internally).
+    /// @return A reference to this builder, for chaining.
+    TransformBuilder& RotateRad(const float angleRad, const Vec3& axis);
+
+    /// @brief Records a rotation step around an axis.
+    /// @param angleDeg The rotation angle in degrees.
+    /// @param axis The axis to rotate around (normalized internally).
+    /// @return A reference to this builder, for chaining.
+    inline TransformBuilder& RotateDeg(const float angleDeg, const Vec3& axis)
+    {
+        return RotateRad(angleDeg * DEG_TO_RAD, axis);
+    }
+
+    /// @brief Records an Euler angle rotation step.
+    /// @param eulerAnglesRad The Euler angles in radians (x=pitch, y=yaw, z=roll).
+    /// @return A reference to this builder, for chaining.
+    inline TransformBuilder& RotateRad(const Vec3& eulerAnglesRad)
+    {
+        return Rotate(Quat::FromEulerAnglesRad(eulerAnglesRad));
+    }
+
+    /// @brief Records an Euler angle rotation step.
+    /// @param eulerAnglesDeg The Euler angles in degrees (x=pitch, y=yaw, z=roll).
+    /// @return A reference to this builder, for chaining.
+    inline TransformBuilder& RotateDeg(const Vec3& eulerAnglesDeg)
+    {
+        return Rotate(Quat::FromEulerAnglesDeg(eulerAnglesDeg));
+    }
+
+    /// @brief Collapses the recorded steps into a single matrix.
+    /// @details The builder is left unchanged, so more steps may be appended afterwards.
+    /// @returns The composed transformation matrix.
+    Mat4 Build() const;
+
+    /// @brief Discards all recorded steps, keeping the base matrix.
+    void Reset();
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief The kind of a recorded step.
+    enum class StepKind : std::uint8_t {
+        Translate,
+        Rotate,
+        Scale,
+    };
+
+    /// @brief A recorded step. Translation and scale use xyz; rotation uses xyzw as a quaternion.
+    struct Step {
+        StepKind kind;
+        float data[4];
+    };
+
+    /// @brief An affine transform as a column-major 3x3 linear part plus a translation.
+    struct Affine {
+        float linear[3][3];
+        float translation[3];
+        bool linearIsIdentity;
+    };
+
+    static constexpr std::size_t MAX_PENDING_STEPS = 8; /// @brief Steps kept before folding into the accumulator.
+
+    Mat4 _base;
+    bool _hasBase;
+    Affine _folded;
+    std::array<Step, MAX_PENDING_STEPS> _steps;
+    std::size_t _stepCount;
+
+    // Private Methods
+
+    /// @brief Appends a step, merging it with the previous one when both have the same kind.
+    void Record(const StepKind kind, const float x, const float y, const float z, const float w);
+
+    /// @brief Applies the given steps to an affine accumulator.
+    static void Fold(Affine& affine, const Step* steps, const std::size_t count);
+};
+
+} // namespace velecs::math
@@ -0,0 +1,85 @@
+/// @file    TransformHierarchy.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 23:40:18
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Fwd.hpp"
+#include "velecs/math/Span.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::math {
+
+/// @struct TransformHierarchy
+/// @brief A scene graph given as a flat parent-index array, grouped by depth for parallel updates.
+///
+/// Construction sorts the nodes into levels by their distance from a root. UpdateWorld then
+/// computes every world matrix one level at a time: all nodes of a level only depend on the
+/// level above, so each level is split across worker threads and every thread composes its
+/// nodes 4 (SSE) or 8 (AVX) at a time in SIMD lanes. Build the hierarchy once and reuse it
+/// for as long as the parent array does not change.
+struct TransformHierarchy {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr std::uint32_t NO_PARENT = 0xFFFFFFFFu; /// @brief The parent index of a root node.
+
+    // Constructors and Destructors
+
+    /// @brief Groups the nodes of a parent-index array by depth.
+    /// @param parents The parent of each node, or NO_PARENT for roots. Parents may appear
+    ///                before or after their children.
+    /// @throws std::invalid_argument if a parent index is out of range or the parents form a cycle.
+    explicit TransformHierarchy(Span<const std::uint32_t> parents);
+
+    /// @brief Default destructor.
+    ~TransformHierarchy() = default;
+
+    // Public Methods
+
+    /// @brief The number of nodes.
+    inline std::size_t Size() const { return _order.size(); }
+
+    /// @brief The number of depth levels; 0 for an empty hierarchy.
+    inline std::size_t LevelCount() const { return _levelStarts.size() - 1; }
+
+    /// @brief The nodes at a given depth, in ascending index order. Depth 0 holds the roots.
+    /// @param depth The level, in [0, LevelCount()).
+    /// @throws std::out_of_range if depth is not a valid level.
+    Span<const std::uint32_t> Level(const std::size_t depth) const;
+
+    /// @brief Computes world = parentWorld * translation * rotation * scale for every node.
+    /// @param positions The local translation of each node.
+    /// @param rotations The local rotation of each node. Must be normalized.
+    /// @param scales The local scale of each node.
+    /// @param[out] world Receives the world matrix of each node.
+    /// @throws std::invalid_argument if any span is smaller than Size().
+    void UpdateWorld(Span<const Vec3> positions, Span<const Quat> rotations, Span<const Vec3> scales, Span<Mat4> world) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::vector<std::uint32_t> _order;        /// @brief Node indices sorted by depth, then by index.
+    std::vector<std::uint32_t> _orderParents; /// @brief The parent of each entry of _order, so levels read parents sequentially.
+    std::vector<std::size_t> _levelStarts;    /// @brief Offset of each level in _order, plus a final end offset.
+
+    // Private Methods
+};
+
+} // namespace velecs::math
@@ -0,0 +1,248 @@
+/// @file    TransformSnapshotBuffer.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 23:06:52
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Quat.hpp"
+#include "velecs/math/Span.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::math {
+
+/// @struct DirtyRange
+/// @brief A half-open range [begin, end) of transform indices that changed.
+struct DirtyRange {
+    std::size_t begin = 0; /// @brief The first changed index.
+    std::size_t end = 0;   /// @brief One past the last changed index.
+
+    /// @brief Whether the range contains no indices.
+    inline bool IsEmpty() const { return begin >= end; }
+
+    /// @brief The number of indices in the range.
+    inline std::size_t Count() const { return IsEmpty() ? 0 : end - begin; }
+
+    /// @brief Grows this range to also cover other.
+    inline void Merge(const DirtyRange& other)
+    {
+        if (other.IsEmpty()) return;
+        if (IsEmpty()) {
+            *this = other;
+            return;
+        }
+        if (other.begin < begin) begin = other.begin;
+        if (other.end > end) end = other.end;
+    }
+};
+
+/// @struct TransformSnapshot
+/// @brief One simulation tick worth of transforms: local TRS arrays plus optional matrices.
+///
+/// Each snapshot remembers the dirty range of the last few ticks that led up to it, so a
+/// consumer can tell which transforms changed since any snapshot it saw before.
+struct TransformSnapshot {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr std::size_t HISTORY = 8; /// @brief The number of past ticks whose dirty ranges are kept.
+
+    std::vector<Vec3> positions; /// @brief The translation of each transform.
+    std::vector<Quat> rotations; /// @brief The rotation of each transform.
+    std::vector<Vec3> scales;    /// @brief The scale of each transform.
+    std::vector<Mat4> matrices;  /// @brief World matrices, if the buffer was created with them; otherwise empty.
+
+    std::uint64_t tick = 0; /// @brief The simulation tick this snapshot was published at. 0 before the first publish.
+    double time = 0.0;      /// @brief The simulation time of the tick, in whatever unit the writer uses.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a snapshot of count identity transforms.
+    /// @param count The number of transforms.
+    /// @param withMatrices Whether to also hold a world matrix per transform.
+    TransformSnapshot(const std::size_t count, const bool withMatrices);
+
+    /// @brief Default destructor.
+    ~TransformSnapshot() = default;
+
+    // Public Methods
+
+    /// @brief The number of transforms.
+    inline std::size_t Size() const { return positions.size(); }
+
+    /// @brief Computes which transforms may differ from the snapshot published at an earlier tick.
+    /// @param since The tick of the older snapshot.
+    /// @returns The union of the dirty ranges of every tick after since, empty if since is not
+    ///          older than this snapshot, or everything if those ticks fell out of the history.
+    DirtyRange ChangedSince(const std::uint64_t since) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    friend struct TransformSnapshotBuffer;
+
+    /// @struct TickRange
+    /// @brief The dirty range published at one tick.
+    struct TickRange {
+        std::uint64_t tick = 0;
+        DirtyRange range;
+    };
+
+    // Private Fields
+
+    std::array<TickRange, HISTORY> _history; /// @brief Ring of recent dirty ranges, indexed by tick % HISTORY.
+
+    // Private Methods
+};
+
+/// @struct TransformSnapshotBuffer
+/// @brief A lock-free triple buffer that hands transform snapshots from one simulation
+///        thread to one render thread.
+///
+/// Neither side ever blocks. The writer fills a back snapshot and publishes it by swapping it
+/// with a shared slot through a single atomic exchange; the reader swaps the shared slot out
+/// whenever a newer snapshot is waiting. A fourth slot keeps the reader's previous snapshot
+/// alive so it can interpolate between the last two ticks.
+///
+/// Only the ranges marked dirty are copied. BeginWrite() brings the back snapshot up to date
+/// from the latest published one by copying the ranges that changed since it was last
+/// written, so the writer only has to write the transforms that moved this tick.
+///
+///     // Simulation thread
+///     TransformSnapshot& next = buffer.BeginWrite();
+///     next.positions[i] = newPosition;
+///     buffer.MarkDirty(i, 1);
+///     buffer.Publish(simTime);
+///
+///     // Render thread
+///     buffer.AcquireLatest();
+///     buffer.Interpolate(buffer.InterpolationAlpha(renderTime), worldMatrices);
+///
+/// All writer methods must be called from one thread and all reader methods from another.
+struct TransformSnapshotBuffer {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a buffer of count identity transforms.
+    /// @param count The number of transforms in every snapshot.
+    /// @param withMatrices Whether snapshots also carry a world matrix per transform.
+    explicit TransformSnapshotBuffer(const std::size_t count, const bool withMatrices = false);
+
+    TransformSnapshotBuffer(const TransformSnapshotBuffer&) = delete;
+    TransformSnapshotBuffer& operator=(const TransformSnapshotBuffer&) = delete;
+
+    /// @brief Default destructor.
+    ~TransformSnapshotBuffer() = default;
+
+    // Public Methods
+
+    /// @brief Writer: starts a new tick.
+    /// @returns The back snapshot, holding the same transforms as the latest published one.
+    ///          Only the writer may touch it until Publish().
+    TransformSnapshot& BeginWrite();
+
+    /// @brief Writer: records that transforms were written this tick.
+    /// @details Every modified transform must be covered, or it will be missing from
+    ///          snapshots that are brought up to date later.
+    /// @param first The index of the first modified transform.
+    /// @param count The number of consecutive modified transforms.
+    /// @throws std::out_of_range if the range extends past the end of the snapshot.
+    void MarkDirty(const std::size_t first, const std::size_t count);
+
+    /// @brief Writer: publishes the back snapshot as the latest complete tick.
+    /// @param time The simulation time of the tick, used by InterpolationAlpha.
+    /// @throws std::logic_error if BeginWrite was not called for this tick.
+    void Publish(const double time);
+
+    /// @brief Reader: takes the latest published snapshot, if there is a new one.
+    /// @details On success the old current snapshot becomes Previous(). Ticks published
+    ///          between two calls are skipped.
+    /// @returns True if Current() changed.
+    bool AcquireLatest();
+
+    /// @brief Reader: the most recent snapshot taken by AcquireLatest.
+    inline const TransformSnapshot& Current() const { return _slots[_current]; }
+
+    /// @brief Reader: the snapshot that was current before the last successful AcquireLatest.
+    inline const TransformSnapshot& Previous() const { return _slots[_previous]; }
+
+    /// @brief Reader: the transforms that changed between Previous() and Current().
+    inline DirtyRange ChangedRange() const { return Current().ChangedSince(Previous().tick); }
+
+    /// @brief Reader: computes how far a render time lies between Previous() and Current().
+    /// @param renderTime The time being rendered, in the same unit as Publish.
+    /// @returns The interpolation factor clamped to [0, 1]; 1 if both ticks share a time.
+    float InterpolationAlpha(const double renderTime) const;
+
+    /// @brief Reader: builds world matrices interpolated between Previous() and Current().
+    /// @param alpha The interpolation factor; 0 is Previous(), 1 is Current().
+    /// @param[out] out Receives one matrix per transform.
+    inline void Interpolate(const float alpha, Span<Mat4> out) const
+    {
+        InterpolateSnapshots(Previous(), Current(), alpha, out);
+    }
+
+    /// @brief Builds translation * rotation * scale matrices between two snapshots.
+    /// @details Translation and scale are lerped and rotation is slerped.
+    /// @param from The snapshot at alpha = 0.
+    /// @param to The snapshot at alpha = 1.
+    /// @param alpha The interpolation factor.
+    /// @param[out] out Receives one matrix per transform.
+    /// @throws std::invalid_argument if the snapshots differ in size or out is too small.
+    static void InterpolateSnapshots(const TransformSnapshot& from, const TransformSnapshot& to, const float alpha, Span<Mat4> out);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    static constexpr std::size_t SLOTS = 4;          /// @brief Writer back, shared, reader current and reader previous.
+    static constexpr std::uint8_t INDEX_MASK = 0x3;  /// @brief The slot index bits of _shared.
+    static constexpr std::uint8_t FRESH_BIT = 0x4;   /// @brief Set in _shared while it holds an unread snapshot.
+
+    std::array<TransformSnapshot, SLOTS> _slots; /// @brief The snapshots. Each is owned by exactly one role at a time.
+
+    // Writer state, on its own cache line so the reader never contends for it.
+    alignas(64) std::uint8_t _back;                                      /// @brief The slot being written.
+    std::uint8_t _latest;                                                /// @brief The slot published last; read-only for everyone.
+    bool _writing;                                                       /// @brief Whether BeginWrite was called for this tick.
+    DirtyRange _pending;                                                 /// @brief The range marked dirty this tick.
+    std::array<TransformSnapshot::TickRange, TransformSnapshot::HISTORY> _history; /// @brief The dirty history copied into each published snapshot.
+
+    alignas(64) std::atomic<std::uint8_t> _shared; /// @brief The slot in transit, plus FRESH_BIT.
+
+    // Reader state.
+    alignas(64) std::uint8_t _current; /// @brief The slot returned by Current().
+    std::uint8_t _previous;            /// @brief The slot returned by Previous().
+
+    // Private Methods
+
+    /// @brief Copies a range of every array from one snapshot into another.
+    static void CopyRange(const TransformSnapshot& src, TransformSnapshot& dst, const DirtyRange& range);
+};
+
+} // namespace velecs::math
@@ -0,0 +1,117 @@
+/// @file    UniformGrid2D.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 08:51:03
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Rect.hpp"
+#include "velecs/math/Span.hpp"
+#include "velecs/math/Vec2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::math {
+
+/// @struct UniformGrid2D
+/// @brief A static grid of equal square cells over rectangles, for many similarly sized items.
+///
+/// Every item is listed in each cell it overlaps. The lists are built with a counting sort
+/// into one array, so a build is two linear passes and a query reads each cell's ids
+/// contiguously. Queries report an item only from the first cell where it and the query
+/// overlap, so no item is reported twice and no marks are needed.
+///
+/// Pick a cell size around the typical item size: much smaller cells list large items many
+/// times, much larger ones put many items in each cell. For items of widely varying size,
+/// Quadtree is the better fit.
+struct UniformGrid2D {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFFu;   /// @brief Returned by HitTest when no item is hit.
+    static constexpr std::size_t MAX_CELLS = std::size_t(1) << 24; /// @brief The most cells a grid may have.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs an empty grid; every query finds nothing.
+    UniformGrid2D() = default;
+
+    /// @brief Builds a grid over a set of rectangles, spanning their bounds.
+    /// @param items The rectangles. Ids in query results are indices into this span. Empty
+    ///              rectangles are never found.
+    /// @param cellSize The edge length of a cell.
+    /// @throws std::invalid_argument if cellSize is not positive, there are 2^32 - 1 or more
+    ///         items, or the bounds need more than MAX_CELLS cells.
+    UniformGrid2D(Span<const Rect> items, const float cellSize);
+
+    /// @brief Default destructor.
+    ~UniformGrid2D() = default;
+
+    // Public Methods
+
+    /// @brief The number of items in the grid.
+    inline std::size_t Size() const { return _items.size(); }
+
+    /// @brief The number of cells along x.
+    inline std::uint32_t Columns() const { return _columns; }
+
+    /// @brief The number of cells along y.
+    inline std::uint32_t Rows() const { return _rows; }
+
+    /// @brief Finds the items that contain a point, boundary included.
+    /// @param[out] out Cleared, then receives the ids found in ascending order.
+    void QueryPoint(const Vec2 point, std::vector<std::uint32_t>& out) const;
+
+    /// @brief Finds the items that overlap or touch a rectangle.
+    /// @param[out] out Cleared, then receives the ids found in no particular order.
+    void QueryRect(const Rect& rect, std::vector<std::uint32_t>& out) const;
+
+    /// @brief Finds the items that overlap or touch a circle.
+    /// @param[out] out Cleared, then receives the ids found in no particular order.
+    void QueryRadius(const Vec2 center, const float radius, std::vector<std::uint32_t>& out) const;
+
+    /// @brief Finds the topmost item under a point: the one with the highest id, as items
+    ///        later in draw order are drawn on top.
+    /// @returns The id of the item, or INVALID if no item contains the point.
+    std::uint32_t HitTest(const Vec2 point) const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::vector<Rect> _items;              /// @brief A copy of the items, for exact tests.
+    float _originX{0.0f};                  /// @brief The minimum x of cell column 0.
+    float _originY{0.0f};                  /// @brief The minimum y of cell row 0.
+    float _inverseCellSize{0.0f};
+    std::uint32_t _columns{0};
+    std::uint32_t _rows{0};
+    std::vector<std::uint32_t> _cellStarts; /// @brief The offset of each cell's ids in _cellItems, plus a final end offset.
+    std::vector<std::uint32_t> _cellItems;  /// @brief The ids listed in each cell, in ascending order per cell.
+
+    // Private Methods
+
+    /// @brief The column of an x coordinate, clamped to the grid.
+    std::uint32_t Column(const float x) const;
+
+    /// @brief The row of a y coordinate, clamped to the grid.
+    std::uint32_t Row(const float y) const;
+
+    /// @brief Calls visit(id, column, row) for each id listed in the cells a rectangle overlaps.
+    template<typename Visit>
+    void ForEachCell(const Rect& rect, Visit&& visit) const;
+};
+
+} // namespace velecs::math
@@ -11,11 +11,15 @@
 #pragma once
 
 #include "velecs/math/Consts.hpp"
+#include "velecs/math/Swizzle.hpp"
 
+#include <cmath>
+#include <stdexcept>
 #include <string>
-#include <ostream>
 
-#include <glm/vec2.hpp>
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
+    #include <glm/vec2.hpp>
+#endif
 
 namespace velecs::math {
 
@@ -52,32 +56,36 @@ public:
     /// @brief Constructs a Vec2 with the specified coordinates.
     /// @param[in] x The x-coordinate.
     /// @param[in] y The y-coordinate.
-    inline Vec2(const float x, const float y)
+    constexpr Vec2(const float x, const float y)
         : x(x), y(y) {}
 
     /// @brief Copy constructor. Constructs a new Vec2 with the same values as the specified Vec2.
     /// @param[in] other The Vec2 to copy.
-    inline Vec2(const Vec2 &other)
+    constexpr Vec2(const Vec2 &other)
         : x(other.x), y(other.y) {}
     
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
     /// @brief Constructs a Vec2 from a glm::vec2.
     /// @details Creates a new Vec2 object with components initialized from the given glm::vec2.
     ///          This allows for easy conversion from GLM's vector type to the velecs math library.
     /// @param[in] other The glm::vec2 to copy components from.
     inline Vec2(const glm::vec2 &other)
         : x(other.x), y(other.y) {}
+#endif
 
     /// @brief Default deconstructor.
     ~Vec2() = default;
     
     // Public Methods
 
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
     /// @brief Converts the Vec2 to a glm::vec2.
     /// @returns A glm::vec2 with the same components as this Vec2.
     inline operator glm::vec2() const
     {
         return glm::vec2(x, y);
     }
+#endif
 
     /// @brief Assigns the values of another Vec2 object to this Vec2 object.
     /// @param[in] other The other Vec2 object whose values will be assigned to this Vec2 object.
@@ -310,15 +318,8 @@ public:
     /// @returns A string representation of the Vec2.
     std::string ToString() const;
 
-    /// @brief Outputs a Vec2 object to an output stream in a formatted manner.
-    /// @param[in] os The output stream to write to.
-    /// @param[in] vec The Vec2 object to output.
-    /// @return The same output stream, for chaining.
-    inline friend std::ostream& operator<<(std::ostream& os, const Vec2 vec)
-    {
-        os << vec.ToString();
-        return os;
-    }
+    /// @brief Swizzles such as .yx(), .xyy() and .xyxy(); see Swizzle.hpp.
+    VELECS_MATH_SWIZZLES(VELECS_MATH_SWIZZLE_XY, ::velecs::math::Vec3)
 
 protected:
     // Protected Fields
@@ -329,6 +330,19 @@ private:
     // Private Fields
 
     // Private Methods
+
+    /// @brief Reads a component by index in a constant expression.
+    constexpr float Component(const int index) const
+    {
+        return index == 0 ? x : y;
+    }
+
+    /// @brief Builds a V from the components at indices I. Backs the swizzle accessors.
+    template<typename V, int... I>
+    constexpr V Swizzle() const
+    {
+        return V(Component(I)...);
+    }
 };
 
 /// @brief Adds two Vec2 vectors.
@@ -11,11 +11,15 @@
 #pragma once
 
 #include "velecs/math/Consts.hpp"
-#include "velecs/math/Vec4.hpp"
+#include "velecs/math/Swizzle.hpp"
 
-#include <iostream>
+#include <cmath>
+#include <stdexcept>
+#include <string>
 
-#include <glm/vec3.hpp>
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
+    #include <glm/vec3.hpp>
+#endif
 
 namespace velecs::math {
 
@@ -59,20 +63,22 @@ public:
     /// @param[in] x The x-component.
     /// @param[in] y The y-component.
     /// @param[in] z The z-component.
-    inline Vec3(const float x, const float y, const float z)
+    constexpr Vec3(const float x, const float y, const float z)
         : x(x), y(y), z(z) {}
 
     /// @brief Copy constructor. Constructs a new Vec3 with the same values as the specified Vec3.
     /// @param[in] other The Vec3 to copy.
-    inline Vec3(const Vec3 &other)
+    constexpr Vec3(const Vec3 &other)
         : x(other.x), y(other.y), z(other.z) {}
 
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
     /// @brief Constructs a Vec3 from a glm::vec3.
     /// @details Creates a new Vec3 object with components initialized from the given glm::vec3.
     ///          This allows for easy conversion from GLM's vector type to the velecs math library.
     /// @param[in] other The glm::vec3 to copy components from.
     inline Vec3(const glm::vec3 &other)
         : x(other.x), y(other.y), z(other.z) {}
+#endif
 
 
 
@@ -94,28 +100,24 @@ public:
 
     // Public Methods
 
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
     /// @brief Converts the Vec3 to a glm::vec3.
     /// @returns A glm::vec3 with the same components as this Vec3.
     inline operator glm::vec3() const
     {
         return glm::vec3(x, y, z);
     }
+#endif
 
     /// @brief Converts this Vec3 to a homogeneous point (w=1).
     /// @details Creates a Vec4 with the components of this Vec3 and sets w=1.
     /// @returns A Vec4 representing a point in homogeneous coordinates.
-    inline Vec4 ToHomogeneousPoint() const
-    {
-        return Vec4(x, y, z, 1.0f);
-    }
+    Vec4 ToHomogeneousPoint() const;
 
     /// @brief Converts this Vec3 to a homogeneous vector/direction (w=0).
     /// @details Creates a Vec4 with the components of this Vec3 and sets w=0.
     /// @returns A Vec4 representing a vector/direction in homogeneous coordinates.
-    inline Vec4 ToHomogeneousVector() const
-    {
-        return Vec4(x, y, z, 0.0f);
-    }
+    Vec4 ToHomogeneousVector() const;
 
     /// @brief Assigns the values of another Vec3 object to this Vec3 object.
     /// @param[in] other The other Vec3 object whose values will be assigned to this Vec3 object.
@@ -342,6 +344,18 @@ public:
     /// @returns The clamped Vec3.
     static Vec3 Clamp(const Vec3 vec, const Vec3 min, const Vec3 max);
 
+    /// @brief Computes the component-wise minimum of two Vec3s.
+    /// @param a The first Vec3.
+    /// @param b The second Vec3.
+    /// @returns A Vec3 holding the smaller of each pair of components.
+    static Vec3 Min(const Vec3 a, const Vec3 b);
+
+    /// @brief Computes the component-wise maximum of two Vec3s.
+    /// @param a The first Vec3.
+    /// @param b The second Vec3.
+    /// @returns A Vec3 holding the larger of each pair of components.
+    static Vec3 Max(const Vec3 a, const Vec3 b);
+
     /// @brief Computes a linear interpolation between two Vec3s.
     /// @param a The first Vec3.
     /// @param b The second Vec3.
@@ -376,15 +390,8 @@ public:
     /// @returns A string representation of the Vec3.
     std::string ToString() const;
 
-    /// @brief Outputs a Vec3 object to an output stream in a formatted manner.
-    /// @param[in] os The output stream to write to.
-    /// @param[in] vec The Vec3 object to output.
-    /// @return The same output stream, for chaining.
-    inline friend std::ostream& operator<<(std::ostream& os, const Vec3 vec)
-    {
-        os << vec.ToString();
-        return os;
-    }
+    /// @brief Swizzles such as .zx(), .xzy() and .xyzz(); see Swizzle.hpp.
+    VELECS_MATH_SWIZZLES(VELECS_MATH_SWIZZLE_XYZ, ::velecs::math::Vec3)
 
 protected:
     // Protected Fields
@@ -395,6 +402,19 @@ private:
     // Private Fields
 
     // Private Methods
+
+    /// @brief Reads a component by index in a constant expression.
+    constexpr float Component(const int index) const
+    {
+        return index == 0 ? x : index == 1 ? y : z;
+    }
+
+    /// @brief Builds a V from the components at indices I. Backs the swizzle accessors.
+    template<typename V, int... I>
+    constexpr V Swizzle() const
+    {
+        return V(Component(I)...);
+    }
 };
 
 /// @brief Overloads the addition operator to add two Vec3 objects together.
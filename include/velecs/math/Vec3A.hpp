@@ -0,0 +1,440 @@
+/// @file    Vec3A.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 21:36:50
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Consts.hpp"
+#include "velecs/math/Simd.hpp"
+#include "velecs/math/Swizzle.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace velecs::math {
+
+/// @struct Vec3A
+/// @brief A 16-byte aligned Vec3 whose arithmetic runs in a single SSE register.
+///
+/// Vec3 is 12 bytes, so loading it into a register takes shuffles or an overread.
+/// Vec3A pads it to 16 bytes with an ignored fourth lane and mirrors the Vec3 API, so
+/// per-object math can switch types without restructuring. Use Vec3 for tightly packed
+/// storage (vertex data, file formats) and Vec3A for values that are worked on.
+struct alignas(16) Vec3A {
+public:
+    // Enums
+
+    // Public Fields
+
+    static const Vec3A ZERO;         /// @brief A vector with all components set to zero (0, 0, 0).
+    static const Vec3A ONE;          /// @brief A vector with all components set to one (1, 1, 1).
+    static const Vec3A NEG_ONE;      /// @brief A vector with all components set to negative one (-1, -1, -1).
+    static const Vec3A RIGHT;        /// @brief A vector representing the right direction in a right-handed coordinate system (1, 0, 0).
+    static const Vec3A LEFT;         /// @brief A vector representing the left direction in a right-handed coordinate system (-1, 0, 0).
+    static const Vec3A UP;           /// @brief A vector representing the up direction in a right-handed coordinate system (0, 1, 0).
+    static const Vec3A DOWN;         /// @brief A vector representing the down direction in a right-handed coordinate system (0, -1, 0).
+    static const Vec3A FORWARD;      /// @brief A vector representing the forward direction in a right-handed coordinate system (0, 0, -1).
+    static const Vec3A BACKWARD;     /// @brief A vector representing the backward direction in a right-handed coordinate system (0, 0, 1).
+    static const Vec3A POS_INFINITY; /// @brief A vector with all components set to positive infinity.
+    static const Vec3A NEG_INFINITY; /// @brief A vector with all components set to negative infinity.
+    static const Vec3A UNIT;         /// @brief A normalized vector with magnitude equal to 1. Derived from Vec3A::ONE.
+    static const Vec3A I;            /// @brief A unit vector along the x-axis (1, 0, 0).
+    static const Vec3A J;            /// @brief A unit vector along the y-axis (0, 1, 0).
+    static const Vec3A K;            /// @brief A unit vector along the z-axis (0, 0, 1).
+
+    float x; /// @brief The x-component of the vector.
+    float y; /// @brief The y-component of the vector.
+    float z; /// @brief The z-component of the vector.
+    float w; /// @brief Padding lane. Not part of the vector; its value is unspecified.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs a Vec3A with specified x, y, and z components.
+    /// @param[in] x The x-component.
+    /// @param[in] y The y-component.
+    /// @param[in] z The z-component.
+    inline Vec3A(const float x, const float y, const float z)
+        : x(x), y(y), z(z), w(0.0f) {}
+
+    /// @brief Constructs a Vec3A from the lanes of a register; lane 3 becomes padding.
+    /// @param[in] lanes The register holding x, y, z in lanes 0-2.
+    inline explicit Vec3A(const Float4 lanes)
+    {
+        lanes.StoreAligned(&x);
+    }
+
+    /// @brief Constructs a Vec3A from a packed Vec3.
+    /// @param[in] vec The Vec3 to copy components from.
+    inline explicit Vec3A(const Vec3& vec)
+        : x(vec.x), y(vec.y), z(vec.z), w(0.0f) {}
+
+    /// @brief Constructs a Vec3A from the x, y, and z components of a Vec4, discarding w.
+    /// @param[in] vec The Vec4 to copy components from.
+    inline explicit Vec3A(const Vec4& vec)
+        : x(vec.x), y(vec.y), z(vec.z), w(0.0f) {}
+
+    /// @brief Default destructor.
+    ~Vec3A() = default;
+
+    // Public Methods
+
+    /// @brief Loads the vector into a register. Lane 3 holds the padding.
+    inline Float4 Lanes() const
+    {
+        return Float4::LoadAligned(&x);
+    }
+
+    /// @brief Converts this Vec3A to a packed Vec3.
+    inline Vec3 ToVec3() const
+    {
+        return Vec3(x, y, z);
+    }
+
+    /// @brief Converts this Vec3A to a packed Vec3.
+    inline explicit operator Vec3() const { return ToVec3(); }
+
+    /// @brief Converts this Vec3A to a homogeneous point (w=1).
+    /// @returns A Vec4 representing a point in homogeneous coordinates.
+    inline Vec4 ToHomogeneousPoint() const
+    {
+        return Vec4(x, y, z, 1.0f);
+    }
+
+    /// @brief Converts this Vec3A to a homogeneous vector/direction (w=0).
+    /// @returns A Vec4 representing a vector/direction in homogeneous coordinates.
+    inline Vec4 ToHomogeneousVector() const
+    {
+        return Vec4(x, y, z, 0.0f);
+    }
+
+    /// @brief Checks if this Vec3A is equal to the specified Vec3A. The padding lane is ignored.
+    /// @param[in] other The Vec3A to compare with.
+    /// @return True if the Vec3As are equal, false otherwise.
+    inline bool operator==(const Vec3A other) const
+    {
+        return (Float4::MoveMask(Float4::Equal(Lanes(), other.Lanes())) & 0x7) == 0x7;
+    }
+
+    /// @brief Checks if this Vec3A is not equal to the specified Vec3A. The padding lane is ignored.
+    /// @param[in] other The Vec3A to compare with.
+    /// @return True if the Vec3As are not equal, false otherwise.
+    inline bool operator!=(const Vec3A other) const
+    {
+        return !(*this == other);
+    }
+
+    /// @brief Negates this Vec3A.
+    /// @return A new Vec3A that is the negation of this Vec3A.
+    inline Vec3A operator-() const
+    {
+        return Vec3A(-Lanes());
+    }
+
+    /// @brief Adds another Vec3A to this Vec3A.
+    /// @param[in] other The other Vec3A to add to this Vec3A.
+    /// @returns A reference to this Vec3A after the addition.
+    inline Vec3A& operator+=(const Vec3A other)
+    {
+        (Lanes() + other.Lanes()).StoreAligned(&x);
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    /// @brief Subtracts another Vec3A from this Vec3A.
+    /// @param[in] other The other Vec3A to subtract from this Vec3A.
+    /// @returns A reference to this Vec3A after the subtraction.
+    inline Vec3A& operator-=(const Vec3A other)
+    {
+        (Lanes() - other.Lanes()).StoreAligned(&x);
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    /// @brief Multiplies this Vec3A by a scalar.
+    /// @param[in] scalar The scalar value to multiply this Vec3A by.
+    /// @returns A reference to this Vec3A after the multiplication.
+    inline Vec3A& operator*=(const float scalar)
+    {
+        (Lanes() * Float4(scalar)).StoreAligned(&x);
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    /// @brief Divides this Vec3A by a scalar.
+    /// @param[in] scalar The scalar value to divide this Vec3A by.
+    /// @returns A reference to this Vec3A after the division.
+    inline Vec3A& operator/=(const float scalar)
+    {
+        (Lanes() / Float4(scalar)).StoreAligned(&x);
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    /// @brief Provides array-like access to vector components.
+    /// @param index The index of the component to access (0-2).
+    /// @returns A reference to the component at the specified index.
+    /// @throws std::out_of_range if the index is out of bounds (not 0-2).
+    inline float& operator[](int index)
+    {
+        if (index >= 0 && index < 3) {
+            return (&x)[index]; // Access array of 3 floats starting at address of x
+        }
+        throw std::out_of_range("Vec3A index out of range");
+    }
+
+    /// @brief Provides const array-like access to vector components.
+    /// @param index The index of the component to access (0-2).
+    /// @returns A const reference to the component at the specified index.
+    /// @throws std::out_of_range if the index is out of bounds (not 0-2).
+    inline const float& operator[](int index) const
+    {
+        if (index >= 0 && index < 3) {
+            return (&x)[index]; // Access array of 3 floats starting at address of x
+        }
+        throw std::out_of_range("Vec3A index out of range");
+    }
+
+    /// @brief Computes the L0 norm of this Vec3A, which is the count of non-zero components.
+    /// @returns The L0 norm.
+    inline unsigned int L0Norm() const
+    {
+        const int zeros = Float4::MoveMask(Float4::Equal(Lanes(), Float4(0.0f)));
+        return 3u - static_cast<unsigned int>((zeros & 1) + ((zeros >> 1) & 1) + ((zeros >> 2) & 1));
+    }
+
+    /// @brief Computes the L1 norm of this Vec3A, which is the sum of the absolute values of the components.
+    /// @returns The L1 norm.
+    inline float L1Norm() const
+    {
+        return Sum3(Float4::Abs(Lanes()));
+    }
+
+    /// @brief Computes the L2 norm (magnitude) of this Vec3A.
+    /// @returns The L2 norm.
+    inline float L2Norm() const
+    {
+        return std::sqrt(Dot(*this, *this));
+    }
+
+    /// @brief Computes the L∞ norm (maximum absolute value) of this Vec3A.
+    /// @returns The maximum absolute value of any component.
+    inline float LInfNorm() const
+    {
+        const Float4 a = Float4::Abs(Lanes());
+        return Float4::Max(Float4::Max(a, Float4::Shuffle<1, 1, 1, 1>(a)), Float4::Shuffle<2, 2, 2, 2>(a)).First();
+    }
+
+    /// @brief Alias for L2Norm, computes the L2 norm (magnitude) of this Vec3A.
+    /// @returns The L2 norm.
+    inline float Norm() const { return L2Norm(); }
+
+    /// @brief Alias for L2Norm, computes the L2 norm (magnitude) of this Vec3A.
+    /// @returns The L2 norm.
+    inline float Magnitude() const { return L2Norm(); }
+
+    /// @brief Normalizes this Vec3A, making its magnitude equal to 1.
+    /// @returns The normalized Vec3A.
+    /// @note If the original magnitude is 0, returns the zero vector.
+    inline Vec3A Normalize() const
+    {
+        const float magnitude = L2Norm();
+        return (magnitude != 0) ? Vec3A(Lanes() * Float4(1.0f / magnitude)) : Vec3A::ZERO;
+    }
+
+    /// @brief Projects the vector onto the i basis vector (x-axis).
+    /// @returns A vector along the x-axis with the same x component as the original vector.
+    inline Vec3A ProjOntoI() const
+    {
+        return Vec3A(this->x, 0.0f, 0.0f);
+    }
+
+    /// @brief Projects the vector onto the j basis vector (y-axis).
+    /// @returns A vector along the y-axis with the same y component as the original vector.
+    inline Vec3A ProjOntoJ() const
+    {
+        return Vec3A(0.0f, this->y, 0.0f);
+    }
+
+    /// @brief Projects the vector onto the k basis vector (z-axis).
+    /// @returns A vector along the z-axis with the same z component as the original vector.
+    inline Vec3A ProjOntoK() const
+    {
+        return Vec3A(0.0f, 0.0f, this->z);
+    }
+
+    /// @brief Computes the dot product of two Vec3A objects.
+    /// @param a The first Vec3A object.
+    /// @param b The second Vec3A object.
+    /// @returns The dot product of a and b.
+    inline static float Dot(const Vec3A a, const Vec3A b)
+    {
+        return Sum3(a.Lanes() * b.Lanes());
+    }
+
+    /// @brief Computes the cross product of two Vec3A objects.
+    /// @param a The first Vec3A object.
+    /// @param b The second Vec3A object.
+    /// @returns The cross product of a and b.
+    inline static Vec3A Cross(const Vec3A a, const Vec3A b)
+    {
+        // a.yzx * b.zxy - a.zxy * b.yzx
+        const Float4 la = a.Lanes();
+        const Float4 lb = b.Lanes();
+        return Vec3A
+        (
+            Float4::Shuffle<1, 2, 0, 3>(la) * Float4::Shuffle<2, 0, 1, 3>(lb) -
+            Float4::Shuffle<2, 0, 1, 3>(la) * Float4::Shuffle<1, 2, 0, 3>(lb)
+        );
+    }
+
+    /// @brief Computes the Hadamard product of two Vec3A objects.
+    /// @param a The first Vec3A object.
+    /// @param b The second Vec3A object.
+    /// @returns The Hadamard product of a and b.
+    inline static Vec3A Hadamard(const Vec3A a, const Vec3A b)
+    {
+        return Vec3A(a.Lanes() * b.Lanes());
+    }
+
+    /// @brief Alias for Hadamard, computes the element-wise multiplication of two Vec3As.
+    /// @param a The first Vec3A.
+    /// @param b The second Vec3A.
+    /// @returns The element-wise multiplication of the two Vec3As.
+    inline static Vec3A ElementwiseMultiply(const Vec3A a, const Vec3A b) { return Hadamard(a, b); }
+
+    /// @brief Clamps the components of a Vec3A between the corresponding components of two other Vec3As.
+    /// @param vec The Vec3A to clamp.
+    /// @param min The Vec3A representing the minimum values.
+    /// @param max The Vec3A representing the maximum values.
+    /// @returns The clamped Vec3A.
+    inline static Vec3A Clamp(const Vec3A vec, const Vec3A min, const Vec3A max)
+    {
+        return Vec3A(Float4::Min(Float4::Max(vec.Lanes(), min.Lanes()), max.Lanes()));
+    }
+
+    /// @brief Computes a linear interpolation between two Vec3As.
+    /// @param a The first Vec3A.
+    /// @param b The second Vec3A.
+    /// @param t The interpolation factor. A value of 0 returns a, and a value of 1 returns b.
+    /// @returns The interpolated Vec3A.
+    inline static Vec3A Lerp(const Vec3A a, const Vec3A b, float t)
+    {
+        const Float4 la = a.Lanes();
+        return Vec3A(la + Float4(t) * (b.Lanes() - la));
+    }
+
+    /// @brief Computes the angle between two vectors in radians.
+    /// @param a The first vector.
+    /// @param b The second vector.
+    /// @returns The angle between the vectors in radians.
+    static float Angle(const Vec3A a, const Vec3A b);
+
+    /// @brief Computes the angle between two vectors in degrees.
+    /// @param a The first vector.
+    /// @param b The second vector.
+    /// @returns The angle between the vectors in degrees.
+    inline static float AngleDeg(const Vec3A a, const Vec3A b)
+    {
+        return Angle(a, b) * RAD_TO_DEG;  // convert radians to degrees
+    }
+
+    /// @brief Converts the Vec3A to a string representation.
+    /// @returns A string representation of the Vec3A.
+    std::string ToString() const;
+
+    /// @brief Swizzles such as .zx(), .xzy() and .xyzz(); see Swizzle.hpp.
+    /// @details Three component swizzles return a Vec3A and compile to a single shuffle.
+    VELECS_MATH_SWIZZLES(VELECS_MATH_SWIZZLE_XYZ, ::velecs::math::Vec3A)
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+
+    /// @brief Reads a component by index.
+    constexpr float Component(const int index) const
+    {
+        return index == 0 ? x : index == 1 ? y : z;
+    }
+
+    /// @brief Builds a V from the components at indices I. Backs the swizzle accessors.
+    template<typename V, int... I>
+    inline V Swizzle() const
+    {
+        if constexpr (std::is_same_v<V, Vec3A>) {
+            return Vec3A(Float4::Shuffle<I..., 3>(Lanes()));
+        } else {
+            return V(Component(I)...);
+        }
+    }
+
+    /// @brief Sums lanes 0-2 of a register, ignoring the padding lane.
+    inline static float Sum3(const Float4 lanes)
+    {
+        return (lanes + Float4::Shuffle<1, 1, 1, 1>(lanes) + Float4::Shuffle<2, 2, 2, 2>(lanes)).First();
+    }
+};
+
+static_assert(sizeof(Vec3A) == 16 && alignof(Vec3A) == 16, "Vec3A must fill exactly one SSE register");
+
+/// @brief Adds two Vec3A objects together.
+/// @param[in] lhs The left-hand side Vec3A operand.
+/// @param[in] rhs The right-hand side Vec3A operand.
+/// @returns The component-wise sum.
+inline Vec3A operator+(const Vec3A lhs, const Vec3A rhs)
+{
+    return Vec3A(lhs.Lanes() + rhs.Lanes());
+}
+
+/// @brief Subtracts one Vec3A from another.
+/// @param[in] lhs The left-hand side Vec3A operand.
+/// @param[in] rhs The right-hand side Vec3A operand.
+/// @returns The component-wise difference.
+inline Vec3A operator-(const Vec3A lhs, const Vec3A rhs)
+{
+    return Vec3A(lhs.Lanes() - rhs.Lanes());
+}
+
+/// @brief Multiplies a Vec3A by a scalar value.
+/// @param[in] lhs The Vec3A to be multiplied.
+/// @param[in] rhs The scalar value by which to multiply the Vec3A.
+/// @returns The scaled Vec3A.
+inline Vec3A operator*(const Vec3A lhs, const float rhs)
+{
+    return Vec3A(lhs.Lanes() * Float4(rhs));
+}
+
+/// @brief Divides a Vec3A by a scalar.
+/// @param[in] lhs The Vec3A operand.
+/// @param[in] rhs The scalar operand.
+/// @returns The quotient of the Vec3A and scalar operands.
+/// @throws std::runtime_error if rhs is zero, as with Vec3.
+inline Vec3A operator/(const Vec3A lhs, const float rhs)
+{
+    if (rhs == 0)
+    {
+        throw std::runtime_error("Division by zero error");
+    }
+    return Vec3A(lhs.Lanes() / Float4(rhs));
+}
+
+/// @brief Multiplies a scalar value by a Vec3A, so that multiplication is commutative.
+/// @param[in] lhs The scalar value by which to multiply the Vec3A.
+/// @param[in] rhs The Vec3A to be multiplied.
+/// @returns The scaled Vec3A.
+inline Vec3A operator*(const float lhs, const Vec3A rhs)
+{
+    return rhs * lhs;
+}
+
+} // namespace velecs::math
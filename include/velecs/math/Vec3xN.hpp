@@ -0,0 +1,284 @@
+/// @file    Vec3xN.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 21:03:18
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Simd.hpp"
+
+#include <cstdint>
+
+namespace velecs::math {
+
+/// @struct Vec3xN
+/// @brief A packet of Vec3s stored as one lane register per component (AoSoA).
+///
+/// Lane i of x, y and z together form the i-th vector of the packet. The interface mirrors
+/// Vec3, with scalar results (Dot, L2Norm, ...) returned as a lane type instead of a float,
+/// so kernels can be written once in "wide" form and run 4 or 8 vectors per instruction.
+/// Use the Vec3x4 and Vec3x8 aliases rather than naming the template directly.
+/// @tparam F The lane type, Float4 or Float8.
+template<typename F>
+struct Vec3xN {
+public:
+    // Enums
+
+    // Public Fields
+
+    static constexpr int WIDTH = F::WIDTH; /// @brief The number of vectors in the packet.
+
+    F x; /// @brief The x-components of the vectors.
+    F y; /// @brief The y-components of the vectors.
+    F z; /// @brief The z-components of the vectors.
+
+    // Constructors and Destructors
+
+    /// @brief Constructs with uninitialized lanes.
+    Vec3xN() = default;
+
+    /// @brief Constructs from per-component lanes.
+    inline Vec3xN(const F x, const F y, const F z)
+        : x(x), y(y), z(z) {}
+
+    /// @brief Broadcasts one vector to every lane.
+    inline explicit Vec3xN(const Vec3& vec)
+        : x(vec.x), y(vec.y), z(vec.z) {}
+
+    /// @brief Default destructor.
+    ~Vec3xN() = default;
+
+    // Public Methods
+
+    /// @brief Loads WIDTH consecutive vectors from an array of Vec3.
+    /// @param src Pointer to the first of WIDTH vectors.
+    static inline Vec3xN Load(const Vec3* src)
+    {
+        float xs[WIDTH], ys[WIDTH], zs[WIDTH];
+        for (int i = 0; i < WIDTH; ++i) {
+            xs[i] = src[i].x;
+            ys[i] = src[i].y;
+            zs[i] = src[i].z;
+        }
+        return Vec3xN(F::Load(xs), F::Load(ys), F::Load(zs));
+    }
+
+    /// @brief Loads WIDTH vectors from arbitrary positions of an array of Vec3.
+    /// @param base The array to gather from.
+    /// @param indices WIDTH indices into base.
+    static inline Vec3xN Gather(const Vec3* base, const std::uint32_t* indices)
+    {
+        float xs[WIDTH], ys[WIDTH], zs[WIDTH];
+        for (int i = 0; i < WIDTH; ++i) {
+            const Vec3& v = base[indices[i]];
+            xs[i] = v.x;
+            ys[i] = v.y;
+            zs[i] = v.z;
+        }
+        return Vec3xN(F::Load(xs), F::Load(ys), F::Load(zs));
+    }
+
+    /// @brief Stores the packet to WIDTH consecutive vectors of an array of Vec3.
+    /// @param dst Pointer to the first of WIDTH vectors.
+    inline void Store(Vec3* dst) const
+    {
+        float xs[WIDTH], ys[WIDTH], zs[WIDTH];
+        x.Store(xs);
+        y.Store(ys);
+        z.Store(zs);
+        for (int i = 0; i < WIDTH; ++i) {
+            dst[i] = Vec3(xs[i], ys[i], zs[i]);
+        }
+    }
+
+    /// @brief Stores the packet to arbitrary positions of an array of Vec3.
+    /// @param base The array to scatter into.
+    /// @param indices WIDTH indices into base. Duplicate indices keep the highest lane.
+    inline void Scatter(Vec3* base, const std::uint32_t* indices) const
+    {
+        float xs[WIDTH], ys[WIDTH], zs[WIDTH];
+        x.Store(xs);
+        y.Store(ys);
+        z.Store(zs);
+        for (int i = 0; i < WIDTH; ++i) {
+            base[indices[i]] = Vec3(xs[i], ys[i], zs[i]);
+        }
+    }
+
+    /// @brief Extracts one vector. Intended for tails and debugging, not hot loops.
+    /// @param lane The index of the vector, in [0, WIDTH).
+    inline Vec3 Get(const int lane) const
+    {
+        return Vec3(x[lane], y[lane], z[lane]);
+    }
+
+    inline Vec3xN operator-() const
+    {
+        return Vec3xN(-x, -y, -z);
+    }
+
+    inline Vec3xN& operator+=(const Vec3xN& other)
+    {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    inline Vec3xN& operator-=(const Vec3xN& other)
+    {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    inline Vec3xN& operator*=(const F scalar)
+    {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        return *this; // Return ref to allow chaining assignment operations
+    }
+
+    inline Vec3xN& operator/=(const F scalar)
+    {
+        return *this *= F(1.0f) / scalar;
+    }
+
+    /// @brief Computes the L2 norm (magnitude) of each vector.
+    inline F L2Norm() const
+    {
+        return F::Sqrt(Dot(*this, *this));
+    }
+
+    /// @brief Alias for L2Norm.
+    inline F Magnitude() const { return L2Norm(); }
+
+    /// @brief Normalizes each vector, making its magnitude equal to 1.
+    /// @returns The normalized vectors.
+    /// @note Lanes with a magnitude of 0 become the zero vector, as with Vec3::Normalize.
+    inline Vec3xN Normalize() const
+    {
+        const F magnitude = L2Norm();
+        const F zero(0.0f);
+        const F isZero = F::Equal(magnitude, zero);
+        const F inv = F::Select(isZero, zero, F(1.0f) / magnitude);
+        return Vec3xN(x * inv, y * inv, z * inv);
+    }
+
+    /// @brief Computes the per-lane dot product of two packets.
+    static inline F Dot(const Vec3xN& a, const Vec3xN& b)
+    {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    /// @brief Computes the per-lane cross product of two packets.
+    static inline Vec3xN Cross(const Vec3xN& a, const Vec3xN& b)
+    {
+        return Vec3xN
+        (
+            a.y * b.z - a.z * b.y,
+            a.z * b.x - a.x * b.z,
+            a.x * b.y - a.y * b.x
+        );
+    }
+
+    /// @brief Computes the per-lane Hadamard product of two packets.
+    static inline Vec3xN Hadamard(const Vec3xN& a, const Vec3xN& b)
+    {
+        return Vec3xN(a.x * b.x, a.y * b.y, a.z * b.z);
+    }
+
+    /// @brief Clamps each component between the corresponding components of min and max.
+    static inline Vec3xN Clamp(const Vec3xN& vec, const Vec3xN& min, const Vec3xN& max)
+    {
+        return Vec3xN
+        (
+            F::Min(F::Max(vec.x, min.x), max.x),
+            F::Min(F::Max(vec.y, min.y), max.y),
+            F::Min(F::Max(vec.z, min.z), max.z)
+        );
+    }
+
+    /// @brief Computes the per-component minimum of two packets.
+    static inline Vec3xN Min(const Vec3xN& a, const Vec3xN& b)
+    {
+        return Vec3xN(F::Min(a.x, b.x), F::Min(a.y, b.y), F::Min(a.z, b.z));
+    }
+
+    /// @brief Computes the per-component maximum of two packets.
+    static inline Vec3xN Max(const Vec3xN& a, const Vec3xN& b)
+    {
+        return Vec3xN(F::Max(a.x, b.x), F::Max(a.y, b.y), F::Max(a.z, b.z));
+    }
+
+    /// @brief Computes a per-lane linear interpolation between two packets.
+    /// @param t The interpolation factor per lane; 0 returns a, 1 returns b.
+    static inline Vec3xN Lerp(const Vec3xN& a, const Vec3xN& b, const F t)
+    {
+        return Vec3xN
+        (
+            a.x + t * (b.x - a.x),
+            a.y + t * (b.y - a.y),
+            a.z + t * (b.z - a.z)
+        );
+    }
+
+    /// @brief Picks vectors from a where mask is set, otherwise from b.
+    static inline Vec3xN Select(const F mask, const Vec3xN& a, const Vec3xN& b)
+    {
+        return Vec3xN(F::Select(mask, a.x, b.x), F::Select(mask, a.y, b.y), F::Select(mask, a.z, b.z));
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+template<typename F>
+inline Vec3xN<F> operator+(const Vec3xN<F>& lhs, const Vec3xN<F>& rhs)
+{
+    return Vec3xN<F>(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z);
+}
+
+template<typename F>
+inline Vec3xN<F> operator-(const Vec3xN<F>& lhs, const Vec3xN<F>& rhs)
+{
+    return Vec3xN<F>(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z);
+}
+
+template<typename F>
+inline Vec3xN<F> operator*(const Vec3xN<F>& lhs, const F rhs)
+{
+    return Vec3xN<F>(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs);
+}
+
+template<typename F>
+inline Vec3xN<F> operator*(const F lhs, const Vec3xN<F>& rhs)
+{
+    return rhs * lhs;
+}
+
+template<typename F>
+inline Vec3xN<F> operator/(const Vec3xN<F>& lhs, const F rhs)
+{
+    return lhs * (F(1.0f) / rhs);
+}
+
+using Vec3x4 = Vec3xN<Float4>; /// @brief Four Vec3s in SSE lanes.
+using Vec3x8 = Vec3xN<Float8>; /// @brief Eight Vec3s in AVX lanes.
+
+} // namespace velecs::math
@@ -11,10 +11,15 @@
 #pragma once
 
 #include "velecs/math/Consts.hpp"
+#include "velecs/math/Swizzle.hpp"
 
-#include <iostream>
+#include <cmath>
+#include <stdexcept>
+#include <string>
 
-#include <glm/vec4.hpp>
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
+    #include <glm/vec4.hpp>
+#endif
 
 namespace velecs::math {
 
@@ -62,19 +67,21 @@ public:
     /// @param[in] y The y-component.
     /// @param[in] z The z-component.
     /// @param[in] w The w-component.
-    inline Vec4(const float x, const float y, const float z, const float w)
+    constexpr Vec4(const float x, const float y, const float z, const float w)
         : x(x), y(y), z(z), w(w) {}
 
     /// @brief Copy constructor. Constructs a new Vec4 with the same values as the specified Vec4.
     /// @param[in] other The Vec4 to copy.
-    inline Vec4(const Vec4& other)
+    constexpr Vec4(const Vec4& other)
         : x(other.x), y(other.y), z(other.z), w(other.w) {}
 
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
     /// @brief Constructs a Vec4 from a glm::vec4.
     /// @details Creates a Vec4 with components initialized from the given glm::vec4.
     /// @param[in] vec The glm::vec4 to convert from.
     inline Vec4(const glm::vec4& other)
         : x(other.x), y(other.y), z(other.z), w(other.w) {}
+#endif
 
 
 
@@ -124,12 +131,14 @@ public:
 
     // Public Methods
 
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
     /// @brief Converts the Vec4 to a glm::vec4.
     /// @returns A glm::vec4 with the same components as this Vec4.
     inline operator glm::vec4() const
     {
         return glm::vec4(x, y, z, w);
     }
+#endif
 
     /// @brief Creates a point in homogeneous coordinates (w=1).
     /// @details This static factory method creates a Vec4 representing a point in 3D space
@@ -299,7 +308,8 @@ public:
     /// @brief Converts the homogeneous coordinates to 3D Cartesian coordinates without safety checks.
     /// @details Extracts just the xyz components without performing homogeneous division.
     /// @returns A Vec3 containing the xyz components.
-    Vec3 XYZ() const;
+    template<typename V = Vec3>
+    constexpr V XYZ() const { return xyz<V>(); }
 
     /// @brief Converts this Vec4 to a point (w=1) with the same effective spatial coordinates.
     /// @details If w is already non-zero, performs homogeneous division to normalize w to 1.
@@ -502,15 +512,8 @@ public:
     /// @returns A string representation of the Vec4.
     std::string ToString() const;
 
-    /// @brief Outputs a Vec4 object to an output stream in a formatted manner.
-    /// @param[in] os The output stream to write to.
-    /// @param[in] vec The Vec4 object to output.
-    /// @return The same output stream, for chaining.
-    inline friend std::ostream& operator<<(std::ostream& os, const Vec4 vec)
-    {
-        os << vec.ToString();
-        return os;
-    }
+    /// @brief Swizzles such as .ww(), .xyz() and .wzyx(); see Swizzle.hpp.
+    VELECS_MATH_SWIZZLES(VELECS_MATH_SWIZZLE_XYZW, ::velecs::math::Vec3)
 
 protected:
     // Protected Fields
@@ -521,6 +524,19 @@ private:
     // Private Fields
 
     // Private Methods
+
+    /// @brief Reads a component by index in a constant expression.
+    constexpr float Component(const int index) const
+    {
+        return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
+    }
+
+    /// @brief Builds a V from the components at indices I. Backs the swizzle accessors.
+    template<typename V, int... I>
+    constexpr V Swizzle() const
+    {
+        return V(Component(I)...);
+    }
 };
 
 /// @brief Overloads the addition operator to add two Vec4 objects together.
@@ -0,0 +1,45 @@
+/// @file    Aabb.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 00:13:02
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Aabb.hpp"
+#include "velecs/math/Consts.hpp"
+
+#include <sstream>
+
+namespace velecs::math {
+
+// Public Fields
+
+const Aabb Aabb::EMPTY
+{
+    Vec3(FLOAT_POS_INFINITY, FLOAT_POS_INFINITY, FLOAT_POS_INFINITY),
+    Vec3(FLOAT_NEG_INFINITY, FLOAT_NEG_INFINITY, FLOAT_NEG_INFINITY)
+};
+
+// Constructors and Destructors
+
+// Public Methods
+
+std::string Aabb::ToString() const
+{
+    std::ostringstream oss;
+    oss << '[' << min.ToString() << ", " << max.ToString() << ']';
+    return oss.str();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::math
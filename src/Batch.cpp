@@ -0,0 +1,456 @@
+/// @file    Batch.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 00:21:30
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Batch.hpp"
+#include "velecs/math/Vec2.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+#include "velecs/math/Quat.hpp"
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Point3.hpp"
+#include "velecs/math/Dir3.hpp"
+#include "velecs/math/Vec3xN.hpp"
+#include "velecs/math/QuatxN.hpp"
+#include "velecs/math/Mat4xN.hpp"
+#include "velecs/math/Profile.hpp"
+
+#include "detail/WorkerPool.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace velecs::math {
+
+namespace {
+
+/// @brief Elements per work item when running in parallel.
+constexpr std::size_t GRAIN = 4096;
+
+constexpr std::size_t WIDTH = Float4::WIDTH;
+
+void RequireOutput(const bool ok, const char* message)
+{
+    if (!ok) throw std::invalid_argument(message);
+}
+
+/// @brief Calls kernel(begin, end) over [0, count), split across the pool if requested.
+template<typename Kernel>
+void Run(const std::size_t count, const BatchExecution execution, Kernel&& kernel)
+{
+    if (execution == BatchExecution::Parallel) {
+        detail::WorkerPool::Shared().ParallelFor(count, GRAIN, kernel);
+    }
+    else if (count > 0) {
+        kernel(std::size_t(0), count);
+    }
+}
+
+/// @brief Deinterleaves four N-component vectors into one lane register per component.
+template<int N, typename V>
+inline void LoadComponents(const V* src, Float4 (&c)[N])
+{
+    float lanes[N][WIDTH];
+    for (std::size_t i = 0; i < WIDTH; ++i) {
+        const float* v = &src[i].x;
+        for (int k = 0; k < N; ++k) {
+            lanes[k][i] = v[k];
+        }
+    }
+    for (int k = 0; k < N; ++k) {
+        c[k] = Float4::Load(lanes[k]);
+    }
+}
+
+/// @brief Interleaves one lane register per component back into four N-component vectors.
+template<int N, typename V>
+inline void StoreComponents(const Float4 (&c)[N], V* dst)
+{
+    float lanes[N][WIDTH];
+    for (int k = 0; k < N; ++k) {
+        c[k].Store(lanes[k]);
+    }
+    for (std::size_t i = 0; i < WIDTH; ++i) {
+        float* v = &dst[i].x;
+        for (int k = 0; k < N; ++k) {
+            v[k] = lanes[k][i];
+        }
+    }
+}
+
+template<int N, typename V>
+void NormalizeKernel(const V* src, V* dst, const std::size_t count)
+{
+    static_assert(sizeof(V) == N * sizeof(float), "Vector type must be N tightly packed floats");
+
+    std::size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        Float4 c[N];
+        LoadComponents<N>(src + i, c);
+        Float4 sumSquares = c[0] * c[0];
+        for (int k = 1; k < N; ++k) {
+            sumSquares += c[k] * c[k];
+        }
+        const Float4 magnitude = Float4::Sqrt(sumSquares);
+        const Float4 zero(0.0f);
+        const Float4 inv = Float4::Select(Float4::Equal(magnitude, zero), zero, Float4(1.0f) / magnitude);
+        for (int k = 0; k < N; ++k) {
+            c[k] *= inv;
+        }
+        StoreComponents<N>(c, dst + i);
+    }
+    for (; i < count; ++i) {
+        dst[i] = src[i].Normalize();
+    }
+}
+
+template<int N, typename V>
+void ClampKernel(const V* src, const V& min, const V& max, V* dst, const std::size_t count)
+{
+    static_assert(sizeof(V) == N * sizeof(float), "Vector type must be N tightly packed floats");
+
+    Float4 lo[N], hi[N];
+    for (int k = 0; k < N; ++k) {
+        lo[k] = Float4((&min.x)[k]);
+        hi[k] = Float4((&max.x)[k]);
+    }
+
+    std::size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        Float4 c[N];
+        LoadComponents<N>(src + i, c);
+        for (int k = 0; k < N; ++k) {
+            c[k] = Float4::Min(Float4::Max(c[k], lo[k]), hi[k]);
+        }
+        StoreComponents<N>(c, dst + i);
+    }
+    for (; i < count; ++i) {
+        dst[i] = V::Clamp(src[i], min, max);
+    }
+}
+
+/// @brief Lerps two arrays of floats. Component-wise, so vectors of any size are just floats.
+void LerpFloats(const float* a, const float* b, const float t, float* dst, const std::size_t count)
+{
+    const Float4 tt(t);
+    std::size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        const Float4 va = Float4::Load(a + i);
+        const Float4 vb = Float4::Load(b + i);
+        (va + tt * (vb - va)).Store(dst + i);
+    }
+    for (; i < count; ++i) {
+        dst[i] = a[i] + t * (b[i] - a[i]);
+    }
+}
+
+template<typename V>
+void LerpVectors(Span<const V> a, Span<const V> b, const float t, Span<V> out, const BatchExecution execution)
+{
+    constexpr std::size_t N = sizeof(V) / sizeof(float);
+    RequireOutput(a.size() == b.size(), "LerpMany input spans differ in size");
+    RequireOutput(out.size() >= a.size(), "LerpMany output span is smaller than the input");
+
+    const float* pa = &a.data()->x;
+    const float* pb = &b.data()->x;
+    float* po = &out.data()->x;
+    Run(a.size(), execution, [=](const std::size_t begin, const std::size_t end) {
+        LerpFloats(pa + begin * N, pb + begin * N, t, po + begin * N, (end - begin) * N);
+    });
+}
+
+/// @brief Scalar counterpart of QuatxN::Normalize.
+inline Quat NormalizeQuat(const float x, const float y, const float z, const float w)
+{
+    const float magnitude = std::sqrt(x * x + y * y + z * z + w * w);
+    if (magnitude == 0.0f) return Quat::IDENTITY;
+    const float inv = 1.0f / magnitude;
+    return Quat(x * inv, y * inv, z * inv, w * inv);
+}
+
+} // namespace
+
+// Public Methods
+
+void TransformPointsMany(const Mat4& mat, Span<const Vec3> points, Span<Vec3> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("TransformPointsMany", points.size());
+
+    RequireOutput(out.size() >= points.size(), "TransformPointsMany output span is smaller than the input");
+
+    const Vec3* src = points.data();
+    Vec3* dst = out.data();
+    Run(points.size(), execution, [&mat, src, dst](const std::size_t begin, const std::size_t end) {
+        const Mat4x4 m(mat);
+        std::size_t i = begin;
+        for (; i + WIDTH <= end; i += WIDTH) {
+            m.TransformPoint(Vec3x4::Load(src + i)).Store(dst + i);
+        }
+        for (; i < end; ++i) {
+            dst[i] = (mat * Point3(src[i])).ToVec3();
+        }
+    });
+}
+
+void TransformDirectionsMany(const Mat4& mat, Span<const Vec3> directions, Span<Vec3> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("TransformDirectionsMany", directions.size());
+
+    RequireOutput(out.size() >= directions.size(), "TransformDirectionsMany output span is smaller than the input");
+
+    const Vec3* src = directions.data();
+    Vec3* dst = out.data();
+    Run(directions.size(), execution, [&mat, src, dst](const std::size_t begin, const std::size_t end) {
+        const Mat4x4 m(mat);
+        std::size_t i = begin;
+        for (; i + WIDTH <= end; i += WIDTH) {
+            m.TransformDirection(Vec3x4::Load(src + i)).Store(dst + i);
+        }
+        for (; i < end; ++i) {
+            dst[i] = (mat * Dir3(src[i])).ToVec3();
+        }
+    });
+}
+
+void TransformMany(const Mat4& mat, Span<const Vec4> vectors, Span<Vec4> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("TransformMany", vectors.size());
+
+    RequireOutput(out.size() >= vectors.size(), "TransformMany output span is smaller than the input");
+
+    const Vec4* src = vectors.data();
+    Vec4* dst = out.data();
+    Run(vectors.size(), execution, [&mat, src, dst](const std::size_t begin, const std::size_t end) {
+        // A Vec4 fills a register on its own, so work on whole columns instead of transposing.
+        const Float4 c0 = Float4::Load(&mat.internal_mat[0][0]);
+        const Float4 c1 = Float4::Load(&mat.internal_mat[1][0]);
+        const Float4 c2 = Float4::Load(&mat.internal_mat[2][0]);
+        const Float4 c3 = Float4::Load(&mat.internal_mat[3][0]);
+        for (std::size_t i = begin; i < end; ++i) {
+            const Vec4& v = src[i];
+            const Float4 r = c0 * Float4(v.x) + c1 * Float4(v.y) + c2 * Float4(v.z) + c3 * Float4(v.w);
+            r.Store(&dst[i].x);
+        }
+    });
+}
+
+void TransformMany(const Mat4& mat, Span<const Mat4> matrices, Span<Mat4> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("TransformMany", matrices.size());
+
+    RequireOutput(out.size() >= matrices.size(), "TransformMany output span is smaller than the input");
+
+    const Mat4* src = matrices.data();
+    Mat4* dst = out.data();
+    Run(matrices.size(), execution, [&mat, src, dst](const std::size_t begin, const std::size_t end) {
+        // Like the Vec4 overload: each column of the product is the columns of mat weighted by
+        // one column of src[i]. Transposing four matrices into lanes and back costs more than
+        // the product itself.
+        const Float4 c0 = Float4::Load(&mat.internal_mat[0][0]);
+        const Float4 c1 = Float4::Load(&mat.internal_mat[1][0]);
+        const Float4 c2 = Float4::Load(&mat.internal_mat[2][0]);
+        const Float4 c3 = Float4::Load(&mat.internal_mat[3][0]);
+        for (std::size_t i = begin; i < end; ++i) {
+            const detail::Mat4Storage& b = src[i].internal_mat;
+            detail::Mat4Storage& r = dst[i].internal_mat;
+            for (int col = 0; col < 4; ++col) {
+                const Float4 product = c0 * Float4(b[col][0]) + c1 * Float4(b[col][1])
+                    + c2 * Float4(b[col][2]) + c3 * Float4(b[col][3]);
+                product.Store(&r[col][0]);
+            }
+        }
+    });
+}
+
+void NormalizeMany(Span<const Vec2> vectors, Span<Vec2> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("NormalizeMany", vectors.size());
+
+    RequireOutput(out.size() >= vectors.size(), "NormalizeMany output span is smaller than the input");
+
+    const Vec2* src = vectors.data();
+    Vec2* dst = out.data();
+    Run(vectors.size(), execution, [src, dst](const std::size_t begin, const std::size_t end) {
+        NormalizeKernel<2>(src + begin, dst + begin, end - begin);
+    });
+}
+
+void NormalizeMany(Span<const Vec3> vectors, Span<Vec3> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("NormalizeMany", vectors.size());
+
+    RequireOutput(out.size() >= vectors.size(), "NormalizeMany output span is smaller than the input");
+
+    const Vec3* src = vectors.data();
+    Vec3* dst = out.data();
+    Run(vectors.size(), execution, [src, dst](const std::size_t begin, const std::size_t end) {
+        NormalizeKernel<3>(src + begin, dst + begin, end - begin);
+    });
+}
+
+void NormalizeMany(Span<const Vec4> vectors, Span<Vec4> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("NormalizeMany", vectors.size());
+
+    RequireOutput(out.size() >= vectors.size(), "NormalizeMany output span is smaller than the input");
+
+    const Vec4* src = vectors.data();
+    Vec4* dst = out.data();
+    Run(vectors.size(), execution, [src, dst](const std::size_t begin, const std::size_t end) {
+        NormalizeKernel<4>(src + begin, dst + begin, end - begin);
+    });
+}
+
+void NormalizeMany(Span<const Quat> quats, Span<Quat> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("NormalizeMany", quats.size());
+
+    RequireOutput(out.size() >= quats.size(), "NormalizeMany output span is smaller than the input");
+
+    const Quat* src = quats.data();
+    Quat* dst = out.data();
+    Run(quats.size(), execution, [src, dst](const std::size_t begin, const std::size_t end) {
+        std::size_t i = begin;
+        for (; i + WIDTH <= end; i += WIDTH) {
+            Quatx4::Load(src + i).Normalize().Store(dst + i);
+        }
+        for (; i < end; ++i) {
+            const detail::QuatStorage& q = src[i].internal_quat;
+            dst[i] = NormalizeQuat(q.x, q.y, q.z, q.w);
+        }
+    });
+}
+
+void LerpMany(Span<const Vec2> a, Span<const Vec2> b, const float t, Span<Vec2> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("LerpMany", a.size());
+
+    LerpVectors(a, b, t, out, execution);
+}
+
+void LerpMany(Span<const Vec3> a, Span<const Vec3> b, const float t, Span<Vec3> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("LerpMany", a.size());
+
+    LerpVectors(a, b, t, out, execution);
+}
+
+void LerpMany(Span<const Vec4> a, Span<const Vec4> b, const float t, Span<Vec4> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("LerpMany", a.size());
+
+    LerpVectors(a, b, t, out, execution);
+}
+
+void LerpMany(Span<const Quat> a, Span<const Quat> b, const float t, Span<Quat> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("LerpMany", a.size());
+
+    RequireOutput(a.size() == b.size(), "LerpMany input spans differ in size");
+    RequireOutput(out.size() >= a.size(), "LerpMany output span is smaller than the input");
+
+    const Quat* pa = a.data();
+    const Quat* pb = b.data();
+    Quat* dst = out.data();
+    Run(a.size(), execution, [=](const std::size_t begin, const std::size_t end) {
+        const Float4 tt(t);
+        std::size_t i = begin;
+        for (; i + WIDTH <= end; i += WIDTH) {
+            Quatx4::Lerp(Quatx4::Load(pa + i), Quatx4::Load(pb + i), tt).Store(dst + i);
+        }
+        for (; i < end; ++i) {
+            const detail::QuatStorage& qa = pa[i].internal_quat;
+            const detail::QuatStorage& qb = pb[i].internal_quat;
+            const float dot = qa.x * qb.x + qa.y * qb.y + qa.z * qb.z + qa.w * qb.w;
+            const float tb = dot < 0.0f ? -t : t;
+            const float ta = 1.0f - t;
+            dst[i] = NormalizeQuat(qa.x * ta + qb.x * tb, qa.y * ta + qb.y * tb, qa.z * ta + qb.z * tb, qa.w * ta + qb.w * tb);
+        }
+    });
+}
+
+void ClampMany(Span<const Vec2> vectors, const Vec2& min, const Vec2& max, Span<Vec2> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("ClampMany", vectors.size());
+
+    RequireOutput(out.size() >= vectors.size(), "ClampMany output span is smaller than the input");
+
+    const Vec2* src = vectors.data();
+    Vec2* dst = out.data();
+    Run(vectors.size(), execution, [&min, &max, src, dst](const std::size_t begin, const std::size_t end) {
+        ClampKernel<2>(src + begin, min, max, dst + begin, end - begin);
+    });
+}
+
+void ClampMany(Span<const Vec3> vectors, const Vec3& min, const Vec3& max, Span<Vec3> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("ClampMany", vectors.size());
+
+    RequireOutput(out.size() >= vectors.size(), "ClampMany output span is smaller than the input");
+
+    const Vec3* src = vectors.data();
+    Vec3* dst = out.data();
+    Run(vectors.size(), execution, [&min, &max, src, dst](const std::size_t begin, const std::size_t end) {
+        ClampKernel<3>(src + begin, min, max, dst + begin, end - begin);
+    });
+}
+
+void ClampMany(Span<const Vec4> vectors, const Vec4& min, const Vec4& max, Span<Vec4> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("ClampMany", vectors.size());
+
+    RequireOutput(out.size() >= vectors.size(), "ClampMany output span is smaller than the input");
+
+    const Vec4* src = vectors.data();
+    Vec4* dst = out.data();
+    Run(vectors.size(), execution, [&min, &max, src, dst](const std::size_t begin, const std::size_t end) {
+        ClampKernel<4>(src + begin, min, max, dst + begin, end - begin);
+    });
+}
+
+Aabb BoundsOf(Span<const Vec3> points, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("BoundsOf", points.size());
+
+    const Vec3* src = points.data();
+    const std::size_t chunks = (points.size() + GRAIN - 1) / GRAIN;
+    std::vector<Aabb> partial(chunks, Aabb::EMPTY);
+
+    Run(points.size(), execution, [src, &partial](const std::size_t begin, const std::size_t end) {
+        Vec3x4 lo(Aabb::EMPTY.min);
+        Vec3x4 hi(Aabb::EMPTY.max);
+        std::size_t i = begin;
+        for (; i + WIDTH <= end; i += WIDTH) {
+            const Vec3x4 p = Vec3x4::Load(src + i);
+            lo = Vec3x4::Min(lo, p);
+            hi = Vec3x4::Max(hi, p);
+        }
+
+        Aabb box = Aabb::EMPTY;
+        for (int lane = 0; lane < Vec3x4::WIDTH; ++lane) {
+            box = Aabb::Merge(box, Aabb(lo.Get(lane), hi.Get(lane)));
+        }
+        for (; i < end; ++i) {
+            box.Expand(src[i]);
+        }
+
+        // A serial run is one call over everything; a parallel one gets whole chunks.
+        Aabb& slot = partial[begin / GRAIN];
+        slot = Aabb::Merge(slot, box);
+    });
+
+    Aabb bounds = Aabb::EMPTY;
+    for (const Aabb& box : partial) {
+        bounds = Aabb::Merge(bounds, box);
+    }
+    return bounds;
+}
+
+} // namespace velecs::math
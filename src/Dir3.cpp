@@ -0,0 +1,45 @@
+/// @file    Dir3.cpp
+/// @author  Matthew Green
+/// @date    2026-10-17 21:59:05
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Dir3.hpp"
+
+#include <sstream>
+
+namespace velecs::math {
+
+// Public Fields
+
+const Dir3 Dir3::RIGHT    {  1.0f,  0.0f,  0.0f };
+const Dir3 Dir3::LEFT     { -1.0f,  0.0f,  0.0f };
+const Dir3 Dir3::UP       {  0.0f,  1.0f,  0.0f };
+const Dir3 Dir3::DOWN     {  0.0f, -1.0f,  0.0f };
+const Dir3 Dir3::FORWARD  {  0.0f,  0.0f, -1.0f };
+const Dir3 Dir3::BACKWARD {  0.0f,  0.0f,  1.0f };
+
+// Constructors and Destructors
+
+// Public Methods
+
+std::string Dir3::ToString() const
+{
+    std::ostringstream oss;
+    oss << '(' << x << ", " << y << ", " << z << ')';
+    return oss.str();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::math
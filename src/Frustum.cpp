@@ -0,0 +1,147 @@
+/// @file    Frustum.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 01:40:40
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Frustum.hpp"
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Simd.hpp"
+#include "velecs/math/Profile.hpp"
+#include "velecs/math/Stats.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace velecs::math {
+
+namespace {
+
+Vec4 NormalizePlane(const Vec4 plane)
+{
+    const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+    return length > 0.0f ? plane / length : plane;
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+Frustum::Frustum(const std::array<Vec4, 6>& planes)
+    : planes(planes)
+{
+    for (Vec4& plane : this->planes) {
+        plane = NormalizePlane(plane);
+    }
+}
+
+// Public Methods
+
+Frustum Frustum::FromMatrix(const Mat4& viewProjection)
+{
+    VELECS_MATH_ZONE("Frustum::FromMatrix");
+    VELECS_MATH_STAT("Frustum::FromMatrix", viewProjection);
+
+    const detail::Mat4Storage& m = viewProjection.internal_mat;
+    const Vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+    const Vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+    const Vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+    const Vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+    // Clip space keeps -w <= x, y <= w and 0 <= z <= w.
+    return Frustum({
+        row3 + row0,
+        row3 - row0,
+        row3 + row1,
+        row3 - row1,
+        row2,
+        row3 - row2,
+    });
+}
+
+bool Frustum::IntersectsSphere(const Vec3 center, const float radius) const
+{
+    for (const Vec4& plane : planes) {
+        if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) return false;
+    }
+    return true;
+}
+
+bool Frustum::IntersectsAabb(const Aabb& box) const
+{
+    for (const Vec4& plane : planes) {
+        // The corner furthest along the plane normal.
+        const float x = plane.x >= 0.0f ? box.max.x : box.min.x;
+        const float y = plane.y >= 0.0f ? box.max.y : box.min.y;
+        const float z = plane.z >= 0.0f ? box.max.z : box.min.z;
+        if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f) return false;
+    }
+    return true;
+}
+
+std::size_t CullSpheres(const Frustum& frustum, Span<const Vec4> spheres, Span<std::uint32_t> visible, const std::uint32_t indexOffset)
+{
+    VELECS_MATH_ZONE_N("CullSpheres", spheres.size());
+
+    const std::size_t count = spheres.size();
+    if (visible.size() < count) {
+        throw std::invalid_argument("CullSpheres output span is smaller than the input");
+    }
+
+    Float4 px[6], py[6], pz[6], pw[6];
+    for (int p = 0; p < 6; ++p) {
+        const Vec4& plane = frustum.planes[p];
+        px[p] = Float4(plane.x);
+        py[p] = Float4(plane.y);
+        pz[p] = Float4(plane.z);
+        pw[p] = Float4(plane.w);
+    }
+
+    const Vec4* src = spheres.data();
+    std::uint32_t* dst = visible.data();
+    std::size_t written = 0;
+    std::size_t i = 0;
+    for (; i + Float4::WIDTH <= count; i += Float4::WIDTH) {
+        Float4 x = Float4::Load(&src[i + 0].x);
+        Float4 y = Float4::Load(&src[i + 1].x);
+        Float4 z = Float4::Load(&src[i + 2].x);
+        Float4 r = Float4::Load(&src[i + 3].x);
+        Float4::Transpose(x, y, z, r);
+
+        const Float4 negR = -r;
+        Float4 outside = Float4::Less(px[0] * x + py[0] * y + pz[0] * z + pw[0], negR);
+        for (int p = 1; p < 6; ++p) {
+            outside = outside | Float4::Less(px[p] * x + py[p] * y + pz[p] * z + pw[p], negR);
+        }
+
+        int mask = ~Float4::MoveMask(outside) & 0xF;
+        while (mask != 0) {
+            const int lane = mask & 1 ? 0 : mask & 2 ? 1 : mask & 4 ? 2 : 3;
+            dst[written++] = indexOffset + static_cast<std::uint32_t>(i + lane);
+            mask &= mask - 1;
+        }
+    }
+    for (; i < count; ++i) {
+        const Vec4& s = src[i];
+        if (frustum.IntersectsSphere(Vec3(s.x, s.y, s.z), s.w)) {
+            dst[written++] = indexOffset + static_cast<std::uint32_t>(i);
+        }
+    }
+    return written;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::math
@@ -0,0 +1,341 @@
+/// @file    KdTree.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 07:04:26
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/KdTree.hpp"
+#include "velecs/math/Simd.hpp"
+
+#include "detail/WorkerPool.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace velecs::math {
+
+namespace {
+
+/// @brief Queries per work item when running in parallel.
+constexpr std::size_t QUERY_GRAIN = 256;
+
+/// @brief Points per work item when copying the input in parallel.
+constexpr std::size_t POINT_GRAIN = 4096;
+
+/// @brief Leaf blocks per work item when scattering the points in parallel.
+constexpr std::size_t LEAF_GRAIN = 256;
+
+/// @brief The deepest tree a 32-bit point count can produce, plus headroom for the stack.
+constexpr std::size_t MAX_DEPTH = 40;
+
+constexpr float INF = std::numeric_limits<float>::infinity();
+
+/// @struct Entry
+/// @brief A point and its input index, partitioned in place during the build.
+struct Entry {
+    float p[3];
+    std::uint32_t index;
+};
+
+/// @brief Calls fn(begin, end) over [0, count), split across the pool if requested.
+template<typename Fn>
+void ForEach(const std::size_t count, const std::size_t grain, const BatchExecution execution, Fn&& fn)
+{
+    if (execution == BatchExecution::Parallel) {
+        detail::WorkerPool::Shared().ParallelFor(count, grain, fn);
+    }
+    else if (count != 0) {
+        fn(std::size_t(0), count);
+    }
+}
+
+/// @struct TreeView
+/// @brief The arrays of a built tree, as read by the traversal.
+struct TreeView {
+    const float* splits;
+    const std::uint8_t* axes;
+    const float* xs;
+    const float* ys;
+    const float* zs;
+    const std::uint32_t* indices;
+    std::size_t internalCount; /// @brief Nodes below this index are internal, the rest are leaves.
+    std::size_t stride;
+};
+
+/// @brief Visits the leaves that may hold a point within visitor.Limit() of the query,
+///        nearest subtree first.
+/// @details A subtree is skipped when the squared distance from the query to its splitting
+///          plane exceeds the limit, which the visitor may shrink as it finds points.
+template<typename Visitor>
+void Traverse(const TreeView& tree, const float (&q)[3], Visitor& visitor)
+{
+    struct Pending {
+        std::size_t node;
+        float bound;
+    };
+    Pending stack[MAX_DEPTH];
+    std::size_t top = 0;
+    stack[top++] = Pending{0, 0.0f};
+
+    while (top != 0) {
+        const Pending pending = stack[--top];
+        if (pending.bound > visitor.Limit()) continue;
+
+        std::size_t node = pending.node;
+        while (node < tree.internalCount) {
+            const float diff = q[tree.axes[node]] - tree.splits[node];
+            const std::size_t left = 2 * node + 1;
+            const std::size_t nearChild = diff < 0.0f ? left : left + 1;
+            const std::size_t farChild = diff < 0.0f ? left + 1 : left;
+            stack[top++] = Pending{farChild, diff * diff};
+            node = nearChild;
+        }
+
+        const std::size_t base = (node - tree.internalCount) * tree.stride;
+        const Float4 qx(q[0]);
+        const Float4 qy(q[1]);
+        const Float4 qz(q[2]);
+        for (std::size_t i = base; i < base + tree.stride; i += Float4::WIDTH) {
+            const Float4 dx = Float4::Load(tree.xs + i) - qx;
+            const Float4 dy = Float4::Load(tree.ys + i) - qy;
+            const Float4 dz = Float4::Load(tree.zs + i) - qz;
+            visitor.Scan(dx * dx + dy * dy + dz * dz, tree.indices + i);
+        }
+    }
+}
+
+/// @brief Orders neighbors by distance, so the standard heap functions keep the farthest on top.
+inline bool Closer(const KdNeighbor& a, const KdNeighbor& b)
+{
+    return a.distanceSq < b.distanceSq;
+}
+
+/// @struct NearestVisitor
+/// @brief Keeps the k nearest points seen so far in a bounded max-heap.
+struct NearestVisitor {
+    KdNeighbor* heap;
+    std::size_t capacity;
+    std::size_t count;
+    float worst; /// @brief The k-th distance so far, infinite until the heap is full.
+    float scale; /// @brief 1 / (1 + epsilon)^2, applied to worst to prune approximately.
+
+    inline float Limit() const { return worst * scale; }
+
+    inline void Scan(const Float4 distanceSq, const std::uint32_t* indices)
+    {
+        const int mask = Float4::MoveMask(Float4::Less(distanceSq, Float4(worst)));
+        if (mask == 0) return;
+
+        alignas(16) float d[Float4::WIDTH];
+        distanceSq.StoreAligned(d);
+        for (int lane = 0; lane < Float4::WIDTH; ++lane) {
+            if (mask & (1 << lane)) Insert(KdNeighbor{indices[lane], d[lane]});
+        }
+    }
+
+    inline void Insert(const KdNeighbor neighbor)
+    {
+        if (count < capacity) {
+            heap[count++] = neighbor;
+            std::push_heap(heap, heap + count, Closer);
+            if (count == capacity) worst = heap[0].distanceSq;
+        }
+        else if (neighbor.distanceSq < worst) {
+            std::pop_heap(heap, heap + count, Closer);
+            heap[count - 1] = neighbor;
+            std::push_heap(heap, heap + count, Closer);
+            worst = heap[0].distanceSq;
+        }
+    }
+};
+
+/// @struct RadiusVisitor
+/// @brief Collects every point within a fixed distance.
+struct RadiusVisitor {
+    std::vector<KdNeighbor>* out;
+    float radiusSq;
+
+    inline float Limit() const { return radiusSq; }
+
+    inline void Scan(const Float4 distanceSq, const std::uint32_t* indices)
+    {
+        const int mask = Float4::MoveMask(Float4::LessEqual(distanceSq, Float4(radiusSq)));
+        if (mask == 0) return;
+
+        alignas(16) float d[Float4::WIDTH];
+        distanceSq.StoreAligned(d);
+        for (int lane = 0; lane < Float4::WIDTH; ++lane) {
+            // An infinite radius also accepts the padding, which has no index.
+            if ((mask & (1 << lane)) && indices[lane] != KdNeighbor::NONE) {
+                out->push_back(KdNeighbor{indices[lane], d[lane]});
+            }
+        }
+    }
+};
+
+/// @brief The squared (1 + epsilon) factor that NearestVisitor divides by.
+inline float ApproximationScale(const float epsilon)
+{
+    const float factor = 1.0f + std::max(epsilon, 0.0f);
+    return 1.0f / (factor * factor);
+}
+
+} // namespace
+
+KdTree::KdTree(Span<const Vec3> points, const BatchExecution execution)
+    : _size(points.size())
+{
+    if (points.size() >= KdNeighbor::NONE) {
+        throw std::invalid_argument("KdTree supports fewer than 2^32 - 1 points");
+    }
+    if (points.empty()) return;
+
+    const std::size_t count = points.size();
+    std::size_t depth = 0;
+    while (((count + (std::size_t(1) << depth) - 1) >> depth) > LEAF_SIZE) {
+        ++depth;
+    }
+    const std::size_t leafCount = std::size_t(1) << depth;
+    const std::size_t largestLeaf = (count + leafCount - 1) >> depth;
+    _stride = (largestLeaf + Float4::WIDTH - 1) / Float4::WIDTH * Float4::WIDTH;
+
+    std::vector<Entry> entries(count);
+    ForEach(count, POINT_GRAIN, execution, [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            entries[i] = Entry{{points[i].x, points[i].y, points[i].z}, static_cast<std::uint32_t>(i)};
+        }
+    });
+
+    // Split one level at a time. Each node owns [bounds[j], bounds[j + 1]) of entries, so the
+    // nodes of a level partition disjoint ranges and can be split on different threads.
+    _splits.resize(leafCount - 1);
+    _axes.resize(leafCount - 1);
+    std::vector<std::size_t> bounds{0, count};
+    for (std::size_t level = 0; level < depth; ++level) {
+        const std::size_t first = (std::size_t(1) << level) - 1;
+        const std::size_t nodes = std::size_t(1) << level;
+        std::vector<std::size_t> next(2 * nodes + 1);
+
+        ForEach(nodes, 1, execution, [&](const std::size_t nodeBegin, const std::size_t nodeEnd) {
+            for (std::size_t j = nodeBegin; j < nodeEnd; ++j) {
+                Entry* const begin = entries.data() + bounds[j];
+                Entry* const end = entries.data() + bounds[j + 1];
+
+                float lo[3] = { INF, INF, INF };
+                float hi[3] = { -INF, -INF, -INF };
+                for (const Entry* e = begin; e != end; ++e) {
+                    for (int axis = 0; axis < 3; ++axis) {
+                        lo[axis] = std::min(lo[axis], e->p[axis]);
+                        hi[axis] = std::max(hi[axis], e->p[axis]);
+                    }
+                }
+                int axis = 0;
+                if (hi[1] - lo[1] > hi[axis] - lo[axis]) axis = 1;
+                if (hi[2] - lo[2] > hi[axis] - lo[axis]) axis = 2;
+
+                Entry* const mid = begin + (end - begin) / 2;
+                std::nth_element(begin, mid, end, [axis](const Entry& a, const Entry& b) {
+                    return a.p[axis] < b.p[axis];
+                });
+
+                _splits[first + j] = mid->p[axis];
+                _axes[first + j] = static_cast<std::uint8_t>(axis);
+                next[2 * j] = bounds[j];
+                next[2 * j + 1] = bounds[j] + (end - begin) / 2;
+                next[2 * j + 2] = bounds[j + 1];
+            }
+        });
+        bounds.swap(next);
+    }
+
+    // Scatter each leaf into its padded block. Padding lies at infinity, so SIMD scans never accept it.
+    const std::size_t slots = leafCount * _stride;
+    _xs.resize(slots);
+    _ys.resize(slots);
+    _zs.resize(slots);
+    _indices.resize(slots);
+    ForEach(leafCount, LEAF_GRAIN, execution, [&](const std::size_t leafBegin, const std::size_t leafEnd) {
+        for (std::size_t leaf = leafBegin; leaf < leafEnd; ++leaf) {
+            const std::size_t base = leaf * _stride;
+            const std::size_t size = bounds[leaf + 1] - bounds[leaf];
+            for (std::size_t i = 0; i < _stride; ++i) {
+                if (i < size) {
+                    const Entry& e = entries[bounds[leaf] + i];
+                    _xs[base + i] = e.p[0];
+                    _ys[base + i] = e.p[1];
+                    _zs[base + i] = e.p[2];
+                    _indices[base + i] = e.index;
+                }
+                else {
+                    _xs[base + i] = INF;
+                    _ys[base + i] = INF;
+                    _zs[base + i] = INF;
+                    _indices[base + i] = KdNeighbor::NONE;
+                }
+            }
+        }
+    });
+}
+
+KdNeighbor KdTree::Nearest(const Vec3 query, const float epsilon) const
+{
+    KdNeighbor result;
+    KNearest(query, Span<KdNeighbor>(&result, 1), epsilon);
+    return result;
+}
+
+std::size_t KdTree::KNearest(const Vec3 query, Span<KdNeighbor> out, const float epsilon) const
+{
+    std::fill(out.begin(), out.end(), KdNeighbor{});
+    if (out.empty() || _size == 0) return 0;
+
+    const TreeView tree{ _splits.data(), _axes.data(), _xs.data(), _ys.data(), _zs.data(), _indices.data(), _splits.size(), _stride };
+    const float q[3] = { query.x, query.y, query.z };
+    NearestVisitor visitor{ out.data(), out.size(), 0, INF, ApproximationScale(epsilon) };
+    Traverse(tree, q, visitor);
+
+    std::sort_heap(out.data(), out.data() + visitor.count, Closer);
+    return visitor.count;
+}
+
+void KdTree::Radius(const Vec3 query, const float radius, std::vector<KdNeighbor>& out) const
+{
+    out.clear();
+    if (_size == 0 || !(radius >= 0.0f)) return;
+
+    const TreeView tree{ _splits.data(), _axes.data(), _xs.data(), _ys.data(), _zs.data(), _indices.data(), _splits.size(), _stride };
+    const float q[3] = { query.x, query.y, query.z };
+    RadiusVisitor visitor{ &out, radius * radius };
+    Traverse(tree, q, visitor);
+}
+
+void KdTree::NearestMany(Span<const Vec3> queries, Span<KdNeighbor> out, const float epsilon, const BatchExecution execution) const
+{
+    if (out.size() < queries.size()) {
+        throw std::invalid_argument("NearestMany output span is smaller than the input");
+    }
+    ForEach(queries.size(), QUERY_GRAIN, execution, [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            KNearest(queries[i], out.subspan(i, 1), epsilon);
+        }
+    });
+}
+
+void KdTree::KNearestMany(Span<const Vec3> queries, const std::size_t k, Span<KdNeighbor> out, const float epsilon, const BatchExecution execution) const
+{
+    if (out.size() / (k == 0 ? 1 : k) < queries.size()) {
+        throw std::invalid_argument("KNearestMany output span is smaller than queries.size() * k");
+    }
+    if (k == 0) return;
+    ForEach(queries.size(), QUERY_GRAIN, execution, [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            KNearest(queries[i], out.subspan(i * k, k), epsilon);
+        }
+    });
+}
+
+} // namespace velecs::math
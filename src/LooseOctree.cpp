@@ -0,0 +1,330 @@
+/// @file    LooseOctree.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 07:48:13
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/LooseOctree.hpp"
+#include "velecs/math/Frustum.hpp"
+#include "velecs/math/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace velecs::math {
+
+namespace {
+
+/// @brief Bits per cell coordinate in a node key; enough for MAX_DEPTH.
+constexpr std::uint32_t KEY_BITS = 19;
+
+inline std::uint64_t NodeKey(const std::uint32_t depth, const std::uint32_t ix, const std::uint32_t iy, const std::uint32_t iz)
+{
+    return (std::uint64_t(depth) << (3 * KEY_BITS)) | (std::uint64_t(ix) << (2 * KEY_BITS)) | (std::uint64_t(iy) << KEY_BITS) | iz;
+}
+
+/// @brief The squared distance between a point and a box, per lane.
+inline Float4 DistanceSqToBox(const Float4 cx, const Float4 cy, const Float4 cz, const Float4 half, const Vec3 point)
+{
+    const Float4 zero(0.0f);
+    const Float4 dx = Float4::Max(Float4::Abs(cx - Float4(point.x)) - half, zero);
+    const Float4 dy = Float4::Max(Float4::Abs(cy - Float4(point.y)) - half, zero);
+    const Float4 dz = Float4::Max(Float4::Abs(cz - Float4(point.z)) - half, zero);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+} // namespace
+
+LooseOctree::LooseOctree(const Aabb& worldBounds, const std::uint32_t maxDepth)
+    : _min(Vec3::ZERO), _size(0.0f), _maxDepth(maxDepth)
+{
+    if (worldBounds.IsEmpty()) {
+        throw std::invalid_argument("LooseOctree world bounds are empty");
+    }
+    if (maxDepth > MAX_DEPTH) {
+        throw std::invalid_argument("LooseOctree maxDepth exceeds MAX_DEPTH");
+    }
+
+    const Vec3 size = worldBounds.Size();
+    _size = std::max({ size.x, size.y, size.z });
+    if (!(_size > 0.0f)) _size = 1.0f;
+    _min = worldBounds.Center() - Vec3(_size, _size, _size) * 0.5f;
+    Clear();
+}
+
+std::uint32_t LooseOctree::Insert(const Vec3 center, const float radius)
+{
+    std::uint32_t id;
+    if (!_freeObjects.empty()) {
+        id = _freeObjects.back();
+        _freeObjects.pop_back();
+    }
+    else {
+        id = static_cast<std::uint32_t>(_objects.size());
+        _objects.push_back(Location{ INVALID, 0 });
+    }
+
+    const float r = std::max(radius, 0.0f);
+    Link(NodeFor(center, r), Entry{ center.x, center.y, center.z, r, id });
+    return id;
+}
+
+void LooseOctree::Move(const std::uint32_t id, const Vec3 center, const float radius)
+{
+    RequireObject(id);
+    const float r = std::max(radius, 0.0f);
+    const Entry entry{ center.x, center.y, center.z, r, id };
+
+    // Most moves stay within their cell: check it directly before looking up a node.
+    const Location location = _objects[id];
+    Node& current = _nodes[location.node];
+    if (location.node != 0 && current.depth == DepthFor(r)) {
+        const float halfCell = HalfSize(current.depth) * 0.5f;
+        if (std::abs(center.x - current.center[0]) <= halfCell
+            && std::abs(center.y - current.center[1]) <= halfCell
+            && std::abs(center.z - current.center[2]) <= halfCell) {
+            current.entries[location.slot] = entry;
+            return;
+        }
+    }
+
+    const std::uint32_t target = NodeFor(center, r);
+    if (target == location.node) {
+        _nodes[target].entries[location.slot] = entry;
+        return;
+    }
+
+    // Link before pruning, since the target may be an ancestor the old node would release.
+    const std::uint32_t previous = Unlink(id);
+    Link(target, entry);
+    Prune(previous);
+}
+
+void LooseOctree::Remove(const std::uint32_t id)
+{
+    RequireObject(id);
+    Prune(Unlink(id));
+    _objects[id] = Location{ INVALID, 0 };
+    _freeObjects.push_back(id);
+}
+
+void LooseOctree::Clear()
+{
+    Node root{};
+    root.center[0] = _min.x + _size * 0.5f;
+    root.center[1] = _min.y + _size * 0.5f;
+    root.center[2] = _min.z + _size * 0.5f;
+    root.parent = INVALID;
+    std::fill(std::begin(root.children), std::end(root.children), INVALID);
+
+    _nodes.clear();
+    _nodes.push_back(std::move(root));
+    _freeNodes.clear();
+    _lookup.clear();
+    _lookup.emplace(NodeKey(0, 0, 0, 0), 0u);
+    _objects.clear();
+    _freeObjects.clear();
+}
+
+void LooseOctree::QuerySphere(const Vec3 center, const float radius, std::vector<std::uint32_t>& out) const
+{
+    const float radiusSq = radius * radius;
+    Query(
+        [&](const Float4 cx, const Float4 cy, const Float4 cz, const Float4 half) {
+            return Float4::LessEqual(DistanceSqToBox(cx, cy, cz, half, center), Float4(radiusSq));
+        },
+        [&](const Entry& e) {
+            const float dx = e.x - center.x;
+            const float dy = e.y - center.y;
+            const float dz = e.z - center.z;
+            const float reach = e.radius + radius;
+            return dx * dx + dy * dy + dz * dz <= reach * reach;
+        },
+        out);
+}
+
+void LooseOctree::QueryAabb(const Aabb& box, std::vector<std::uint32_t>& out) const
+{
+    const Vec3 boxCenter = box.Center();
+    const Vec3 boxExtents = box.Extents();
+    Query(
+        [&](const Float4 cx, const Float4 cy, const Float4 cz, const Float4 half) {
+            return Float4::LessEqual(Float4::Abs(cx - Float4(boxCenter.x)), half + Float4(boxExtents.x))
+                & Float4::LessEqual(Float4::Abs(cy - Float4(boxCenter.y)), half + Float4(boxExtents.y))
+                & Float4::LessEqual(Float4::Abs(cz - Float4(boxCenter.z)), half + Float4(boxExtents.z));
+        },
+        [&](const Entry& e) {
+            const float dx = std::max({ box.min.x - e.x, 0.0f, e.x - box.max.x });
+            const float dy = std::max({ box.min.y - e.y, 0.0f, e.y - box.max.y });
+            const float dz = std::max({ box.min.z - e.z, 0.0f, e.z - box.max.z });
+            return dx * dx + dy * dy + dz * dz <= e.radius * e.radius;
+        },
+        out);
+}
+
+void LooseOctree::QueryFrustum(const Frustum& frustum, std::vector<std::uint32_t>& out) const
+{
+    Query(
+        [&](const Float4 cx, const Float4 cy, const Float4 cz, const Float4 half) {
+            // A box is outside a plane when even its corner furthest along the normal is behind it.
+            const Float4 zero(0.0f);
+            Float4 inside = Float4::Equal(zero, zero);
+            for (const Vec4& plane : frustum.planes) {
+                const float reach = std::abs(plane.x) + std::abs(plane.y) + std::abs(plane.z);
+                const Float4 distance = cx * Float4(plane.x) + cy * Float4(plane.y) + cz * Float4(plane.z)
+                    + Float4(plane.w) + half * Float4(reach);
+                inside = inside & Float4::LessEqual(zero, distance);
+            }
+            return inside;
+        },
+        [&](const Entry& e) { return frustum.IntersectsSphere(Vec3(e.x, e.y, e.z), e.radius); },
+        out);
+}
+
+template<typename NodeTest, typename EntryTest>
+void LooseOctree::Query(NodeTest&& nodeTest, EntryTest&& entryTest, std::vector<std::uint32_t>& out) const
+{
+    out.clear();
+
+    std::vector<std::uint32_t> stack;
+    stack.reserve(8 * (_maxDepth + 1));
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        for (const Entry& e : node.entries) {
+            if (entryTest(e)) out.push_back(e.id);
+        }
+        if (node.childMask == 0) continue;
+
+        // Children 0-3 lie in the lower z half and 4-7 in the upper, each a quarter cell from
+        // the center along every axis, so one set of x and y lanes serves both halves.
+        const float quarter = HalfSize(node.depth) * 0.25f;
+        const Float4 half(HalfSize(node.depth + 1));
+        const Float4 cx(node.center[0] - quarter, node.center[0] + quarter, node.center[0] - quarter, node.center[0] + quarter);
+        const Float4 cy(node.center[1] - quarter, node.center[1] - quarter, node.center[1] + quarter, node.center[1] + quarter);
+        const Float4 lowerZ(node.center[2] - quarter);
+        const Float4 upperZ(node.center[2] + quarter);
+        const int accepted = (Float4::MoveMask(nodeTest(cx, cy, lowerZ, half))
+            | (Float4::MoveMask(nodeTest(cx, cy, upperZ, half)) << 4)) & node.childMask;
+
+        for (int child = 0; child < 8; ++child) {
+            if (accepted & (1 << child)) stack.push_back(node.children[child]);
+        }
+    }
+}
+
+std::uint32_t LooseOctree::NodeFor(const Vec3 center, const float radius)
+{
+    const float cx = center.x - _min.x;
+    const float cy = center.y - _min.y;
+    const float cz = center.z - _min.z;
+    if (!(cx >= 0.0f && cx <= _size && cy >= 0.0f && cy <= _size && cz >= 0.0f && cz <= _size)) {
+        return 0;
+    }
+
+    const std::uint32_t depth = DepthFor(radius);
+    const std::uint32_t cells = 1u << depth;
+    const float scale = static_cast<float>(cells) / _size;
+    const std::uint32_t ix = std::min(static_cast<std::uint32_t>(cx * scale), cells - 1);
+    const std::uint32_t iy = std::min(static_cast<std::uint32_t>(cy * scale), cells - 1);
+    const std::uint32_t iz = std::min(static_cast<std::uint32_t>(cz * scale), cells - 1);
+    return FindOrCreate(depth, ix, iy, iz);
+}
+
+std::uint32_t LooseOctree::DepthFor(const float radius) const
+{
+    // The deepest level whose cells are at least twice the radius: size / 2^depth >= 2 * radius.
+    if (!(radius > 0.0f)) return _maxDepth;
+    const float ratio = _size / (2.0f * radius);
+    if (ratio >= static_cast<float>(1u << _maxDepth)) return _maxDepth;
+    return ratio < 1.0f ? 0u : static_cast<std::uint32_t>(std::ilogb(ratio));
+}
+
+std::uint32_t LooseOctree::FindOrCreate(const std::uint32_t depth, const std::uint32_t ix, const std::uint32_t iy, const std::uint32_t iz)
+{
+    const std::uint64_t key = NodeKey(depth, ix, iy, iz);
+    const auto found = _lookup.find(key);
+    if (found != _lookup.end()) return found->second;
+
+    const std::uint32_t parent = FindOrCreate(depth - 1, ix >> 1, iy >> 1, iz >> 1);
+
+    std::uint32_t index;
+    if (!_freeNodes.empty()) {
+        index = _freeNodes.back();
+        _freeNodes.pop_back();
+    }
+    else {
+        index = static_cast<std::uint32_t>(_nodes.size());
+        _nodes.emplace_back();
+    }
+
+    const float cell = _size / static_cast<float>(1u << depth);
+    Node& node = _nodes[index];
+    node.center[0] = _min.x + (static_cast<float>(ix) + 0.5f) * cell;
+    node.center[1] = _min.y + (static_cast<float>(iy) + 0.5f) * cell;
+    node.center[2] = _min.z + (static_cast<float>(iz) + 0.5f) * cell;
+    node.depth = depth;
+    node.key = key;
+    node.parent = parent;
+    std::fill(std::begin(node.children), std::end(node.children), INVALID);
+    node.childMask = 0;
+    node.entries.clear();
+
+    const std::uint32_t slot = (ix & 1u) | ((iy & 1u) << 1) | ((iz & 1u) << 2);
+    _nodes[parent].children[slot] = index;
+    _nodes[parent].childMask |= static_cast<std::uint8_t>(1u << slot);
+    _lookup.emplace(key, index);
+    return index;
+}
+
+void LooseOctree::Link(const std::uint32_t node, const Entry& entry)
+{
+    std::vector<Entry>& entries = _nodes[node].entries;
+    _objects[entry.id] = Location{ node, static_cast<std::uint32_t>(entries.size()) };
+    entries.push_back(entry);
+}
+
+std::uint32_t LooseOctree::Unlink(const std::uint32_t id)
+{
+    const Location location = _objects[id];
+    std::vector<Entry>& entries = _nodes[location.node].entries;
+    if (location.slot + 1 != entries.size()) {
+        entries[location.slot] = entries.back();
+        _objects[entries[location.slot].id].slot = location.slot;
+    }
+    entries.pop_back();
+    return location.node;
+}
+
+void LooseOctree::Prune(std::uint32_t node)
+{
+    while (node != 0 && _nodes[node].entries.empty() && _nodes[node].childMask == 0) {
+        const Node& dead = _nodes[node];
+        Node& parent = _nodes[dead.parent];
+        for (int slot = 0; slot < 8; ++slot) {
+            if (parent.children[slot] == node) {
+                parent.children[slot] = INVALID;
+                parent.childMask &= static_cast<std::uint8_t>(~(1u << slot));
+            }
+        }
+        _lookup.erase(dead.key);
+        _freeNodes.push_back(node);
+        node = dead.parent;
+    }
+}
+
+void LooseOctree::RequireObject(const std::uint32_t id) const
+{
+    if (id >= _objects.size() || _objects[id].node == INVALID) {
+        throw std::out_of_range("LooseOctree id does not name an object");
+    }
+}
+
+} // namespace velecs::math
@@ -10,24 +10,46 @@
 
 #include "velecs/math/Mat4.hpp"
 #include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec3A.hpp"
+#include "velecs/math/Point3.hpp"
+#include "velecs/math/Dir3.hpp"
 #include "velecs/math/Vec4.hpp"
 #include "velecs/math/Quat.hpp"
+#include "velecs/math/Profile.hpp"
+#include "velecs/math/Stats.hpp"
 
-#include <glm/gtc/epsilon.hpp>
-#include <glm/vector_relational.hpp>
+#include "detail/MatrixKernels.hpp"
+
+#if !defined(VELECS_MATH_BACKEND_NATIVE)
+    #include <glm/ext/matrix_transform.hpp>
+#endif
+
+#include <cmath>
+#include <stdexcept>
 
 namespace velecs::math {
 
+namespace {
+
+/// @brief The cross product of the xyz lanes; lane 3 is 0 when both inputs have equal lane 3s.
+inline Float4 Cross(const Float4 a, const Float4 b)
+{
+    return Float4::Shuffle<1, 2, 0, 3>(a) * Float4::Shuffle<2, 0, 1, 3>(b)
+        - Float4::Shuffle<2, 0, 1, 3>(a) * Float4::Shuffle<1, 2, 0, 3>(b);
+}
+
+} // namespace
+
 // Public Fields
 
-const Mat4 Mat4::IDENTITY = glm::mat4(1.0f);
-const Mat4 Mat4::ZERO = glm::mat4(0.0f);
-const Mat4 Mat4::NEG_IDENTITY = glm::mat4(-1.0f);
+const Mat4 Mat4::IDENTITY = Mat4(1.0f);
+const Mat4 Mat4::ZERO = Mat4(0.0f);
+const Mat4 Mat4::NEG_IDENTITY = Mat4(-1.0f);
 
 // Constructors and Destructors
 
 Mat4::Mat4(float diagonal)
-    : internal_mat(glm::mat4(diagonal)) {}
+    : internal_mat(detail::Mat4Storage(diagonal)) {}
 
 // Public Methods
 
@@ -43,37 +65,37 @@ bool Mat4::operator!=(const Mat4& other) const
 
 bool Mat4::FastEqual(const Mat4& other) const
 {
-    return std::memcmp(&internal_mat, &other.internal_mat, sizeof(glm::mat4)) == 0;
+    return std::memcmp(&internal_mat, &other.internal_mat, sizeof(internal_mat)) == 0;
 }
 
 bool Mat4::FastNotEqual(const Mat4& other) const
 {
-    return std::memcmp(&internal_mat, &other.internal_mat, sizeof(glm::mat4)) != 0;
+    return std::memcmp(&internal_mat, &other.internal_mat, sizeof(internal_mat)) != 0;
 }
 
 bool Mat4::ApproxEqual(const Mat4& other, float epsilon/* = 1e-6f*/) const
 {
-    return glm::all(
-        glm::epsilonEqual(internal_mat[0], other.internal_mat[0], epsilon) &&
-        glm::epsilonEqual(internal_mat[1], other.internal_mat[1], epsilon) &&
-        glm::epsilonEqual(internal_mat[2], other.internal_mat[2], epsilon) &&
-        glm::epsilonEqual(internal_mat[3], other.internal_mat[3], epsilon)
-    );
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            if (!(std::fabs(internal_mat[col][row] - other.internal_mat[col][row]) < epsilon)) return false;
+        }
+    }
+    return true;
 }
 
 bool Mat4::ApproxNotEqual(const Mat4& other, float epsilon/* = 1e-6f*/) const
 {
-    return glm::any(
-        glm::epsilonNotEqual(internal_mat[0], other.internal_mat[0], epsilon) ||
-        glm::epsilonNotEqual(internal_mat[1], other.internal_mat[1], epsilon) ||
-        glm::epsilonNotEqual(internal_mat[2], other.internal_mat[2], epsilon) ||
-        glm::epsilonNotEqual(internal_mat[3], other.internal_mat[3], epsilon)
-    );
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            if (std::fabs(internal_mat[col][row] - other.internal_mat[col][row]) >= epsilon) return true;
+        }
+    }
+    return false;
 }
 
 Mat4 Mat4::FromPosition(const Vec3& position)
 {
-    glm::mat4 internal = glm::mat4(1.0f);
+    detail::Mat4Storage internal(1.0f);
     internal[3][0] = position.x;
     internal[3][1] = position.y;
     internal[3][2] = position.z;
@@ -82,7 +104,7 @@ Mat4 Mat4::FromPosition(const Vec3& position)
 
 Mat4 Mat4::FromScale(const Vec3& scale)
 {
-    glm::mat4 internal = glm::mat4(1.0f);
+    detail::Mat4Storage internal(1.0f);
     internal[0][0] = scale.x;
     internal[1][1] = scale.y;
     internal[2][2] = scale.z;
@@ -101,19 +123,22 @@ Mat4 Mat4::FromRotationDeg(const Vec3& rotationDeg)
 
 Mat4 Mat4::FromPerspectiveRad(float verticalFovRad, float aspectRatio, float nearPlane, float farPlane)
 {
+    VELECS_MATH_ZONE("Mat4::FromPerspectiveRad");
+    VELECS_MATH_STAT("Mat4::FromPerspectiveRad", verticalFovRad, aspectRatio, nearPlane, farPlane);
+
     // Define the coordinate system change matrix (X)
-    glm::mat4 X = glm::mat4(1.0f); // Start with an identity matrix
+    detail::Mat4Storage X(1.0f); // Start with an identity matrix
     X[1][1] = -1.0f; // Flip Y axis
     X[2][2] = -1.0f; // Flip Z axis
 
-    const float focalLength = 1.0f / (std::tanf(verticalFovRad * 0.5f));
+    const float focalLength = 1.0f / (std::tan(verticalFovRad * 0.5f));
     const float x = focalLength / aspectRatio;
     const float y = focalLength;
     const float A = farPlane / (farPlane - nearPlane);
     const float B = -nearPlane * A;
 
     // Define the right-handed perspective projection matrix manually
-    glm::mat4 perspectiveMatrix = glm::mat4(0.0f); // Initialize all elements to 0
+    detail::Mat4Storage perspectiveMatrix(0.0f); // Initialize all elements to 0
     perspectiveMatrix[0][0] = x;
     perspectiveMatrix[1][1] = y; // Negative for Vulkan's Y-axis
     perspectiveMatrix[2][2] = A;
@@ -128,8 +153,11 @@ Mat4 Mat4::FromPerspectiveRad(float verticalFovRad, float aspectRatio, float nea
 
 Mat4 Mat4::FromOrthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane)
 {
+    VELECS_MATH_ZONE("Mat4::FromOrthographic");
+    VELECS_MATH_STAT("Mat4::FromOrthographic", left, right, bottom, top, nearPlane, farPlane);
+
     // Define the coordinate system change matrix (X)
-    glm::mat4 X = glm::mat4(1.0f);
+    detail::Mat4Storage X(1.0f);
     X[1][1] = -1.0f; // Flip Y axis
     X[2][2] = -1.0f; // Flip Z axis
 
@@ -144,7 +172,7 @@ Mat4 Mat4::FromOrthographic(float left, float right, float bottom, float top, fl
     float transZ = -nearPlane / (farPlane - nearPlane); // Offset for Vulkan's [0,1] Z range
 
     // Create the orthographic projection matrix
-    glm::mat4 orthoMatrix = glm::mat4(0.0f);
+    detail::Mat4Storage orthoMatrix(0.0f);
     orthoMatrix[0][0] = scaleX;
     orthoMatrix[1][1] = scaleY;
     orthoMatrix[2][2] = scaleZ;
@@ -165,59 +193,88 @@ Mat4& Mat4::operator*=(const Mat4& other)
 
 Mat4& Mat4::Translate(const Vec3& displacement)
 {
-    *this = WithTranslation(displacement);
+    detail::Mat4Storage& m = internal_mat;
+    for (int row = 0; row < 4; ++row) {
+        m[3][row] += m[0][row] * displacement.x + m[1][row] * displacement.y + m[2][row] * displacement.z;
+    }
     return *this;
 }
 
 Mat4& Mat4::Scale(const Vec3& scale)
 {
-    *this = WithScale(scale);
+    detail::Mat4Storage& m = internal_mat;
+    for (int row = 0; row < 4; ++row) {
+        m[0][row] *= scale.x;
+        m[1][row] *= scale.y;
+        m[2][row] *= scale.z;
+    }
     return *this;
 }
 
 Mat4& Mat4::RotateRad(const float angleRad, const Vec3& axis)
 {
-    *this = WithRotationRad(angleRad, axis);
+    const Vec3 n = axis.Normalize();
+    const float c = std::cos(angleRad);
+    const float s = std::sin(angleRad);
+    const Vec3 t = n * (1.0f - c);
+
+    // Rodrigues' rotation formula, column-major
+    const float r[3][3] = {
+        { c + t.x * n.x,       t.x * n.y + s * n.z, t.x * n.z - s * n.y },
+        { t.y * n.x - s * n.z, c + t.y * n.y,       t.y * n.z + s * n.x },
+        { t.z * n.x + s * n.y, t.z * n.y - s * n.x, c + t.z * n.z       },
+    };
+    MultiplyBasis(r);
     return *this;
 }
 
 Mat4& Mat4::RotateDeg(const float angleDeg, const Vec3& axis)
 {
-    *this = WithRotationDeg(angleDeg, axis);
-    return *this;
+    return RotateRad(angleDeg * DEG_TO_RAD, axis);
 }
 
 Mat4& Mat4::RotateRad(const Vec3& eulerAnglesRad)
 {
-    *this = WithRotationRad(eulerAnglesRad);
-    return *this;
+    return Rotate(Quat::FromEulerAnglesRad(eulerAnglesRad));
 }
 
 Mat4& Mat4::RotateDeg(const Vec3& eulerAnglesDeg)
 {
-    *this = WithRotationDeg(eulerAnglesDeg);
-    return *this;
+    return Rotate(Quat::FromEulerAnglesDeg(eulerAnglesDeg));
 }
 
 Mat4& Mat4::Rotate(const Quat& quat)
 {
-    *this = WithRotation(quat);
+    const detail::QuatStorage& q = quat.internal_quat;
+    const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    const float r[3][3] = {
+        { 1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz),        2.0f * (xz - wy)        },
+        { 2.0f * (xy - wz),        1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)        },
+        { 2.0f * (xz + wy),        2.0f * (yz - wx),        1.0f - 2.0f * (xx + yy) },
+    };
+    MultiplyBasis(r);
     return *this;
 }
 
 Mat4 Mat4::WithTranslation(const Vec3& displacement) const
 {
-    return glm::translate(internal_mat, static_cast<glm::vec3>(displacement));
+    Mat4 result = *this;
+    return result.Translate(displacement);
 }
 
 Mat4 Mat4::WithScale(const Vec3& scale) const
 {
-    return glm::scale(internal_mat, static_cast<glm::vec3>(scale));
+    Mat4 result = *this;
+    return result.Scale(scale);
 }
 
 Mat4 Mat4::WithRotationRad(const float angleRad, const Vec3& axis) const
 {
-    return glm::rotate(internal_mat, angleRad, static_cast<glm::vec3>(axis));
+    Mat4 result = *this;
+    return result.RotateRad(angleRad, axis);
 }
 
 Mat4 Mat4::WithRotationRad(const Vec3& eulerAnglesRad) const
@@ -237,17 +294,315 @@ Mat4 Mat4::WithRotation(const Quat& rotation) const
 
 Mat4 Mat4::WithInverse() const
 {
+    VELECS_MATH_ZONE("Mat4::WithInverse");
+    VELECS_MATH_STAT("Mat4::WithInverse", *this);
+#if defined(VELECS_MATH_BACKEND_NATIVE)
+    detail::Lanes4x4<float> m;
+    detail::Lanes4x4<float> inv;
+    detail::LoadLanes(*this, m);
+    detail::Inverse(m, inv);
+
+    Mat4 result(1.0f);
+    detail::StoreLanes(inv, result);
+    return result;
+#else
     return Mat4(glm::inverse(internal_mat));
+#endif
 }
 
 Mat4 Mat4::WithTranspose() const
 {
-    return Mat4(glm::transpose(internal_mat));
+    Mat4 result(1.0f);
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            result.internal_mat[col][row] = internal_mat[row][col];
+        }
+    }
+    return result;
+}
+
+Mat4 Mat4::WithAffineInverse() const
+{
+    VELECS_MATH_ZONE("Mat4::WithAffineInverse");
+    VELECS_MATH_STAT("Mat4::WithAffineInverse", *this);
+
+    // The rows of the inverse 3x3 are the cross products of its columns over the determinant.
+    // Unlike a transpose scaled by the squared column lengths, this also holds with shear.
+    const Float4 c0 = Float4::Load(&internal_mat[0][0]);
+    const Float4 c1 = Float4::Load(&internal_mat[1][0]);
+    const Float4 c2 = Float4::Load(&internal_mat[2][0]);
+    const Float4 r0 = Cross(c1, c2);
+    const Float4 r1 = Cross(c2, c0);
+    const Float4 r2 = Cross(c0, c1);
+    const Float4 d = c0 * r0;
+    const Float4 invDet = Float4(1.0f) / (Float4::Shuffle<0, 0, 0, 0>(d) + Float4::Shuffle<1, 1, 1, 1>(d) + Float4::Shuffle<2, 2, 2, 2>(d));
+
+    float rows[3][4];
+    (r0 * invDet).Store(rows[0]);
+    (r1 * invDet).Store(rows[1]);
+    (r2 * invDet).Store(rows[2]);
+
+    const float tx = internal_mat[3][0], ty = internal_mat[3][1], tz = internal_mat[3][2];
+    Mat4 result(1.0f);
+    detail::Mat4Storage& inv = result.internal_mat;
+    for (int row = 0; row < 3; ++row) {
+        inv[0][row] = rows[row][0];
+        inv[1][row] = rows[row][1];
+        inv[2][row] = rows[row][2];
+        inv[3][row] = -(rows[row][0] * tx + rows[row][1] * ty + rows[row][2] * tz);
+    }
+    return result;
+}
+
+Mat4 Mat4::WithRigidInverse() const
+{
+    VELECS_MATH_STAT("Mat4::WithRigidInverse", *this);
+
+    const detail::Mat4Storage& m = internal_mat;
+
+    detail::Mat4Storage result(1.0f);
+    for (int col = 0; col < 3; ++col) {
+        for (int row = 0; row < 3; ++row) {
+            result[col][row] = m[row][col];
+        }
+    }
+
+    const float tx = m[3][0], ty = m[3][1], tz = m[3][2];
+    for (int row = 0; row < 3; ++row) {
+        result[3][row] = -(m[row][0] * tx + m[row][1] * ty + m[row][2] * tz);
+    }
+    return Mat4(result);
+}
+
+Mat4 Mat4::MultiplyAffine(const Mat4& lhs, const Mat4& rhs)
+{
+    const detail::Mat4Storage& a = lhs.internal_mat;
+    const detail::Mat4Storage& b = rhs.internal_mat;
+
+    detail::Mat4Storage result(1.0f);
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 3; ++row) {
+            result[col][row] = a[0][row] * b[col][0] + a[1][row] * b[col][1] + a[2][row] * b[col][2];
+        }
+    }
+    for (int row = 0; row < 3; ++row) {
+        result[3][row] += a[3][row];
+    }
+    return Mat4(result);
+}
+
+Vec3A Mat4::TransformPoint(const Vec3A& point) const
+{
+    const Float4 p = point.Lanes();
+    const Float4 result =
+        Float4::Load(&internal_mat[0][0]) * Float4::Shuffle<0, 0, 0, 0>(p) +
+        Float4::Load(&internal_mat[1][0]) * Float4::Shuffle<1, 1, 1, 1>(p) +
+        Float4::Load(&internal_mat[2][0]) * Float4::Shuffle<2, 2, 2, 2>(p) +
+        Float4::Load(&internal_mat[3][0]);
+    return Vec3A(result / Float4::Shuffle<3, 3, 3, 3>(result));
+}
+
+Vec3A Mat4::TransformDirection(const Vec3A& direction) const
+{
+    const Float4 d = direction.Lanes();
+    return Vec3A(
+        Float4::Load(&internal_mat[0][0]) * Float4::Shuffle<0, 0, 0, 0>(d) +
+        Float4::Load(&internal_mat[1][0]) * Float4::Shuffle<1, 1, 1, 1>(d) +
+        Float4::Load(&internal_mat[2][0]) * Float4::Shuffle<2, 2, 2, 2>(d)
+    );
+}
+
+void Mat4::InverseMany(Span<const Mat4> matrices, Span<Mat4> inverses)
+{
+    VELECS_MATH_ZONE_N("Mat4::InverseMany", matrices.size());
+
+    const std::size_t count = matrices.size();
+    if (inverses.size() < count) {
+        throw std::invalid_argument("Mat4::InverseMany output span is smaller than the input");
+    }
+
+    const Mat4* src = matrices.data();
+    Mat4* dst = inverses.data();
+    detail::ForEachLanes(count,
+        [src, dst](const std::size_t i) {
+            detail::Lanes4x4<Float4> m;
+            detail::Lanes4x4<Float4> inv;
+            detail::LoadLanes(src + i, m);
+            detail::Inverse(m, inv);
+            detail::StoreLanes(inv, dst + i);
+        },
+        [src, dst](const std::size_t i) {
+            detail::Lanes4x4<float> m;
+            detail::Lanes4x4<float> inv;
+            detail::LoadLanes(src[i], m);
+            detail::Inverse(m, inv);
+            detail::StoreLanes(inv, dst[i]);
+        }
+    );
+}
+
+void Mat4::AffineInverseMany(Span<const Mat4> matrices, Span<Mat4> inverses)
+{
+    VELECS_MATH_ZONE_N("Mat4::AffineInverseMany", matrices.size());
+
+    const std::size_t count = matrices.size();
+    if (inverses.size() < count) {
+        throw std::invalid_argument("Mat4::AffineInverseMany output span is smaller than the input");
+    }
+
+    const Mat4* src = matrices.data();
+    Mat4* dst = inverses.data();
+    detail::ForEachLanes(count,
+        [src, dst](const std::size_t i) {
+            detail::Lanes4x4<Float4> m;
+            detail::Lanes4x4<Float4> inv;
+            detail::LoadLanes(src + i, m);
+            detail::AffineInverse(m, inv);
+            detail::StoreLanes(inv, dst + i);
+        },
+        [src, dst](const std::size_t i) {
+            detail::Lanes4x4<float> m;
+            detail::Lanes4x4<float> inv;
+            detail::LoadLanes(src[i], m);
+            detail::AffineInverse(m, inv);
+            detail::StoreLanes(inv, dst[i]);
+        }
+    );
 }
 
 Mat4 Mat4::Hadamard(const Mat4& lhs, const Mat4& rhs)
 {
-    return Mat4(glm::matrixCompMult(lhs.internal_mat, rhs.internal_mat));
+    Mat4 result(1.0f);
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            result.internal_mat[col][row] = lhs.internal_mat[col][row] * rhs.internal_mat[col][row];
+        }
+    }
+    return result;
+}
+
+bool Mat4::Decompose(Vec3& translation, Quat& rotation, Vec3& scale) const
+{
+    VELECS_MATH_ZONE("Mat4::Decompose");
+    VELECS_MATH_STAT("Mat4::Decompose", *this);
+
+    const detail::Mat4Storage& m = internal_mat;
+
+    // Projective matrices (non-zero bottom row xyz) have no TRS equivalent
+    const float w = m[3][3];
+    if (w == 0.0f || m[0][3] != 0.0f || m[1][3] != 0.0f || m[2][3] != 0.0f) {
+        translation = Vec3::ZERO;
+        rotation = Quat::IDENTITY;
+        scale = Vec3::ONE;
+        return false;
+    }
+
+    const float invW = 1.0f / w;
+    translation = Vec3(m[3][0] * invW, m[3][1] * invW, m[3][2] * invW);
+
+    Vec3 x(m[0][0] * invW, m[0][1] * invW, m[0][2] * invW);
+    Vec3 y(m[1][0] * invW, m[1][1] * invW, m[1][2] * invW);
+    Vec3 z(m[2][0] * invW, m[2][1] * invW, m[2][2] * invW);
+
+    // Gram-Schmidt: strip the shear between the axes as we measure their lengths
+    scale.x = x.L2Norm();
+    if (scale.x == 0.0f) { rotation = Quat::IDENTITY; return false; }
+    x /= scale.x;
+
+    y -= x * Vec3::Dot(x, y);
+    scale.y = y.L2Norm();
+    if (scale.y == 0.0f) { rotation = Quat::IDENTITY; return false; }
+    y /= scale.y;
+
+    z -= x * Vec3::Dot(x, z);
+    z -= y * Vec3::Dot(y, z);
+    scale.z = z.L2Norm();
+    if (scale.z == 0.0f) { rotation = Quat::IDENTITY; return false; }
+    z /= scale.z;
+
+    // A left-handed basis means the matrix contains a reflection; fold it into the x scale
+    if (Vec3::Dot(x, Vec3::Cross(y, z)) < 0.0f) {
+        scale.x = -scale.x;
+        x = -x;
+    }
+
+    rotation = Quat::FromBasis(x, y, z);
+    return true;
+}
+
+void Mat4::DecomposeAffine(Vec3& translation, Quat& rotation, Vec3& scale) const
+{
+    const detail::Mat4Storage& m = internal_mat;
+
+    translation = Vec3(m[3][0], m[3][1], m[3][2]);
+
+    Vec3 x(m[0][0], m[0][1], m[0][2]);
+    Vec3 y(m[1][0], m[1][1], m[1][2]);
+    Vec3 z(m[2][0], m[2][1], m[2][2]);
+
+    scale = Vec3(x.L2Norm(), y.L2Norm(), z.L2Norm());
+    if (scale.x == 0.0f || scale.y == 0.0f || scale.z == 0.0f) {
+        rotation = Quat::IDENTITY;
+        return;
+    }
+
+    // Sign of the determinant, i.e. whether the basis is mirrored
+    if (Vec3::Dot(x, Vec3::Cross(y, z)) < 0.0f) {
+        scale.x = -scale.x;
+    }
+
+    rotation = Quat::FromBasis(x / scale.x, y / scale.y, z / scale.z);
+}
+
+std::size_t Mat4::DecomposeMany(
+    Span<const Mat4> matrices,
+    Span<Vec3> translations,
+    Span<Quat> rotations,
+    Span<Vec3> scales,
+    const bool knownAffine/* = false*/
+)
+{
+    VELECS_MATH_ZONE_N("Mat4::DecomposeMany", matrices.size());
+
+    const std::size_t count = matrices.size();
+    if (translations.size() < count || rotations.size() < count || scales.size() < count) {
+        throw std::invalid_argument("Mat4::DecomposeMany output spans are smaller than the input");
+    }
+
+    if (knownAffine) {
+        for (std::size_t i = 0; i < count; ++i) {
+            matrices[i].DecomposeAffine(translations[i], rotations[i], scales[i]);
+        }
+        return 0;
+    }
+
+    std::size_t failures = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!matrices[i].Decompose(translations[i], rotations[i], scales[i])) {
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+Point3 operator*(const Mat4& lhs, const Point3& rhs)
+{
+    const detail::Mat4Storage& m = lhs.internal_mat;
+    return Point3(
+        m[0][0] * rhs.x + m[1][0] * rhs.y + m[2][0] * rhs.z + m[3][0],
+        m[0][1] * rhs.x + m[1][1] * rhs.y + m[2][1] * rhs.z + m[3][1],
+        m[0][2] * rhs.x + m[1][2] * rhs.y + m[2][2] * rhs.z + m[3][2]
+    );
+}
+
+Dir3 operator*(const Mat4& lhs, const Dir3& rhs)
+{
+    const detail::Mat4Storage& m = lhs.internal_mat;
+    return Dir3(
+        m[0][0] * rhs.x + m[1][0] * rhs.y + m[2][0] * rhs.z,
+        m[0][1] * rhs.x + m[1][1] * rhs.y + m[2][1] * rhs.z,
+        m[0][2] * rhs.x + m[1][2] * rhs.y + m[2][2] * rhs.z
+    );
 }
 
 // Protected Fields
@@ -258,4 +613,17 @@ Mat4 Mat4::Hadamard(const Mat4& lhs, const Mat4& rhs)
 
 // Private Methods
 
+void Mat4::MultiplyBasis(const float (&r)[3][3])
+{
+    detail::Mat4Storage& m = internal_mat;
+    for (int row = 0; row < 4; ++row) {
+        const float m0 = m[0][row];
+        const float m1 = m[1][row];
+        const float m2 = m[2][row];
+        m[0][row] = m0 * r[0][0] + m1 * r[0][1] + m2 * r[0][2];
+        m[1][row] = m0 * r[1][0] + m1 * r[1][1] + m2 * r[1][2];
+        m[2][row] = m0 * r[2][0] + m1 * r[2][1] + m2 * r[2][2];
+    }
+}
+
 } // namespace velecs::math
@@ -0,0 +1,35 @@
+/// @file    Numa.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 01:15:03
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Numa.hpp"
+
+#include "detail/WorkerPool.hpp"
+
+namespace velecs::math {
+
+// Public Methods
+
+std::size_t NumaNodeCount()
+{
+    return detail::WorkerPool::Shared().NodeCount();
+}
+
+namespace detail {
+
+void ParallelForNuma(const std::size_t count, const std::size_t grain, void (*fn)(void*, std::size_t, std::size_t), void* context)
+{
+    WorkerPool::Shared().ParallelFor(count, grain, [fn, context](const std::size_t begin, const std::size_t end) {
+        fn(context, begin, end);
+    });
+}
+
+} // namespace detail
+
+} // namespace velecs::math
@@ -0,0 +1,351 @@
+/// @file    Packing.cpp
+/// @author  Matthew Green
+/// @date    2026-10-17 22:41:52
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Packing.hpp"
+#include "velecs/math/Vec2.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Simd.hpp"
+#include "velecs/math/Profile.hpp"
+
+#include "detail/MatrixKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+#if defined(VELECS_MATH_SSE) && defined(__F16C__)
+    #include <immintrin.h>
+#endif
+
+namespace velecs::math {
+
+namespace {
+
+constexpr std::size_t STAGING_BYTES = 4096;               /// @brief Size of the cache-resident staging block.
+constexpr std::size_t STREAMING_THRESHOLD = 64 * 1024;    /// @brief Upload size from which StoreHint::Auto streams.
+
+inline std::size_t RoundUp(const std::size_t value, const std::size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+/// @brief Layout of a float or half vector with the given number of components.
+PackedLayout VectorLayout(const PackOptions& options, const std::size_t components)
+{
+    const std::size_t base = options.halfPrecision ? 2 : 4;
+    const std::size_t size = components * base;
+
+    std::size_t alignment = base;
+    if (options.layout != BufferLayout::Scalar) {
+        alignment = (components == 1) ? base : (components == 2) ? 2 * base : 4 * base;
+    }
+
+    std::size_t stride = RoundUp(size, alignment);
+    if (options.layout == BufferLayout::Std140) {
+        stride = RoundUp(stride, 16);
+        alignment = std::max<std::size_t>(alignment, 16);
+    }
+    return PackedLayout{ stride, alignment, stride };
+}
+
+bool UseStreaming(const PackOptions& options, const void* dst, const std::size_t bytes)
+{
+    const bool aligned = (reinterpret_cast<std::uintptr_t>(dst) & 15u) == 0;
+    switch (options.store) {
+        case StoreHint::Cached:
+            return false;
+        case StoreHint::Streaming:
+            return aligned;
+        case StoreHint::Auto:
+        default:
+            return aligned && bytes >= STREAMING_THRESHOLD;
+    }
+}
+
+/// @brief Copies bytes out, with non-temporal stores for all full 16-byte blocks if requested.
+void CopyOut(std::byte* dst, const std::byte* src, const std::size_t bytes, const bool streaming)
+{
+    if (!streaming) {
+        std::memcpy(dst, src, bytes);
+        return;
+    }
+
+    std::size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        Float4::Load(reinterpret_cast<const float*>(src + i)).StoreStream(reinterpret_cast<float*>(dst + i));
+    }
+    std::memcpy(dst + i, src + i, bytes - i);
+}
+
+/// @brief Writes n float components, converting to half precision if requested.
+inline void WriteComponents(std::byte* dst, const float* values, const int n, const bool half)
+{
+    if (!half) {
+        std::memcpy(dst, values, n * sizeof(float));
+        return;
+    }
+
+#if defined(VELECS_MATH_SSE) && defined(__F16C__)
+    if (n == 4) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_cvtps_ph(_mm_loadu_ps(values), _MM_FROUND_TO_NEAREST_INT));
+        return;
+    }
+#endif
+
+    for (int i = 0; i < n; ++i) {
+        const std::uint16_t bits = FloatToHalf(values[i]);
+        std::memcpy(dst + i * sizeof(bits), &bits, sizeof(bits));
+    }
+}
+
+/// @brief Copies a source array whose memory layout already matches the destination.
+std::size_t PackDirect(void* mapped, const void* src, const std::size_t bytes, const PackOptions& options)
+{
+    const bool streaming = UseStreaming(options, mapped, bytes);
+    CopyOut(static_cast<std::byte*>(mapped), static_cast<const std::byte*>(src), bytes, streaming);
+    if (streaming) {
+        Float4::StreamFence();
+    }
+    return bytes;
+}
+
+/// @brief Packs elements one at a time into a zeroed staging block, then writes each block out.
+/// @param write Callable taking (const T& element, std::byte* destination).
+template<typename T, typename Write>
+std::size_t PackStaged(void* mapped, Span<const T> src, const std::size_t stride, const PackOptions& options, Write&& write)
+{
+    const std::size_t bytes = src.size() * stride;
+    const bool streaming = UseStreaming(options, mapped, bytes);
+
+    // Keep every block a multiple of 16 bytes so streamed blocks stay aligned
+    const std::size_t unit = 16 / std::gcd(stride, std::size_t{ 16 });
+    const std::size_t perBlock = std::max<std::size_t>(STAGING_BYTES / stride / unit * unit, 1);
+
+    alignas(64) std::byte staging[STAGING_BYTES];
+    std::byte* out = static_cast<std::byte*>(mapped);
+    for (std::size_t first = 0; first < src.size(); first += perBlock) {
+        const std::size_t count = std::min(perBlock, src.size() - first);
+        std::memset(staging, 0, count * stride);
+        for (std::size_t i = 0; i < count; ++i) {
+            write(src[first + i], staging + i * stride);
+        }
+        CopyOut(out, staging, count * stride, streaming);
+        out += count * stride;
+    }
+
+    if (streaming) {
+        Float4::StreamFence();
+    }
+    return bytes;
+}
+
+} // namespace
+
+// Public Methods
+
+template<>
+PackedLayout LayoutOf<Vec2>(const PackOptions& options)
+{
+    return VectorLayout(options, 2);
+}
+
+template<>
+PackedLayout LayoutOf<Vec3>(const PackOptions& options)
+{
+    return VectorLayout(options, 3);
+}
+
+template<>
+PackedLayout LayoutOf<Vec4>(const PackOptions& options)
+{
+    return VectorLayout(options, 4);
+}
+
+template<>
+PackedLayout LayoutOf<Mat4>(const PackOptions& options)
+{
+    const bool isNormal = options.matrix == MatrixPacking::Normal3x3;
+    const std::size_t columns = (options.matrix == MatrixPacking::Full) ? 4 : 3;
+    const PackedLayout column = VectorLayout(options, isNormal ? 3 : 4);
+    return PackedLayout{ columns * column.stride, column.alignment, column.stride };
+}
+
+std::size_t PackInto(void* mapped, Span<const Vec2> src, const PackOptions& options/* = {}*/)
+{
+    VELECS_MATH_ZONE_N("PackInto", src.size());
+
+    const PackedLayout layout = LayoutOf<Vec2>(options);
+    if (!options.halfPrecision && layout.stride == sizeof(Vec2)) {
+        return PackDirect(mapped, src.data(), src.size_bytes(), options);
+    }
+
+    const bool half = options.halfPrecision;
+    return PackStaged(mapped, src, layout.stride, options,
+        [half](const Vec2& v, std::byte* dst) {
+            const float values[2] = { v.x, v.y };
+            WriteComponents(dst, values, 2, half);
+        }
+    );
+}
+
+std::size_t PackInto(void* mapped, Span<const Vec3> src, const PackOptions& options/* = {}*/)
+{
+    VELECS_MATH_ZONE_N("PackInto", src.size());
+
+    const PackedLayout layout = LayoutOf<Vec3>(options);
+    if (!options.halfPrecision && layout.stride == sizeof(Vec3)) {
+        return PackDirect(mapped, src.data(), src.size_bytes(), options);
+    }
+
+    const bool half = options.halfPrecision;
+    return PackStaged(mapped, src, layout.stride, options,
+        [half](const Vec3& v, std::byte* dst) {
+            const float values[3] = { v.x, v.y, v.z };
+            WriteComponents(dst, values, 3, half);
+        }
+    );
+}
+
+std::size_t PackInto(void* mapped, Span<const Vec4> src, const PackOptions& options/* = {}*/)
+{
+    VELECS_MATH_ZONE_N("PackInto", src.size());
+
+    const PackedLayout layout = LayoutOf<Vec4>(options);
+    if (!options.halfPrecision && layout.stride == sizeof(Vec4)) {
+        return PackDirect(mapped, src.data(), src.size_bytes(), options);
+    }
+
+    const bool half = options.halfPrecision;
+    return PackStaged(mapped, src, layout.stride, options,
+        [half](const Vec4& v, std::byte* dst) {
+            const float values[4] = { v.x, v.y, v.z, v.w };
+            WriteComponents(dst, values, 4, half);
+        }
+    );
+}
+
+std::size_t PackInto(void* mapped, Span<const Mat4> src, const PackOptions& options/* = {}*/)
+{
+    VELECS_MATH_ZONE_N("PackInto", src.size());
+
+    const PackedLayout layout = LayoutOf<Mat4>(options);
+    const bool half = options.halfPrecision;
+    const std::size_t columnStride = layout.columnStride;
+
+    switch (options.matrix) {
+        case MatrixPacking::Affine3x4:
+            return PackStaged(mapped, src, layout.stride, options,
+                [half, columnStride](const Mat4& mat, std::byte* dst) {
+                    const detail::Mat4Storage& m = mat.internal_mat;
+                    for (int row = 0; row < 3; ++row) {
+                        const float values[4] = { m[0][row], m[1][row], m[2][row], m[3][row] };
+                        WriteComponents(dst + row * columnStride, values, 4, half);
+                    }
+                }
+            );
+
+        case MatrixPacking::Normal3x3:
+            return PackStaged(mapped, src, layout.stride, options,
+                [half, columnStride](const Mat4& mat, std::byte* dst) {
+                    // The normal matrix is the inverse transpose of the upper 3x3
+                    detail::Lanes4x4<float> m;
+                    detail::Lanes4x4<float> inv;
+                    detail::LoadLanes(mat, m);
+                    detail::AffineInverse(m, inv);
+                    for (int col = 0; col < 3; ++col) {
+                        const float values[3] = { inv[0][col], inv[1][col], inv[2][col] };
+                        WriteComponents(dst + col * columnStride, values, 3, half);
+                    }
+                }
+            );
+
+        case MatrixPacking::Full:
+        default:
+            if (!half && layout.stride == sizeof(Mat4)) {
+                return PackDirect(mapped, src.data(), src.size_bytes(), options);
+            }
+            return PackStaged(mapped, src, layout.stride, options,
+                [half, columnStride](const Mat4& mat, std::byte* dst) {
+                    for (int col = 0; col < 4; ++col) {
+                        WriteComponents(dst + col * columnStride, &mat.internal_mat[col][0], 4, half);
+                    }
+                }
+            );
+    }
+}
+
+std::uint16_t FloatToHalf(const float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const std::uint32_t sign = (bits >> 16) & 0x8000u;
+    const std::uint32_t absBits = bits & 0x7FFFFFFFu;
+
+    if (absBits >= 0x7F800000u) {
+        // Infinity stays infinity, NaN stays a quiet NaN
+        return static_cast<std::uint16_t>(sign | 0x7C00u | (absBits > 0x7F800000u ? 0x200u : 0u));
+    }
+    if (absBits >= 0x477FF000u) {
+        // 65520 and up round past the largest half (65504)
+        return static_cast<std::uint16_t>(sign | 0x7C00u);
+    }
+    if (absBits < 0x38800000u) {
+        // Below the smallest normal half (2^-14): produce a subnormal or zero
+        if (absBits <= 0x33000000u) {
+            return static_cast<std::uint16_t>(sign); // 2^-25 and below round to zero
+        }
+        const std::uint32_t mantissa = (absBits & 0x007FFFFFu) | 0x00800000u;
+        const std::uint32_t shift = 126u - (absBits >> 23);
+        std::uint32_t result = mantissa >> shift;
+        const std::uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const std::uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (result & 1u))) {
+            ++result;
+        }
+        return static_cast<std::uint16_t>(sign | result);
+    }
+
+    // Normal: rebias the exponent from 127 to 15 and round the mantissa from 23 to 10 bits
+    std::uint32_t result = (absBits - 0x38000000u) >> 13;
+    const std::uint32_t remainder = absBits & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1u))) {
+        ++result;
+    }
+    return static_cast<std::uint16_t>(sign | result);
+}
+
+float HalfToFloat(const std::uint16_t half)
+{
+    const std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000u) << 16;
+    const std::uint32_t exponent = (half >> 10) & 0x1Fu;
+    const std::uint32_t mantissa = half & 0x3FFu;
+
+    if (exponent == 0) {
+        const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+    }
+
+    std::uint32_t bits;
+    if (exponent == 0x1Fu) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+} // namespace velecs::math
@@ -0,0 +1,40 @@
+/// @file    Point3.cpp
+/// @author  Matthew Green
+/// @date    2026-10-17 21:59:05
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Point3.hpp"
+
+#include <sstream>
+
+namespace velecs::math {
+
+// Public Fields
+
+const Point3 Point3::ORIGIN { 0.0f, 0.0f, 0.0f };
+
+// Constructors and Destructors
+
+// Public Methods
+
+std::string Point3::ToString() const
+{
+    std::ostringstream oss;
+    oss << '(' << x << ", " << y << ", " << z << ')';
+    return oss.str();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::math
@@ -0,0 +1,244 @@
+/// @file    Profile.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 02:33:47
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Profile.hpp"
+
+#if defined(VELECS_MATH_PROFILE)
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+
+namespace velecs::math {
+
+namespace {
+
+std::atomic<ProfileSink*> g_sink{ nullptr };
+std::atomic<detail::ProfileCounter*> g_counters{ nullptr };
+std::atomic<std::uint32_t> g_nextThread{ 0 };
+
+/// @brief Nanoseconds since the first call in the process.
+std::uint64_t Now()
+{
+    using Clock = std::chrono::steady_clock;
+    static const Clock::time_point epoch = Clock::now();
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch).count());
+}
+
+std::uint32_t ThreadId()
+{
+    thread_local const std::uint32_t id = g_nextThread.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+void WriteJsonString(std::ostream& out, const char* text)
+{
+    out << '"';
+    for (const char* c = text; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') out << '\\';
+        out << *c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+// Public Methods
+
+void SetProfileSink(ProfileSink* sink)
+{
+    g_sink.store(sink, std::memory_order_release);
+}
+
+std::vector<ProfileStats> GetProfileStats()
+{
+    std::vector<ProfileStats> stats;
+    for (const detail::ProfileCounter* counter = g_counters.load(std::memory_order_acquire); counter != nullptr; counter = counter->next) {
+        const std::uint64_t calls = counter->calls.load(std::memory_order_relaxed);
+        if (calls == 0) continue;
+        stats.push_back(ProfileStats{
+            counter->name,
+            calls,
+            counter->elements.load(std::memory_order_relaxed),
+            counter->totalNs.load(std::memory_order_relaxed),
+        });
+    }
+
+    // Overloads share a name but have their own counters; report them as one operation.
+    std::sort(stats.begin(), stats.end(), [](const ProfileStats& a, const ProfileStats& b) {
+        return std::string_view(a.name) < std::string_view(b.name);
+    });
+    std::vector<ProfileStats> merged;
+    for (const ProfileStats& s : stats) {
+        if (!merged.empty() && std::string_view(merged.back().name) == s.name) {
+            merged.back().calls += s.calls;
+            merged.back().elements += s.elements;
+            merged.back().totalNs += s.totalNs;
+        }
+        else {
+            merged.push_back(s);
+        }
+    }
+
+    std::sort(merged.begin(), merged.end(), [](const ProfileStats& a, const ProfileStats& b) {
+        return a.totalNs > b.totalNs;
+    });
+    return merged;
+}
+
+void ResetProfileStats()
+{
+    for (detail::ProfileCounter* counter = g_counters.load(std::memory_order_acquire); counter != nullptr; counter = counter->next) {
+        counter->calls.store(0, std::memory_order_relaxed);
+        counter->elements.store(0, std::memory_order_relaxed);
+        counter->totalNs.store(0, std::memory_order_relaxed);
+    }
+}
+
+// RingBufferSink
+
+RingBufferSink::RingBufferSink(const std::size_t capacity)
+    : _capacity(capacity)
+{
+    if (capacity == 0) {
+        throw std::invalid_argument("RingBufferSink capacity must be greater than 0");
+    }
+    _events.reserve(capacity);
+}
+
+void RingBufferSink::OnZone(const ProfileEvent& event)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_events.size() < _capacity) {
+        _events.push_back(event);
+    }
+    else {
+        _events[_next] = event;
+    }
+    _next = (_next + 1) % _capacity;
+    ++_total;
+}
+
+std::vector<ProfileEvent> RingBufferSink::Events() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_events.size() < _capacity) return _events;
+
+    std::vector<ProfileEvent> ordered(_events.begin() + _next, _events.end());
+    ordered.insert(ordered.end(), _events.begin(), _events.begin() + _next);
+    return ordered;
+}
+
+std::uint64_t RingBufferSink::Dropped() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _total - _events.size();
+}
+
+void RingBufferSink::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _events.clear();
+    _next = 0;
+    _total = 0;
+}
+
+// ChromeTraceSink
+
+ChromeTraceSink::ChromeTraceSink(std::string path)
+    : _path(std::move(path)) {}
+
+ChromeTraceSink::~ChromeTraceSink()
+{
+    if (_dirty) Flush();
+}
+
+void ChromeTraceSink::OnZone(const ProfileEvent& event)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _events.push_back(event);
+    _dirty = true;
+}
+
+bool ChromeTraceSink::Flush()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const bool written = Write(_path, Span<const ProfileEvent>(_events.data(), _events.size()));
+    if (written) _dirty = false;
+    return written;
+}
+
+void ChromeTraceSink::Write(std::ostream& out, Span<const ProfileEvent> events)
+{
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        const ProfileEvent& e = events[i];
+        out << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        WriteJsonString(out, e.name);
+        out << ",\"cat\":\"velecs-math\",\"ph\":\"X\",\"pid\":0,\"tid\":" << e.thread
+            << ",\"ts\":" << static_cast<double>(e.startNs) / 1000.0
+            << ",\"dur\":" << static_cast<double>(e.durationNs) / 1000.0
+            << ",\"args\":{\"elements\":" << e.elements << "}}";
+    }
+    out << "\n]}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+bool ChromeTraceSink::Write(const std::string& path, Span<const ProfileEvent> events)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) return false;
+    Write(file, events);
+    return static_cast<bool>(file);
+}
+
+namespace detail {
+
+// ProfileCounter
+
+ProfileCounter::ProfileCounter(const char* name)
+    : name(name)
+{
+    next = g_counters.load(std::memory_order_relaxed);
+    while (!g_counters.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {}
+}
+
+// ProfileZone
+
+ProfileZone::ProfileZone(ProfileCounter& counter, const std::uint64_t elements)
+    : _counter(counter), _elements(elements), _start(Now()) {}
+
+ProfileZone::~ProfileZone()
+{
+    const std::uint64_t duration = Now() - _start;
+    _counter.calls.fetch_add(1, std::memory_order_relaxed);
+    _counter.elements.fetch_add(_elements, std::memory_order_relaxed);
+    _counter.totalNs.fetch_add(duration, std::memory_order_relaxed);
+
+    if (ProfileSink* sink = g_sink.load(std::memory_order_acquire)) {
+        sink->OnZone(ProfileEvent{ _counter.name, _start, duration, _elements, ThreadId() });
+    }
+}
+
+} // namespace detail
+
+} // namespace velecs::math
+
+#endif
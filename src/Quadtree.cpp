@@ -0,0 +1,215 @@
+/// @file    Quadtree.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 08:34:40
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Quadtree.hpp"
+#include "velecs/math/Consts.hpp"
+#include "velecs/math/Simd.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace velecs::math {
+
+namespace {
+
+/// @brief The squared distance from a point to the nearest point of each lane's box.
+inline Float4 DistanceSq(const Float4 dx, const Float4 dy)
+{
+    const Float4 zero(0.0f);
+    const Float4 x = Float4::Max(dx, zero);
+    const Float4 y = Float4::Max(dy, zero);
+    return x * x + y * y;
+}
+
+} // namespace
+
+Quadtree::Quadtree(Span<const Rect> items, const std::uint32_t maxDepth)
+    : _size(items.size())
+{
+    if (items.size() >= INVALID) {
+        throw std::invalid_argument("Quadtree supports fewer than 2^32 - 1 items");
+    }
+    if (items.empty()) return;
+
+    Rect bounds = Rect::EMPTY;
+    for (const Rect& item : items) {
+        if (!item.IsEmpty()) bounds = Rect::Merge(bounds, item);
+    }
+
+    // Without a non-empty item there is nothing to split; keep everything in the root.
+    const bool splittable = !bounds.IsEmpty();
+    const Vec2 center = splittable ? bounds.Center() : Vec2::ZERO;
+    const Vec2 half = splittable ? bounds.Extents() : Vec2::ZERO;
+    _nodes.push_back(Node{ { center.x, center.y }, { half.x, half.y }, INVALID, 0, 0 });
+
+    std::vector<std::uint32_t> ids(items.size());
+    std::iota(ids.begin(), ids.end(), 0u);
+    Build(0, items, ids, 0, splittable ? maxDepth : 0);
+}
+
+void Quadtree::QueryPoint(const Vec2 point, std::vector<std::uint32_t>& out) const
+{
+    out.clear();
+    const Float4 px(point.x);
+    const Float4 py(point.y);
+    Query(
+        [&](const Float4 cx, const Float4 cy, const Float4 hx, const Float4 hy) {
+            return Float4::LessEqual(Float4::Abs(cx - px), hx) & Float4::LessEqual(Float4::Abs(cy - py), hy);
+        },
+        [&](const Float4 minX, const Float4 minY, const Float4 maxX, const Float4 maxY) {
+            return Float4::LessEqual(minX, px) & Float4::LessEqual(px, maxX)
+                & Float4::LessEqual(minY, py) & Float4::LessEqual(py, maxY);
+        },
+        [&](const std::uint32_t id) { out.push_back(id); });
+}
+
+void Quadtree::QueryRect(const Rect& rect, std::vector<std::uint32_t>& out) const
+{
+    out.clear();
+    const Vec2 center = rect.Center();
+    const Vec2 extents = rect.Extents();
+    Query(
+        [&](const Float4 cx, const Float4 cy, const Float4 hx, const Float4 hy) {
+            return Float4::LessEqual(Float4::Abs(cx - Float4(center.x)), hx + Float4(extents.x))
+                & Float4::LessEqual(Float4::Abs(cy - Float4(center.y)), hy + Float4(extents.y));
+        },
+        [&](const Float4 minX, const Float4 minY, const Float4 maxX, const Float4 maxY) {
+            return Float4::LessEqual(minX, Float4(rect.max.x)) & Float4::LessEqual(Float4(rect.min.x), maxX)
+                & Float4::LessEqual(minY, Float4(rect.max.y)) & Float4::LessEqual(Float4(rect.min.y), maxY);
+        },
+        [&](const std::uint32_t id) { out.push_back(id); });
+}
+
+void Quadtree::QueryRadius(const Vec2 center, const float radius, std::vector<std::uint32_t>& out) const
+{
+    out.clear();
+    const Float4 px(center.x);
+    const Float4 py(center.y);
+    const Float4 radiusSq(radius * radius);
+    Query(
+        [&](const Float4 cx, const Float4 cy, const Float4 hx, const Float4 hy) {
+            return Float4::LessEqual(DistanceSq(Float4::Abs(cx - px) - hx, Float4::Abs(cy - py) - hy), radiusSq);
+        },
+        [&](const Float4 minX, const Float4 minY, const Float4 maxX, const Float4 maxY) {
+            const Float4 dx = Float4::Max(minX - px, px - maxX);
+            const Float4 dy = Float4::Max(minY - py, py - maxY);
+            return Float4::LessEqual(DistanceSq(dx, dy), radiusSq);
+        },
+        [&](const std::uint32_t id) { out.push_back(id); });
+}
+
+std::uint32_t Quadtree::HitTest(const Vec2 point) const
+{
+    const Float4 px(point.x);
+    const Float4 py(point.y);
+    std::uint32_t top = INVALID;
+    Query(
+        [&](const Float4 cx, const Float4 cy, const Float4 hx, const Float4 hy) {
+            return Float4::LessEqual(Float4::Abs(cx - px), hx) & Float4::LessEqual(Float4::Abs(cy - py), hy);
+        },
+        [&](const Float4 minX, const Float4 minY, const Float4 maxX, const Float4 maxY) {
+            return Float4::LessEqual(minX, px) & Float4::LessEqual(px, maxX)
+                & Float4::LessEqual(minY, py) & Float4::LessEqual(py, maxY);
+        },
+        [&](const std::uint32_t id) {
+            if (top == INVALID || id > top) top = id;
+        });
+    return top;
+}
+
+void Quadtree::Build(const std::uint32_t node, Span<const Rect> items, std::vector<std::uint32_t>& ids,
+    const std::uint32_t depth, const std::uint32_t maxDepth)
+{
+    const float cx = _nodes[node].center[0];
+    const float cy = _nodes[node].center[1];
+
+    // Items that fit one quadrant move down; the rest stay here.
+    std::vector<std::uint32_t> kept;
+    std::vector<std::uint32_t> quadrants[4];
+    bool split = ids.size() > LEAF_SIZE && depth < maxDepth;
+    if (split) {
+        for (const std::uint32_t id : ids) {
+            const Rect& item = items[id];
+            const int qx = item.max.x <= cx ? 0 : item.min.x >= cx ? 1 : -1;
+            const int qy = item.max.y <= cy ? 0 : item.min.y >= cy ? 1 : -1;
+            if (qx < 0 || qy < 0) kept.push_back(id);
+            else quadrants[qx | (qy << 1)].push_back(id);
+        }
+        split = kept.size() != ids.size();
+    }
+    if (!split) kept.swap(ids);
+
+    const std::size_t first = _ids.size();
+    const std::size_t slots = (kept.size() + Float4::WIDTH - 1) / Float4::WIDTH * Float4::WIDTH;
+    _minX.resize(first + slots, FLOAT_POS_INFINITY);
+    _minY.resize(first + slots, FLOAT_POS_INFINITY);
+    _maxX.resize(first + slots, FLOAT_NEG_INFINITY);
+    _maxY.resize(first + slots, FLOAT_NEG_INFINITY);
+    _ids.resize(first + slots, INVALID);
+    for (std::size_t i = 0; i < kept.size(); ++i) {
+        const Rect& item = items[kept[i]];
+        _minX[first + i] = item.min.x;
+        _minY[first + i] = item.min.y;
+        _maxX[first + i] = item.max.x;
+        _maxY[first + i] = item.max.y;
+        _ids[first + i] = kept[i];
+    }
+    _nodes[node].first = static_cast<std::uint32_t>(first);
+    _nodes[node].slots = static_cast<std::uint32_t>(slots);
+    if (!split) return;
+
+    // The four children are adjacent, so a query can test them together.
+    const float hx = _nodes[node].half[0] * 0.5f;
+    const float hy = _nodes[node].half[1] * 0.5f;
+    const std::uint32_t firstChild = static_cast<std::uint32_t>(_nodes.size());
+    _nodes[node].firstChild = firstChild;
+    for (int quadrant = 0; quadrant < 4; ++quadrant) {
+        const float x = (quadrant & 1) ? cx + hx : cx - hx;
+        const float y = (quadrant & 2) ? cy + hy : cy - hy;
+        _nodes.push_back(Node{ { x, y }, { hx, hy }, INVALID, 0, 0 });
+    }
+    for (std::uint32_t quadrant = 0; quadrant < 4; ++quadrant) {
+        Build(firstChild + quadrant, items, quadrants[quadrant], depth + 1, maxDepth);
+    }
+}
+
+template<typename NodeTest, typename ItemTest, typename Visit>
+void Quadtree::Query(NodeTest&& nodeTest, ItemTest&& itemTest, Visit&& visit) const
+{
+    if (_nodes.empty()) return;
+
+    std::vector<std::uint32_t> stack{ 0 };
+    while (!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        for (std::uint32_t i = node.first; i < node.first + node.slots; i += Float4::WIDTH) {
+            const int mask = Float4::MoveMask(itemTest(
+                Float4::Load(_minX.data() + i), Float4::Load(_minY.data() + i),
+                Float4::Load(_maxX.data() + i), Float4::Load(_maxY.data() + i)));
+            for (int lane = 0; lane < Float4::WIDTH; ++lane) {
+                // Padding is never accepted except by an infinite radius, and has no id.
+                if ((mask & (1 << lane)) && _ids[i + lane] != INVALID) visit(_ids[i + lane]);
+            }
+        }
+        if (node.firstChild == INVALID) continue;
+
+        const Node* children = &_nodes[node.firstChild];
+        const Float4 cx(children[0].center[0], children[1].center[0], children[2].center[0], children[3].center[0]);
+        const Float4 cy(children[0].center[1], children[1].center[1], children[2].center[1], children[3].center[1]);
+        const int accepted = Float4::MoveMask(nodeTest(cx, cy, Float4(children[0].half[0]), Float4(children[0].half[1])));
+        for (std::uint32_t quadrant = 0; quadrant < 4; ++quadrant) {
+            if (accepted & (1 << quadrant)) stack.push_back(node.firstChild + quadrant);
+        }
+    }
+}
+
+} // namespace velecs::math
@@ -11,12 +11,36 @@
 #include "velecs/math/Quat.hpp"
 #include "velecs/math/Consts.hpp"
 #include "velecs/math/Vec3.hpp"
+#include "velecs/math/Profile.hpp"
+#include "velecs/math/Stats.hpp"
 
-#include <glm/gtc/quaternion.hpp>
-#include <glm/gtc/quaternion.hpp>
+#include "detail/MatrixKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
 
 namespace velecs::math {
 
+namespace {
+
+/// @brief The quaternion for Euler angles in radians, applied X then Y then Z as GLM does.
+inline Quat FromEuler(const float x, const float y, const float z)
+{
+    const float cx = std::cos(x * 0.5f), cy = std::cos(y * 0.5f), cz = std::cos(z * 0.5f);
+    const float sx = std::sin(x * 0.5f), sy = std::sin(y * 0.5f), sz = std::sin(z * 0.5f);
+    return Quat(
+        sx * cy * cz - cx * sy * sz,
+        cx * sy * cz + sx * cy * sz,
+        cx * cy * sz - sx * sy * cz,
+        cx * cy * cz + sx * sy * sz
+    );
+}
+
+} // namespace
+
 // Public Fields
 
 const Quat Quat::IDENTITY = Quat(0.0f, 0.0f, 0.0f, 1.0f);
@@ -27,15 +51,18 @@ const Quat Quat::IDENTITY = Quat(0.0f, 0.0f, 0.0f, 1.0f);
 
 Quat Quat::FromEulerAnglesRad(const float x, const float y, const float z)
 {
-    // Convert to GLM's quaternion from Euler angles (in radians)
-    // GLM uses the order Y-X-Z for Euler angle conversion
-    return Quat(glm::quat(glm::vec3(x, y, z)));
+    VELECS_MATH_ZONE("Quat::FromEulerAnglesRad");
+    VELECS_MATH_STAT("Quat::FromEulerAnglesRad", x, y, z);
+
+    return FromEuler(x, y, z);
 }
 
 Quat Quat::FromEulerAnglesRad(const Vec3& angles)
 {
-    // Convert Vec3 to glm::vec3 and create quaternion
-    return Quat(glm::quat(static_cast<glm::vec3>(angles)));
+    VELECS_MATH_ZONE("Quat::FromEulerAnglesRad");
+    VELECS_MATH_STAT("Quat::FromEulerAnglesRad", angles);
+
+    return FromEuler(angles.x, angles.y, angles.z);
 }
 
 Quat Quat::FromEulerAnglesDeg(const float x, const float y, const float z)
@@ -54,9 +81,90 @@ Quat Quat::FromEulerAnglesDeg(const Vec3& angles)
     return FromEulerAnglesRad(angles * DEG_TO_RAD);
 }
 
+Quat Quat::FromBasis(const Vec3& xAxis, const Vec3& yAxis, const Vec3& zAxis)
+{
+    VELECS_MATH_ZONE("Quat::FromBasis");
+    VELECS_MATH_STAT("Quat::FromBasis", xAxis, yAxis, zAxis);
+
+    // m[col][row] naming: xAxis = column 0, yAxis = column 1, zAxis = column 2
+    const float m00 = xAxis.x, m01 = xAxis.y, m02 = xAxis.z;
+    const float m10 = yAxis.x, m11 = yAxis.y, m12 = yAxis.z;
+    const float m20 = zAxis.x, m21 = zAxis.y, m22 = zAxis.z;
+
+    const float trace = m00 + m11 + m22;
+    if (trace > 0.0f) {
+        const float s = 0.5f / std::sqrt(trace + 1.0f);
+        return Quat((m12 - m21) * s, (m20 - m02) * s, (m01 - m10) * s, 0.25f / s);
+    }
+    if (m00 > m11 && m00 > m22) {
+        const float s = 0.5f / std::sqrt(1.0f + m00 - m11 - m22);
+        return Quat(0.25f / s, (m10 + m01) * s, (m20 + m02) * s, (m12 - m21) * s);
+    }
+    if (m11 > m22) {
+        const float s = 0.5f / std::sqrt(1.0f + m11 - m00 - m22);
+        return Quat((m10 + m01) * s, 0.25f / s, (m21 + m12) * s, (m20 - m02) * s);
+    }
+    const float s = 0.5f / std::sqrt(1.0f + m22 - m00 - m11);
+    return Quat((m20 + m02) * s, (m21 + m12) * s, 0.25f / s, (m01 - m10) * s);
+}
+
+Quat Quat::FromRotationMatrix(const Mat4& mat)
+{
+    return FromBasis(mat.XBasis().XYZ(), mat.YBasis().XYZ(), mat.ZBasis().XYZ());
+}
+
+Quat Quat::Slerp(const Quat& a, const Quat& b, const float t)
+{
+    VELECS_MATH_ZONE("Quat::Slerp");
+    VELECS_MATH_STAT("Quat::Slerp", a, b, t);
+
+    const detail::QuatStorage& qa = a.internal_quat;
+    detail::QuatStorage qb = b.internal_quat;
+
+    float cosTheta = qa.x * qb.x + qa.y * qb.y + qa.z * qb.z + qa.w * qb.w;
+    if (cosTheta < 0.0f) {
+        // q and -q are the same rotation; flip one to take the shorter arc.
+        qb = detail::QuatStorage(-qb.w, -qb.x, -qb.y, -qb.z);
+        cosTheta = -cosTheta;
+    }
+
+    float wa, wb;
+    if (cosTheta > 0.9995f) {
+        wa = 1.0f - t;
+        wb = t;
+    }
+    else {
+        const float theta = std::acos(cosTheta);
+        const float invSin = 1.0f / std::sin(theta);
+        wa = std::sin((1.0f - t) * theta) * invSin;
+        wb = std::sin(t * theta) * invSin;
+    }
+
+    const float x = wa * qa.x + wb * qb.x;
+    const float y = wa * qa.y + wb * qb.y;
+    const float z = wa * qa.z + wb * qb.z;
+    const float w = wa * qa.w + wb * qb.w;
+    const float invLen = 1.0f / std::sqrt(x * x + y * y + z * z + w * w);
+    return Quat(x * invLen, y * invLen, z * invLen, w * invLen);
+}
+
 Vec3 Quat::ToEulerAnglesRad() const
 {
-    return Vec3(glm::eulerAngles(internal_quat));
+    VELECS_MATH_ZONE("Quat::ToEulerAnglesRad");
+    VELECS_MATH_STAT("Quat::ToEulerAnglesRad", *this);
+
+    const float x = internal_quat.x, y = internal_quat.y, z = internal_quat.z, w = internal_quat.w;
+
+    // Same convention as glm::eulerAngles: the inverse of FromEulerAnglesRad, y in [-pi/2, pi/2]
+    const float pitchY = 2.0f * (y * z + w * x);
+    const float pitchX = w * w - x * x - y * y + z * z;
+    const float epsilon = std::numeric_limits<float>::epsilon();
+    const float pitch = (std::fabs(pitchX) <= epsilon && std::fabs(pitchY) <= epsilon)
+        ? 2.0f * std::atan2(x, w) // Gimbal lock: the x and z rotations share an axis.
+        : std::atan2(pitchY, pitchX);
+    const float yaw = std::asin(std::clamp(-2.0f * (x * z - w * y), -1.0f, 1.0f));
+    const float roll = std::atan2(2.0f * (x * y + w * z), w * w + x * x - y * y - z * z);
+    return Vec3(pitch, yaw, roll);
 }
 
 Vec3 Quat::ToEulerAnglesDeg() const
@@ -66,8 +174,55 @@ Vec3 Quat::ToEulerAnglesDeg() const
 
 Mat4 Quat::ToMatrix() const
 {
-    // Use GLM's built-in conversion from quaternion to mat4
-    return Mat4(glm::mat4_cast(internal_quat));
+    VELECS_MATH_ZONE("Quat::ToMatrix");
+    VELECS_MATH_STAT("Quat::ToMatrix", *this);
+
+    const detail::QuatStorage& q = internal_quat;
+
+    detail::Lanes4x4<float> m;
+    detail::QuatToMatrix(q.x, q.y, q.z, q.w, m);
+
+    Mat4 result(1.0f);
+    detail::StoreLanes(m, result);
+    return result;
+}
+
+void Quat::ToMatrixMany(Span<const Quat> quats, Span<Mat4> matrices)
+{
+    VELECS_MATH_ZONE_N("Quat::ToMatrixMany", quats.size());
+
+    const std::size_t count = quats.size();
+    if (matrices.size() < count) {
+        throw std::invalid_argument("Quat::ToMatrixMany output span is smaller than the input");
+    }
+
+    const Quat* src = quats.data();
+    Mat4* dst = matrices.data();
+    detail::ForEachLanes(count,
+        [src, dst](const std::size_t i) {
+            const detail::QuatStorage& q0 = src[i + 0].internal_quat;
+            const detail::QuatStorage& q1 = src[i + 1].internal_quat;
+            const detail::QuatStorage& q2 = src[i + 2].internal_quat;
+            const detail::QuatStorage& q3 = src[i + 3].internal_quat;
+
+            detail::Lanes4x4<Float4> m;
+            detail::QuatToMatrix(
+                Float4(q0.x, q1.x, q2.x, q3.x),
+                Float4(q0.y, q1.y, q2.y, q3.y),
+                Float4(q0.z, q1.z, q2.z, q3.z),
+                Float4(q0.w, q1.w, q2.w, q3.w),
+                m
+            );
+            detail::StoreLanes(m, dst + i);
+        },
+        [src, dst](const std::size_t i) {
+            const detail::QuatStorage& q = src[i].internal_quat;
+
+            detail::Lanes4x4<float> m;
+            detail::QuatToMatrix(q.x, q.y, q.z, q.w, m);
+            detail::StoreLanes(m, dst[i]);
+        }
+    );
 }
 
 // Protected Fields
@@ -0,0 +1,45 @@
+/// @file    Rect.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 08:22:10
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Rect.hpp"
+#include "velecs/math/Consts.hpp"
+
+#include <sstream>
+
+namespace velecs::math {
+
+// Public Fields
+
+const Rect Rect::EMPTY
+{
+    Vec2(FLOAT_POS_INFINITY, FLOAT_POS_INFINITY),
+    Vec2(FLOAT_NEG_INFINITY, FLOAT_NEG_INFINITY)
+};
+
+// Constructors and Destructors
+
+// Public Methods
+
+std::string Rect::ToString() const
+{
+    std::ostringstream oss;
+    oss << '[' << min.ToString() << ", " << max.ToString() << ']';
+    return oss.str();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::math
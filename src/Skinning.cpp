@@ -0,0 +1,117 @@
+/// @file    Skinning.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 01:53:02
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Skinning.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Simd.hpp"
+#include "velecs/math/Profile.hpp"
+
+#include "detail/WorkerPool.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace velecs::math {
+
+namespace {
+
+/// @brief Elements per work item when running in parallel.
+constexpr std::size_t GRAIN = 2048;
+
+/// @brief Checks the spans and every bone index before any work is handed to the pool,
+///        since the kernel itself must not throw.
+void Validate(Span<const Mat4> bones, Span<const BoneInfluence> influences, const std::size_t count, const std::size_t outCount, const char* name)
+{
+    if (influences.size() < count) {
+        throw std::invalid_argument(std::string(name) + " has fewer influences than vertices");
+    }
+    if (outCount < count) {
+        throw std::invalid_argument(std::string(name) + " output span is smaller than the input");
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        for (const std::uint32_t bone : influences[i].bones) {
+            if (bone >= bones.size()) {
+                throw std::out_of_range(std::string(name) + " influence refers to bone " + std::to_string(bone) + " of " + std::to_string(bones.size()));
+            }
+        }
+    }
+}
+
+/// @brief Blends the columns of the influencing bones and applies them to each vertex.
+/// @tparam W The w component of the input: 1 for points, 0 for directions.
+template<int W>
+void SkinKernel(const Mat4* bones, const BoneInfluence* influences, const Vec3* src, Vec3* dst, const std::size_t begin, const std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i) {
+        const BoneInfluence& influence = influences[i];
+
+        Float4 c0(0.0f), c1(0.0f), c2(0.0f), c3(0.0f);
+        for (int k = 0; k < 4; ++k) {
+            const float weight = influence.weights[k];
+            if (weight == 0.0f) continue;
+
+            const Float4 w(weight);
+            const detail::Mat4Storage& m = bones[influence.bones[k]].internal_mat;
+            c0 = c0 + w * Float4::Load(&m[0][0]);
+            c1 = c1 + w * Float4::Load(&m[1][0]);
+            c2 = c2 + w * Float4::Load(&m[2][0]);
+            if constexpr (W == 1) {
+                c3 = c3 + w * Float4::Load(&m[3][0]);
+            }
+        }
+
+        const Vec3 v = src[i];
+        float result[4];
+        (c0 * Float4(v.x) + c1 * Float4(v.y) + c2 * Float4(v.z) + c3).Store(result);
+        dst[i] = Vec3(result[0], result[1], result[2]);
+    }
+}
+
+template<int W>
+void Skin(Span<const Mat4> bones, Span<const BoneInfluence> influences, Span<const Vec3> vertices, Span<Vec3> out, const BatchExecution execution, const char* name)
+{
+    Validate(bones, influences, vertices.size(), out.size(), name);
+
+    const Mat4* b = bones.data();
+    const BoneInfluence* inf = influences.data();
+    const Vec3* src = vertices.data();
+    Vec3* dst = out.data();
+    auto kernel = [b, inf, src, dst](const std::size_t begin, const std::size_t end) {
+        SkinKernel<W>(b, inf, src, dst, begin, end);
+    };
+
+    if (execution == BatchExecution::Parallel) {
+        detail::WorkerPool::Shared().ParallelFor(vertices.size(), GRAIN, kernel);
+    }
+    else if (!vertices.empty()) {
+        kernel(std::size_t(0), vertices.size());
+    }
+}
+
+} // namespace
+
+// Public Methods
+
+void SkinPointsMany(Span<const Mat4> bones, Span<const BoneInfluence> influences, Span<const Vec3> positions, Span<Vec3> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("SkinPointsMany", positions.size());
+
+    Skin<1>(bones, influences, positions, out, execution, "SkinPointsMany");
+}
+
+void SkinDirectionsMany(Span<const Mat4> bones, Span<const BoneInfluence> influences, Span<const Vec3> directions, Span<Vec3> out, const BatchExecution execution)
+{
+    VELECS_MATH_ZONE_N("SkinDirectionsMany", directions.size());
+
+    Skin<0>(bones, influences, directions, out, execution, "SkinDirectionsMany");
+}
+
+} // namespace velecs::math
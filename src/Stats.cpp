@@ -0,0 +1,129 @@
+/// @file    Stats.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 03:05:26
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Stats.hpp"
+
+#if defined(VELECS_MATH_STATS)
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+namespace velecs::math {
+
+namespace {
+
+std::atomic<detail::CallCounter*> g_counters{ nullptr };
+
+/// @brief Writes the report when static objects are destroyed at exit.
+struct ExitReport {
+public:
+    ~ExitReport()
+    {
+        if (GetCallStats().empty()) return;
+
+        if (const char* path = std::getenv("VELECS_MATH_STATS_REPORT"); path != nullptr && *path != '\0') {
+            std::ofstream file(path, std::ios::trunc);
+            if (file) {
+                WriteCallStatsReport(file);
+                return;
+            }
+        }
+        WriteCallStatsReport(std::cerr);
+    }
+};
+
+const ExitReport g_exitReport;
+
+} // namespace
+
+// Public Methods
+
+std::vector<CallStats> GetCallStats()
+{
+    std::vector<CallStats> stats;
+    for (const detail::CallCounter* counter = g_counters.load(std::memory_order_acquire); counter != nullptr; counter = counter->next) {
+        const std::uint64_t calls = counter->calls.load(std::memory_order_relaxed);
+        if (calls == 0) continue;
+        stats.push_back(CallStats{ counter->name, calls, counter->repeats.load(std::memory_order_relaxed) });
+    }
+
+    // Overloads share a name but have their own counters; report them as one function.
+    std::sort(stats.begin(), stats.end(), [](const CallStats& a, const CallStats& b) {
+        return std::string_view(a.name) < std::string_view(b.name);
+    });
+    std::vector<CallStats> merged;
+    for (const CallStats& s : stats) {
+        if (!merged.empty() && std::string_view(merged.back().name) == s.name) {
+            merged.back().calls += s.calls;
+            merged.back().repeats += s.repeats;
+        }
+        else {
+            merged.push_back(s);
+        }
+    }
+
+    std::stable_sort(merged.begin(), merged.end(), [](const CallStats& a, const CallStats& b) {
+        return a.repeats != b.repeats ? a.repeats > b.repeats : a.calls > b.calls;
+    });
+    return merged;
+}
+
+void WriteCallStatsReport(std::ostream& out)
+{
+    const std::vector<CallStats> stats = GetCallStats();
+
+    const std::ios::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+
+    out << "velecs-math call statistics (ranked by repeated inputs)\n";
+    out << std::left << std::setw(36) << "function" << std::right
+        << std::setw(14) << "calls" << std::setw(14) << "repeats" << std::setw(10) << "repeat%" << '\n';
+    for (const CallStats& s : stats) {
+        out << std::left << std::setw(36) << s.name << std::right
+            << std::setw(14) << s.calls << std::setw(14) << s.repeats
+            << std::setw(9) << std::fixed << std::setprecision(1) << s.RepeatRatio() * 100.0 << "%\n";
+    }
+    out.flush();
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+void ResetCallStats()
+{
+    for (detail::CallCounter* counter = g_counters.load(std::memory_order_acquire); counter != nullptr; counter = counter->next) {
+        counter->calls.store(0, std::memory_order_relaxed);
+        counter->repeats.store(0, std::memory_order_relaxed);
+        for (std::atomic<std::uint64_t>& slot : counter->cache) {
+            slot.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+namespace detail {
+
+// CallCounter
+
+CallCounter::CallCounter(const char* name)
+    : name(name)
+{
+    next = g_counters.load(std::memory_order_relaxed);
+    while (!g_counters.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {}
+}
+
+} // namespace detail
+
+} // namespace velecs::math
+
+#endif
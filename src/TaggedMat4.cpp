@@ -0,0 +1,225 @@
+/// @file    TaggedMat4.cpp
+/// @author  Matthew Green
+/// @date    2026-10-17 19:41:30
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/TaggedMat4.hpp"
+#include "velecs/math/Quat.hpp"
+#include "velecs/math/Profile.hpp"
+#include "velecs/math/Stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace velecs::math {
+
+// Public Fields
+
+const TaggedMat4 TaggedMat4::IDENTITY = TaggedMat4(Mat4(1.0f), TaggedMat4::Kind::Identity);
+
+// Constructors and Destructors
+
+TaggedMat4::TaggedMat4(const Mat4& mat)
+    : mat(mat), kind(Classify(mat)) {}
+
+// Public Methods
+
+TaggedMat4::Kind TaggedMat4::Classify(const Mat4& mat, const float epsilon/* = 1e-5f*/)
+{
+    const detail::Mat4Storage& m = mat.internal_mat;
+
+    if (m[0][3] != 0.0f || m[1][3] != 0.0f || m[2][3] != 0.0f || m[3][3] != 1.0f) {
+        return Kind::Projective;
+    }
+
+    bool basisIsIdentity = true;
+    for (int col = 0; col < 3; ++col) {
+        for (int row = 0; row < 3; ++row) {
+            if (m[col][row] != ((col == row) ? 1.0f : 0.0f)) {
+                basisIsIdentity = false;
+            }
+        }
+    }
+    if (basisIsIdentity) {
+        const bool hasTranslation = m[3][0] != 0.0f || m[3][1] != 0.0f || m[3][2] != 0.0f;
+        return hasTranslation ? Kind::Translation : Kind::Identity;
+    }
+
+    // Rigid when the basis is orthonormal and right-handed
+    const Vec3 x(m[0][0], m[0][1], m[0][2]);
+    const Vec3 y(m[1][0], m[1][1], m[1][2]);
+    const Vec3 z(m[2][0], m[2][1], m[2][2]);
+    const bool orthonormal =
+        std::abs(Vec3::Dot(x, x) - 1.0f) <= epsilon &&
+        std::abs(Vec3::Dot(y, y) - 1.0f) <= epsilon &&
+        std::abs(Vec3::Dot(z, z) - 1.0f) <= epsilon &&
+        std::abs(Vec3::Dot(x, y)) <= epsilon &&
+        std::abs(Vec3::Dot(x, z)) <= epsilon &&
+        std::abs(Vec3::Dot(y, z)) <= epsilon &&
+        Vec3::Dot(x, Vec3::Cross(y, z)) > 0.0f;
+
+    return orthonormal ? Kind::Rigid : Kind::Affine;
+}
+
+TaggedMat4 TaggedMat4::FromPosition(const Vec3& position)
+{
+    return TaggedMat4(Mat4::FromPosition(position), Kind::Translation);
+}
+
+TaggedMat4 TaggedMat4::FromScale(const Vec3& scale)
+{
+    return TaggedMat4(Mat4::FromScale(scale), Kind::Affine);
+}
+
+TaggedMat4 TaggedMat4::FromRotationRad(const Vec3& rotationRad)
+{
+    return TaggedMat4(Mat4::FromRotationRad(rotationRad), Kind::Rigid);
+}
+
+TaggedMat4 TaggedMat4::FromRotationDeg(const Vec3& rotationDeg)
+{
+    return TaggedMat4(Mat4::FromRotationDeg(rotationDeg), Kind::Rigid);
+}
+
+TaggedMat4 TaggedMat4::FromRotation(const Quat& rotation)
+{
+    return TaggedMat4(rotation.ToMatrix(), Kind::Rigid);
+}
+
+TaggedMat4 TaggedMat4::FromPerspectiveRad(float verticalFovRad, float aspectRatio, float nearPlane, float farPlane)
+{
+    return TaggedMat4(Mat4::FromPerspectiveRad(verticalFovRad, aspectRatio, nearPlane, farPlane), Kind::Projective);
+}
+
+TaggedMat4 TaggedMat4::FromOrthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane)
+{
+    return TaggedMat4(Mat4::FromOrthographic(left, right, bottom, top, nearPlane, farPlane), Kind::Affine);
+}
+
+TaggedMat4 TaggedMat4::FromOrthographic(float width, float height, float nearPlane, float farPlane)
+{
+    return TaggedMat4(Mat4::FromOrthographic(width, height, nearPlane, farPlane), Kind::Affine);
+}
+
+TaggedMat4& TaggedMat4::operator*=(const TaggedMat4& other)
+{
+    *this = *this * other;
+    return *this; // Return ref to allow chaining assignment operations
+}
+
+TaggedMat4 TaggedMat4::WithInverse() const
+{
+    VELECS_MATH_ZONE("TaggedMat4::WithInverse");
+    VELECS_MATH_STAT("TaggedMat4::WithInverse", mat, kind);
+
+    switch (kind) {
+        case Kind::Identity:
+            return *this;
+        case Kind::Translation: {
+            detail::Mat4Storage result(1.0f);
+            result[3][0] = -mat.internal_mat[3][0];
+            result[3][1] = -mat.internal_mat[3][1];
+            result[3][2] = -mat.internal_mat[3][2];
+            return TaggedMat4(Mat4(result), Kind::Translation);
+        }
+        case Kind::Rigid:
+            return TaggedMat4(mat.WithRigidInverse(), Kind::Rigid);
+        case Kind::Affine:
+            return TaggedMat4(mat.WithAffineInverse(), Kind::Affine);
+        case Kind::Projective:
+        default:
+            return TaggedMat4(mat.WithInverse(), Kind::Projective);
+    }
+}
+
+Vec3 TaggedMat4::TransformPoint(const Vec3& point) const
+{
+    const detail::Mat4Storage& m = mat.internal_mat;
+    switch (kind) {
+        case Kind::Identity:
+            return point;
+        case Kind::Translation:
+            return Vec3(point.x + m[3][0], point.y + m[3][1], point.z + m[3][2]);
+        case Kind::Rigid:
+        case Kind::Affine:
+            return Vec3(
+                m[0][0] * point.x + m[1][0] * point.y + m[2][0] * point.z + m[3][0],
+                m[0][1] * point.x + m[1][1] * point.y + m[2][1] * point.z + m[3][1],
+                m[0][2] * point.x + m[1][2] * point.y + m[2][2] * point.z + m[3][2]
+            );
+        case Kind::Projective:
+        default:
+            return (mat * Vec4(point, 1.0f)).ToVec3();
+    }
+}
+
+Vec3 TaggedMat4::TransformDirection(const Vec3& direction) const
+{
+    if (kind == Kind::Identity || kind == Kind::Translation) {
+        return direction;
+    }
+
+    const detail::Mat4Storage& m = mat.internal_mat;
+    return Vec3(
+        m[0][0] * direction.x + m[1][0] * direction.y + m[2][0] * direction.z,
+        m[0][1] * direction.x + m[1][1] * direction.y + m[2][1] * direction.z,
+        m[0][2] * direction.x + m[1][2] * direction.y + m[2][2] * direction.z
+    );
+}
+
+TaggedMat4 operator*(const TaggedMat4& lhs, const TaggedMat4& rhs)
+{
+    using Kind = TaggedMat4::Kind;
+
+    if (lhs.kind == Kind::Identity) return rhs;
+    if (rhs.kind == Kind::Identity) return lhs;
+
+    const Kind kind = std::max(lhs.kind, rhs.kind);
+
+    if (kind == Kind::Translation) {
+        detail::Mat4Storage result = lhs.mat.internal_mat;
+        result[3][0] += rhs.mat.internal_mat[3][0];
+        result[3][1] += rhs.mat.internal_mat[3][1];
+        result[3][2] += rhs.mat.internal_mat[3][2];
+        return TaggedMat4(Mat4(result), Kind::Translation);
+    }
+
+    if (kind != Kind::Projective) {
+        return TaggedMat4(Mat4::MultiplyAffine(lhs.mat, rhs.mat), kind);
+    }
+
+    return TaggedMat4(lhs.mat * rhs.mat, Kind::Projective);
+}
+
+Vec4 operator*(const TaggedMat4& lhs, const Vec4& rhs)
+{
+    using Kind = TaggedMat4::Kind;
+
+    if (lhs.kind == Kind::Projective) {
+        return lhs.mat * rhs;
+    }
+
+    const Vec3 xyz = lhs.TransformDirection(Vec3(rhs.x, rhs.y, rhs.z));
+    const detail::Mat4Storage& m = lhs.mat.internal_mat;
+    return Vec4(
+        xyz.x + m[3][0] * rhs.w,
+        xyz.y + m[3][1] * rhs.w,
+        xyz.z + m[3][2] * rhs.w,
+        rhs.w
+    );
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::math
@@ -0,0 +1,223 @@
+/// @file    TransformBuilder.cpp
+/// @author  Matthew Green
+/// @date    2026-10-17 19:02:58
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/TransformBuilder.hpp"
+#include "velecs/math/Profile.hpp"
+
+#include <cmath>
+
+namespace velecs::math {
+
+// Public Fields
+
+// Constructors and Destructors
+
+TransformBuilder::TransformBuilder()
+    : _base(1.0f), _hasBase(false), _folded(), _steps(), _stepCount(0)
+{
+    Reset();
+}
+
+TransformBuilder::TransformBuilder(const Mat4& base)
+    : _base(base), _hasBase(true), _folded(), _steps(), _stepCount(0)
+{
+    Reset();
+}
+
+// Public Methods
+
+TransformBuilder& TransformBuilder::Translate(const Vec3& displacement)
+{
+    Record(StepKind::Translate, displacement.x, displacement.y, displacement.z, 0.0f);
+    return *this;
+}
+
+TransformBuilder& TransformBuilder::Scale(const Vec3& scale)
+{
+    Record(StepKind::Scale, scale.x, scale.y, scale.z, 0.0f);
+    return *this;
+}
+
+TransformBuilder& TransformBuilder::Rotate(const Quat& rotation)
+{
+    const detail::QuatStorage& q = rotation.internal_quat;
+    Record(StepKind::Rotate, q.x, q.y, q.z, q.w);
+    return *this;
+}
+
+TransformBuilder& TransformBuilder::RotateRad(const float angleRad, const Vec3& axis)
+{
+    const Vec3 n = axis.Normalize();
+    const float s = std::sin(angleRad * 0.5f);
+    Record(StepKind::Rotate, n.x * s, n.y * s, n.z * s, std::cos(angleRad * 0.5f));
+    return *this;
+}
+
+Mat4 TransformBuilder::Build() const
+{
+    VELECS_MATH_ZONE("TransformBuilder::Build");
+
+    Affine affine = _folded;
+    Fold(affine, _steps.data(), _stepCount);
+
+    const float (&l)[3][3] = affine.linear;
+    const float (&t)[3] = affine.translation;
+
+    if (!_hasBase) {
+        detail::Mat4Storage result(1.0f);
+        for (int col = 0; col < 3; ++col) {
+            result[col][0] = l[col][0];
+            result[col][1] = l[col][1];
+            result[col][2] = l[col][2];
+        }
+        result[3][0] = t[0];
+        result[3][1] = t[1];
+        result[3][2] = t[2];
+        return Mat4(result);
+    }
+
+    // base * affine: the basis columns mix through the 3x3, the translation column through base
+    const detail::Mat4Storage& b = _base.internal_mat;
+    detail::Mat4Storage result = b;
+    for (int row = 0; row < 4; ++row) {
+        const float b0 = b[0][row];
+        const float b1 = b[1][row];
+        const float b2 = b[2][row];
+        for (int col = 0; col < 3; ++col) {
+            result[col][row] = b0 * l[col][0] + b1 * l[col][1] + b2 * l[col][2];
+        }
+        result[3][row] = b0 * t[0] + b1 * t[1] + b2 * t[2] + b[3][row];
+    }
+    return Mat4(result);
+}
+
+void TransformBuilder::Reset()
+{
+    for (int col = 0; col < 3; ++col) {
+        for (int row = 0; row < 3; ++row) {
+            _folded.linear[col][row] = (col == row) ? 1.0f : 0.0f;
+        }
+        _folded.translation[col] = 0.0f;
+    }
+    _folded.linearIsIdentity = true;
+    _stepCount = 0;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void TransformBuilder::Record(const StepKind kind, const float x, const float y, const float z, const float w)
+{
+    if (_stepCount > 0 && _steps[_stepCount - 1].kind == kind) {
+        float (&prev)[4] = _steps[_stepCount - 1].data;
+        switch (kind) {
+            case StepKind::Translate:
+                // Consecutive translations pass through the same linear part, so they add
+                prev[0] += x;
+                prev[1] += y;
+                prev[2] += z;
+                return;
+            case StepKind::Scale:
+                prev[0] *= x;
+                prev[1] *= y;
+                prev[2] *= z;
+                return;
+            case StepKind::Rotate: {
+                // Quaternion product prev * (x, y, z, w)
+                const float px = prev[0], py = prev[1], pz = prev[2], pw = prev[3];
+                prev[0] = pw * x + px * w + py * z - pz * y;
+                prev[1] = pw * y + py * w + pz * x - px * z;
+                prev[2] = pw * z + pz * w + px * y - py * x;
+                prev[3] = pw * w - px * x - py * y - pz * z;
+                return;
+            }
+        }
+    }
+
+    if (_stepCount == MAX_PENDING_STEPS) {
+        Fold(_folded, _steps.data(), _stepCount);
+        _stepCount = 0;
+    }
+
+    _steps[_stepCount++] = Step{ kind, { x, y, z, w } };
+}
+
+void TransformBuilder::Fold(Affine& affine, const Step* steps, const std::size_t count)
+{
+    float (&l)[3][3] = affine.linear;
+    float (&t)[3] = affine.translation;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const float (&d)[4] = steps[i].data;
+        switch (steps[i].kind) {
+            case StepKind::Translate:
+                if (affine.linearIsIdentity) {
+                    t[0] += d[0];
+                    t[1] += d[1];
+                    t[2] += d[2];
+                }
+                else {
+                    for (int row = 0; row < 3; ++row) {
+                        t[row] += l[0][row] * d[0] + l[1][row] * d[1] + l[2][row] * d[2];
+                    }
+                }
+                break;
+
+            case StepKind::Scale:
+                for (int col = 0; col < 3; ++col) {
+                    l[col][0] *= d[col];
+                    l[col][1] *= d[col];
+                    l[col][2] *= d[col];
+                }
+                affine.linearIsIdentity = false;
+                break;
+
+            case StepKind::Rotate: {
+                const float x = d[0], y = d[1], z = d[2], w = d[3];
+                const float xx = x * x, yy = y * y, zz = z * z;
+                const float xy = x * y, xz = x * z, yz = y * z;
+                const float wx = w * x, wy = w * y, wz = w * z;
+                const float r[3][3] = {
+                    { 1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz),        2.0f * (xz - wy)        },
+                    { 2.0f * (xy - wz),        1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)        },
+                    { 2.0f * (xz + wy),        2.0f * (yz - wx),        1.0f - 2.0f * (xx + yy) },
+                };
+
+                if (affine.linearIsIdentity) {
+                    // T-R-S chains land here: the rotation becomes the linear part as-is
+                    for (int col = 0; col < 3; ++col) {
+                        l[col][0] = r[col][0];
+                        l[col][1] = r[col][1];
+                        l[col][2] = r[col][2];
+                    }
+                    affine.linearIsIdentity = false;
+                    break;
+                }
+
+                for (int row = 0; row < 3; ++row) {
+                    const float l0 = l[0][row];
+                    const float l1 = l[1][row];
+                    const float l2 = l[2][row];
+                    l[0][row] = l0 * r[0][0] + l1 * r[0][1] + l2 * r[0][2];
+                    l[1][row] = l0 * r[1][0] + l1 * r[1][1] + l2 * r[1][2];
+                    l[2][row] = l0 * r[2][0] + l1 * r[2][1] + l2 * r[2][2];
+                }
+                break;
+            }
+        }
+    }
+}
+
+} // namespace velecs::math
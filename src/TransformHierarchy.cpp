@@ -0,0 +1,169 @@
+/// @file    TransformHierarchy.cpp
+/// @author  Matthew Green
+/// @date    2026-10-17 23:40:44
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/TransformHierarchy.hpp"
+#include "velecs/math/Vec3xN.hpp"
+#include "velecs/math/QuatxN.hpp"
+#include "velecs/math/Mat4xN.hpp"
+#include "velecs/math/Profile.hpp"
+
+#include "detail/WorkerPool.hpp"
+
+#include <stdexcept>
+
+namespace velecs::math {
+
+namespace {
+
+#if defined(VELECS_MATH_AVX)
+using Lane = Float8;
+#else
+using Lane = Float4;
+#endif
+
+constexpr int WIDTH = Lane::WIDTH;
+
+/// @brief Nodes per work item. A multiple of every lane width, and large enough that a
+///        chunk (~64 KiB of world matrices) outweighs the cost of handing it to a thread.
+constexpr std::size_t GRAIN = 1024;
+
+constexpr std::uint32_t UNVISITED = 0xFFFFFFFFu;
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+TransformHierarchy::TransformHierarchy(Span<const std::uint32_t> parents)
+{
+    const std::size_t count = parents.size();
+    if (count >= NO_PARENT) {
+        throw std::invalid_argument("TransformHierarchy has too many nodes for 32-bit indices");
+    }
+
+    // Depth of each node, resolved by walking up to the nearest node with a known depth.
+    std::vector<std::uint32_t> depth(count, UNVISITED);
+    std::vector<std::uint32_t> path;
+    std::uint32_t maxDepth = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t node = static_cast<std::uint32_t>(i);
+        path.clear();
+        while (depth[node] == UNVISITED) {
+            const std::uint32_t parent = parents[node];
+            if (parent == NO_PARENT) {
+                depth[node] = 0;
+                break;
+            }
+            if (parent >= count) {
+                throw std::invalid_argument("TransformHierarchy parent index is out of range");
+            }
+            if (path.size() >= count) {
+                throw std::invalid_argument("TransformHierarchy parents contain a cycle");
+            }
+            path.push_back(node);
+            node = parent;
+        }
+
+        std::uint32_t d = depth[node];
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            depth[*it] = ++d;
+        }
+        if (d > maxDepth) maxDepth = d;
+    }
+
+    // Counting sort by depth keeps each level in ascending index order.
+    _levelStarts.assign(count == 0 ? 1 : maxDepth + 2, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        ++_levelStarts[depth[i] + 1];
+    }
+    for (std::size_t level = 1; level < _levelStarts.size(); ++level) {
+        _levelStarts[level] += _levelStarts[level - 1];
+    }
+
+    _order.resize(count);
+    _orderParents.resize(count);
+    std::vector<std::size_t> cursor(_levelStarts.begin(), _levelStarts.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t slot = cursor[depth[i]]++;
+        _order[slot] = static_cast<std::uint32_t>(i);
+        _orderParents[slot] = parents[i];
+    }
+}
+
+// Public Methods
+
+Span<const std::uint32_t> TransformHierarchy::Level(const std::size_t depth) const
+{
+    if (depth >= LevelCount()) {
+        throw std::out_of_range("TransformHierarchy level is out of range");
+    }
+    const std::size_t begin = _levelStarts[depth];
+    return Span<const std::uint32_t>(_order.data() + begin, _levelStarts[depth + 1] - begin);
+}
+
+void TransformHierarchy::UpdateWorld(Span<const Vec3> positions, Span<const Quat> rotations, Span<const Vec3> scales, Span<Mat4> world) const
+{
+    VELECS_MATH_ZONE_N("TransformHierarchy::UpdateWorld", _order.size());
+
+    const std::size_t count = Size();
+    if (positions.size() < count || rotations.size() < count || scales.size() < count || world.size() < count) {
+        throw std::invalid_argument("TransformHierarchy::UpdateWorld spans are smaller than the hierarchy");
+    }
+
+    const Vec3* p = positions.data();
+    const Quat* r = rotations.data();
+    const Vec3* s = scales.data();
+    Mat4* w = world.data();
+
+    detail::WorkerPool& pool = detail::WorkerPool::Shared();
+    for (std::size_t level = 0; level < LevelCount(); ++level) {
+        const std::uint32_t* nodes = _order.data() + _levelStarts[level];
+        const std::uint32_t* nodeParents = _orderParents.data() + _levelStarts[level];
+        const bool isRoot = level == 0;
+
+        pool.ParallelFor(_levelStarts[level + 1] - _levelStarts[level], GRAIN,
+            [=](const std::size_t begin, const std::size_t end) {
+                std::uint32_t index[WIDTH];
+                std::uint32_t parent[WIDTH];
+                for (std::size_t i = begin; i < end; i += WIDTH) {
+                    // Pad a partial packet by repeating its last node; the duplicate lanes
+                    // compute and scatter the same matrix.
+                    const std::size_t valid = end - i < std::size_t(WIDTH) ? end - i : std::size_t(WIDTH);
+                    for (int lane = 0; lane < WIDTH; ++lane) {
+                        const std::size_t k = i + (std::size_t(lane) < valid ? lane : valid - 1);
+                        index[lane] = nodes[k];
+                        parent[lane] = nodeParents[k];
+                    }
+
+                    Mat4xN<Lane> result = Mat4xN<Lane>::FromTRS(
+                        Vec3xN<Lane>::Gather(p, index),
+                        QuatxN<Lane>::Gather(r, index),
+                        Vec3xN<Lane>::Gather(s, index)
+                    );
+                    if (!isRoot) {
+                        result = Mat4xN<Lane>::Gather(w, parent) * result;
+                    }
+                    result.Scatter(w, index);
+                }
+            }
+        );
+    }
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::math
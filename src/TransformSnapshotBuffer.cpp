@@ -0,0 +1,206 @@
+/// @file    TransformSnapshotBuffer.cpp
+/// @author  Matthew Green
+/// @date    2026-10-17 23:07:15
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/TransformSnapshotBuffer.hpp"
+#include "velecs/math/Vec3xN.hpp"
+#include "velecs/math/QuatxN.hpp"
+#include "velecs/math/Mat4xN.hpp"
+#include "velecs/math/Profile.hpp"
+
+#include "detail/MatrixKernels.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace velecs::math {
+
+// TransformSnapshot
+
+TransformSnapshot::TransformSnapshot(const std::size_t count, const bool withMatrices)
+    : positions(count, Vec3::ZERO),
+      rotations(count, Quat::IDENTITY),
+      scales(count, Vec3::ONE),
+      matrices(withMatrices ? count : 0, Mat4::IDENTITY),
+      _history() {}
+
+DirtyRange TransformSnapshot::ChangedSince(const std::uint64_t since) const
+{
+    if (since >= tick) return DirtyRange();
+    if (tick - since > HISTORY) return DirtyRange{0, Size()};
+
+    DirtyRange changed;
+    for (std::uint64_t t = since + 1; t <= tick; ++t) {
+        const TickRange& entry = _history[t % HISTORY];
+        if (entry.tick != t) return DirtyRange{0, Size()};
+        changed.Merge(entry.range);
+    }
+    return changed;
+}
+
+// TransformSnapshotBuffer
+
+// Constructors and Destructors
+
+TransformSnapshotBuffer::TransformSnapshotBuffer(const std::size_t count, const bool withMatrices)
+    : _slots{{
+        TransformSnapshot(count, withMatrices),
+        TransformSnapshot(count, withMatrices),
+        TransformSnapshot(count, withMatrices),
+        TransformSnapshot(count, withMatrices),
+      }},
+      _back(0), _latest(2), _writing(false), _pending(), _history(),
+      _shared(1), _current(2), _previous(3) {}
+
+// Public Methods
+
+TransformSnapshot& TransformSnapshotBuffer::BeginWrite()
+{
+    TransformSnapshot& back = _slots[_back];
+    if (!_writing) {
+        // The back slot holds whatever tick it was last written at; replay the ranges that
+        // changed since then from the latest published snapshot.
+        const TransformSnapshot& latest = _slots[_latest];
+        CopyRange(latest, back, latest.ChangedSince(back.tick));
+        back.tick = latest.tick;
+        back.time = latest.time;
+        _pending = DirtyRange();
+        _writing = true;
+    }
+    return back;
+}
+
+void TransformSnapshotBuffer::MarkDirty(const std::size_t first, const std::size_t count)
+{
+    const std::size_t size = _slots[_back].Size();
+    if (first > size || count > size - first) {
+        throw std::out_of_range("TransformSnapshotBuffer::MarkDirty range is past the end of the snapshot");
+    }
+    _pending.Merge(DirtyRange{first, first + count});
+}
+
+void TransformSnapshotBuffer::Publish(const double time)
+{
+    if (!_writing) {
+        throw std::logic_error("TransformSnapshotBuffer::Publish called without BeginWrite");
+    }
+
+    TransformSnapshot& back = _slots[_back];
+    back.tick = _slots[_latest].tick + 1;
+    back.time = time;
+
+    TransformSnapshot::TickRange& entry = _history[back.tick % TransformSnapshot::HISTORY];
+    entry.tick = back.tick;
+    entry.range = _pending;
+    back._history = _history;
+
+    // Release makes the snapshot visible to the reader; acquire makes the reader's last use
+    // of the slot we get back happen before we start overwriting it.
+    _latest = _back;
+    _back = _shared.exchange(static_cast<std::uint8_t>(_back | FRESH_BIT), std::memory_order_acq_rel) & INDEX_MASK;
+    _writing = false;
+}
+
+bool TransformSnapshotBuffer::AcquireLatest()
+{
+    // Only the writer sets FRESH_BIT, so once seen it stays set until the exchange below.
+    if ((_shared.load(std::memory_order_relaxed) & FRESH_BIT) == 0) return false;
+
+    const std::uint8_t fresh = _shared.exchange(_previous, std::memory_order_acq_rel) & INDEX_MASK;
+    _previous = _current;
+    _current = fresh;
+    return true;
+}
+
+float TransformSnapshotBuffer::InterpolationAlpha(const double renderTime) const
+{
+    const double from = Previous().time;
+    const double to = Current().time;
+    if (to <= from) return 1.0f;
+
+    const double alpha = (renderTime - from) / (to - from);
+    return static_cast<float>(std::clamp(alpha, 0.0, 1.0));
+}
+
+void TransformSnapshotBuffer::InterpolateSnapshots(const TransformSnapshot& from, const TransformSnapshot& to, const float alpha, Span<Mat4> out)
+{
+    VELECS_MATH_ZONE_N("TransformSnapshotBuffer::InterpolateSnapshots", out.size());
+
+    const std::size_t count = to.Size();
+    if (from.Size() != count) {
+        throw std::invalid_argument("TransformSnapshotBuffer::InterpolateSnapshots snapshots differ in size");
+    }
+    if (out.size() < count) {
+        throw std::invalid_argument("TransformSnapshotBuffer::InterpolateSnapshots output span is smaller than the snapshots");
+    }
+
+    const Vec3* p0 = from.positions.data();
+    const Vec3* p1 = to.positions.data();
+    const Quat* r0 = from.rotations.data();
+    const Quat* r1 = to.rotations.data();
+    const Vec3* s0 = from.scales.data();
+    const Vec3* s1 = to.scales.data();
+    Mat4* dst = out.data();
+
+    detail::ForEachLanes(count,
+        [=](const std::size_t i) {
+            const Float4 t(alpha);
+            const Vec3x4 position = Vec3x4::Lerp(Vec3x4::Load(p0 + i), Vec3x4::Load(p1 + i), t);
+            const Vec3x4 scale = Vec3x4::Lerp(Vec3x4::Load(s0 + i), Vec3x4::Load(s1 + i), t);
+            const Quat rotations[Float4::WIDTH] = {
+                Quat::Slerp(r0[i + 0], r1[i + 0], alpha),
+                Quat::Slerp(r0[i + 1], r1[i + 1], alpha),
+                Quat::Slerp(r0[i + 2], r1[i + 2], alpha),
+                Quat::Slerp(r0[i + 3], r1[i + 3], alpha),
+            };
+            Mat4x4::FromTRS(position, Quatx4::Load(rotations), scale).Store(dst + i);
+        },
+        [=](const std::size_t i) {
+            const Vec3 position = Vec3::Lerp(p0[i], p1[i], alpha);
+            const Vec3 scale = Vec3::Lerp(s0[i], s1[i], alpha);
+            const detail::QuatStorage& q = Quat::Slerp(r0[i], r1[i], alpha).internal_quat;
+
+            detail::Lanes4x4<float> m;
+            detail::QuatToMatrix(q.x, q.y, q.z, q.w, m);
+            for (int row = 0; row < 3; ++row) {
+                m[0][row] *= scale.x;
+                m[1][row] *= scale.y;
+                m[2][row] *= scale.z;
+            }
+            m[3][0] = position.x;
+            m[3][1] = position.y;
+            m[3][2] = position.z;
+            detail::StoreLanes(m, dst[i]);
+        }
+    );
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void TransformSnapshotBuffer::CopyRange(const TransformSnapshot& src, TransformSnapshot& dst, const DirtyRange& range)
+{
+    if (range.IsEmpty()) return;
+
+    const auto first = static_cast<std::ptrdiff_t>(range.begin);
+    const auto last = static_cast<std::ptrdiff_t>(range.end);
+    std::copy(src.positions.begin() + first, src.positions.begin() + last, dst.positions.begin() + first);
+    std::copy(src.rotations.begin() + first, src.rotations.begin() + last, dst.rotations.begin() + first);
+    std::copy(src.scales.begin() + first, src.scales.begin() + last, dst.scales.begin() + first);
+    if (!src.matrices.empty()) {
+        std::copy(src.matrices.begin() + first, src.matrices.begin() + last, dst.matrices.begin() + first);
+    }
+}
+
+} // namespace velecs::math
@@ -0,0 +1,150 @@
+/// @file    UniformGrid2D.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 08:51:03
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/UniformGrid2D.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace velecs::math {
+
+UniformGrid2D::UniformGrid2D(Span<const Rect> items, const float cellSize)
+    : _items(items.begin(), items.end())
+{
+    if (!(cellSize > 0.0f) || std::isinf(cellSize)) {
+        throw std::invalid_argument("UniformGrid2D cell size must be positive and finite");
+    }
+    if (items.size() >= INVALID) {
+        throw std::invalid_argument("UniformGrid2D supports fewer than 2^32 - 1 items");
+    }
+
+    Rect bounds = Rect::EMPTY;
+    for (const Rect& item : items) {
+        if (!item.IsEmpty()) bounds = Rect::Merge(bounds, item);
+    }
+    if (bounds.IsEmpty()) return;
+
+    const double columns = std::floor(static_cast<double>(bounds.max.x - bounds.min.x) / cellSize) + 1.0;
+    const double rows = std::floor(static_cast<double>(bounds.max.y - bounds.min.y) / cellSize) + 1.0;
+    if (!(columns * rows <= static_cast<double>(MAX_CELLS))) {
+        throw std::invalid_argument("UniformGrid2D would need more than MAX_CELLS cells");
+    }
+    _originX = bounds.min.x;
+    _originY = bounds.min.y;
+    _inverseCellSize = 1.0f / cellSize;
+    _columns = static_cast<std::uint32_t>(columns);
+    _rows = static_cast<std::uint32_t>(rows);
+
+    // Counting sort: count the ids per cell, turn the counts into offsets, then place the ids.
+    _cellStarts.assign(std::size_t(_columns) * _rows + 1, 0u);
+    for (const Rect& item : items) {
+        if (item.IsEmpty()) continue;
+        for (std::uint32_t row = Row(item.min.y); row <= Row(item.max.y); ++row) {
+            for (std::uint32_t column = Column(item.min.x); column <= Column(item.max.x); ++column) {
+                ++_cellStarts[std::size_t(row) * _columns + column + 1];
+            }
+        }
+    }
+    for (std::size_t cell = 1; cell < _cellStarts.size(); ++cell) {
+        _cellStarts[cell] += _cellStarts[cell - 1];
+    }
+
+    _cellItems.resize(_cellStarts.back());
+    std::vector<std::uint32_t> cursor(_cellStarts.begin(), _cellStarts.end() - 1);
+    for (std::size_t id = 0; id < items.size(); ++id) {
+        const Rect& item = items[id];
+        if (item.IsEmpty()) continue;
+        for (std::uint32_t row = Row(item.min.y); row <= Row(item.max.y); ++row) {
+            for (std::uint32_t column = Column(item.min.x); column <= Column(item.max.x); ++column) {
+                _cellItems[cursor[std::size_t(row) * _columns + column]++] = static_cast<std::uint32_t>(id);
+            }
+        }
+    }
+}
+
+void UniformGrid2D::QueryPoint(const Vec2 point, std::vector<std::uint32_t>& out) const
+{
+    out.clear();
+    ForEachCell(Rect(point, point), [&](const std::uint32_t id, std::uint32_t, std::uint32_t) {
+        if (_items[id].Contains(point)) out.push_back(id);
+    });
+}
+
+void UniformGrid2D::QueryRect(const Rect& rect, std::vector<std::uint32_t>& out) const
+{
+    out.clear();
+    const std::uint32_t firstColumn = Column(rect.min.x);
+    const std::uint32_t firstRow = Row(rect.min.y);
+    ForEachCell(rect, [&](const std::uint32_t id, const std::uint32_t column, const std::uint32_t row) {
+        const Rect& item = _items[id];
+        // Report the item only from the first cell that both it and the query cover.
+        if (column != std::max(Column(item.min.x), firstColumn) || row != std::max(Row(item.min.y), firstRow)) return;
+        if (item.Intersects(rect)) out.push_back(id);
+    });
+}
+
+void UniformGrid2D::QueryRadius(const Vec2 center, const float radius, std::vector<std::uint32_t>& out) const
+{
+    out.clear();
+    const Rect bounds = Rect::FromCenterExtents(center, Vec2(radius, radius));
+    const std::uint32_t firstColumn = Column(bounds.min.x);
+    const std::uint32_t firstRow = Row(bounds.min.y);
+    ForEachCell(bounds, [&](const std::uint32_t id, const std::uint32_t column, const std::uint32_t row) {
+        const Rect& item = _items[id];
+        if (column != std::max(Column(item.min.x), firstColumn) || row != std::max(Row(item.min.y), firstRow)) return;
+        if (item.IntersectsCircle(center, radius)) out.push_back(id);
+    });
+}
+
+std::uint32_t UniformGrid2D::HitTest(const Vec2 point) const
+{
+    // Ids are ascending within a cell, so the last hit is the topmost.
+    std::uint32_t top = INVALID;
+    ForEachCell(Rect(point, point), [&](const std::uint32_t id, std::uint32_t, std::uint32_t) {
+        if (_items[id].Contains(point)) top = id;
+    });
+    return top;
+}
+
+std::uint32_t UniformGrid2D::Column(const float x) const
+{
+    const float cell = (x - _originX) * _inverseCellSize;
+    if (!(cell > 0.0f)) return 0;
+    if (cell >= static_cast<float>(_columns)) return _columns - 1;
+    return static_cast<std::uint32_t>(cell);
+}
+
+std::uint32_t UniformGrid2D::Row(const float y) const
+{
+    const float cell = (y - _originY) * _inverseCellSize;
+    if (!(cell > 0.0f)) return 0;
+    if (cell >= static_cast<float>(_rows)) return _rows - 1;
+    return static_cast<std::uint32_t>(cell);
+}
+
+template<typename Visit>
+void UniformGrid2D::ForEachCell(const Rect& rect, Visit&& visit) const
+{
+    if (_columns == 0 || rect.IsEmpty()) return;
+
+    const std::uint32_t lastColumn = Column(rect.max.x);
+    const std::uint32_t lastRow = Row(rect.max.y);
+    for (std::uint32_t row = Row(rect.min.y); row <= lastRow; ++row) {
+        for (std::uint32_t column = Column(rect.min.x); column <= lastColumn; ++column) {
+            const std::size_t cell = std::size_t(row) * _columns + column;
+            for (std::uint32_t i = _cellStarts[cell]; i < _cellStarts[cell + 1]; ++i) {
+                visit(_cellItems[i], column, row);
+            }
+        }
+    }
+}
+
+} // namespace velecs::math
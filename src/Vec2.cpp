@@ -10,6 +10,7 @@
 
 #include "velecs/math/Vec2.hpp"
 #include "velecs/math/Vec3.hpp"
+#include "velecs/math/Stats.hpp"
 
 #include <sstream>
 #include <algorithm>
@@ -37,6 +38,7 @@ const Vec2 Vec2::J            {  0.0f,  1.0f };
 
 Vec2 Vec2::Normalize() const
 {
+    VELECS_MATH_STAT("Vec2::Normalize", *this);
     float magnitude = L2Norm();
     return (magnitude != 0) ? (*this)/magnitude : Vec2::ZERO;
 }
@@ -10,6 +10,8 @@
 
 #include "velecs/math/Vec3.hpp"
 #include "velecs/math/Vec2.hpp"
+#include "velecs/math/Vec4.hpp"
+#include "velecs/math/Stats.hpp"
 
 #include <sstream>
 #include <algorithm>
@@ -44,8 +46,19 @@ Vec3::Vec3(const float x, const struct Vec2 vec2)
 
 // Public Methods
 
+Vec4 Vec3::ToHomogeneousPoint() const
+{
+    return Vec4(x, y, z, 1.0f);
+}
+
+Vec4 Vec3::ToHomogeneousVector() const
+{
+    return Vec4(x, y, z, 0.0f);
+}
+
 Vec3 Vec3::Normalize() const
 {
+    VELECS_MATH_STAT("Vec3::Normalize", *this);
     float magnitude = L2Norm();
     return (magnitude != 0) ? (*this)/magnitude : Vec3::ZERO;
 }
@@ -60,6 +73,16 @@ Vec3 Vec3::Clamp(const Vec3 vec, const Vec3 min, const Vec3 max)
     );
 }
 
+Vec3 Vec3::Min(const Vec3 a, const Vec3 b)
+{
+    return Vec3(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z));
+}
+
+Vec3 Vec3::Max(const Vec3 a, const Vec3 b)
+{
+    return Vec3(std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z));
+}
+
 float Vec3::Angle(const Vec3 a, const Vec3 b)
 {
     float dotProduct = Dot(a, b);
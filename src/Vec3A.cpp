@@ -0,0 +1,66 @@
+/// @file    Vec3A.cpp
+/// @author  Matthew Green
+/// @date    2026-10-17 21:37:12
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/math/Vec3A.hpp"
+
+#include <sstream>
+#include <algorithm>
+
+namespace velecs::math {
+
+// Public Fields
+
+const Vec3A Vec3A::ZERO         {  0.0f,  0.0f,  0.0f };
+const Vec3A Vec3A::ONE          {  1.0f,  1.0f,  1.0f };
+const Vec3A Vec3A::NEG_ONE      { -1.0f, -1.0f, -1.0f };
+const Vec3A Vec3A::RIGHT        {  1.0f,  0.0f,  0.0f };
+const Vec3A Vec3A::LEFT         { -1.0f,  0.0f,  0.0f };
+const Vec3A Vec3A::UP           {  0.0f,  1.0f,  0.0f };
+const Vec3A Vec3A::DOWN         {  0.0f, -1.0f,  0.0f };
+const Vec3A Vec3A::FORWARD      {  0.0f,  0.0f, -1.0f };
+const Vec3A Vec3A::BACKWARD     {  0.0f,  0.0f,  1.0f };
+const Vec3A Vec3A::POS_INFINITY { FLOAT_POS_INFINITY, FLOAT_POS_INFINITY, FLOAT_POS_INFINITY };
+const Vec3A Vec3A::NEG_INFINITY { FLOAT_NEG_INFINITY, FLOAT_NEG_INFINITY, FLOAT_NEG_INFINITY };
+const Vec3A Vec3A::UNIT         = ONE.Normalize();
+const Vec3A Vec3A::I            {  1.0f,  0.0f,  0.0f };
+const Vec3A Vec3A::J            {  0.0f,  1.0f,  0.0f };
+const Vec3A Vec3A::K            {  0.0f,  0.0f,  1.0f };
+
+// Constructors and Destructors
+
+// Public Methods
+
+float Vec3A::Angle(const Vec3A a, const Vec3A b)
+{
+    float dotProduct = Dot(a, b);
+    float magnitudes = a.L2Norm() * b.L2Norm();
+    if (magnitudes == 0) return 0;  // avoid division by zero
+    float cosineTheta = dotProduct / magnitudes;
+    // Clamp cosineTheta to the range [-1, 1] to avoid NaN due to floating point errors.
+    cosineTheta = std::max(-1.0f, std::min(1.0f, cosineTheta));
+    return std::acos(cosineTheta);  // result is in radians
+}
+
+std::string Vec3A::ToString() const
+{
+    std::ostringstream oss;
+    oss << '(' << x << ", " << y << ", " << z << ')';
+    return oss.str();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::math
@@ -11,7 +11,9 @@
 #include "velecs/math/Vec4.hpp"
 #include "velecs/math/Vec3.hpp"
 #include "velecs/math/Vec2.hpp"
+#include "velecs/math/Stats.hpp"
 
+#include <cassert>
 #include <sstream>
 #include <algorithm>
 
@@ -78,11 +80,6 @@ Vec3 Vec4::ToVec3() const
     return Vec3(x * invW, y * invW, z * invW);
 }
 
-Vec3 Vec4::XYZ() const
-{
-    return Vec3(x, y, z);
-}
-
 Vec4 Vec4::ToPoint() const
 {
     if (std::abs(w) < 1e-6f) {
@@ -98,6 +95,7 @@ Vec4 Vec4::ToPoint() const
 
 Vec4 Vec4::Normalize() const
 {
+    VELECS_MATH_STAT("Vec4::Normalize", *this);
     float magnitude = L2Norm();
     return (magnitude != 0) ? (*this)/magnitude : Vec4::ZERO;
 }
@@ -0,0 +1,706 @@
+/// @file    Accuracy.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 04:21:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Error bounds of the scalar operations and their SIMD or approximate variants, measured
+/// against double-precision references.
+///
+/// Every operation runs over several input classes: well-conditioned random data and
+/// adversarial data (tiny, denormal and huge vectors, near-parallel vectors, near-singular
+/// and badly scaled matrices, gimbal-lock and very large Euler angles, extreme projection
+/// ranges). For each path and class the harness reports:
+///
+///     ULP        The distance of each output component from the reference rounded to
+///                float, in units of the float spacing at the reference. Components whose
+///                reference is much smaller than the rest of the output (cancellation) show
+///                large ULP values even when the result as a whole is accurate.
+///     rel        The normwise relative error max|out - ref| / max|ref| of each output.
+///     non-fin    Outputs that are NaN or infinite while the reference is finite.
+///
+/// The time per element is measured on the random class, with the speedup of each variant
+/// over the scalar path of the same operation.
+///
+/// Usage: velecs-math-accuracy [--count=100000] [--filter=substring]
+
+#include "Bench.hpp"
+
+#include "velecs/math/Batch.hpp"
+#include "velecs/math/Point3.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace velecs::math;
+using namespace velecs::math::bench;
+
+namespace {
+
+using DVec3 = std::array<double, 3>;
+using DQuat = std::array<double, 4>; // x, y, z, w
+using DMat4 = std::array<std::array<double, 4>, 4>; // [col][row]
+
+constexpr double PI = 3.14159265358979323846;
+
+/// @class ErrorStats
+/// @brief Accumulates the error of float outputs against double references.
+class ErrorStats {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+    /// @brief Adds one output of n components.
+    void Add(const float* out, const double* ref, const int n)
+    {
+        double refNorm = 0.0;
+        bool refFinite = true;
+        bool outFinite = true;
+        for (int i = 0; i < n; ++i) {
+            refNorm = std::max(refNorm, std::fabs(ref[i]));
+            refFinite = refFinite && std::isfinite(ref[i]);
+            outFinite = outFinite && std::isfinite(out[i]);
+        }
+        if (!refFinite) return; // The operation is undefined here; nothing to hold it to.
+        ++_outputs;
+        if (!outFinite) {
+            ++_nonFinite;
+            return;
+        }
+
+        double diffNorm = 0.0;
+        for (int i = 0; i < n; ++i) {
+            const double diff = std::fabs(static_cast<double>(out[i]) - ref[i]);
+            const double ulps = diff / Spacing(ref[i]);
+            _maxUlp = std::max(_maxUlp, ulps);
+            _sumUlp += ulps;
+            ++_components;
+            diffNorm = std::max(diffNorm, diff);
+        }
+        const double rel = refNorm > 0.0 ? diffNorm / refNorm : diffNorm;
+        _maxRel = std::max(_maxRel, rel);
+        _sumRel += rel;
+        ++_finite;
+    }
+
+    void Print() const
+    {
+        if (_finite == 0) {
+            std::printf("%10s %10s %10s %10s", "-", "-", "-", "-");
+        }
+        else {
+            std::printf("%10.3g %10.3g %10.3g %10.3g", _maxUlp, _sumUlp / static_cast<double>(_components),
+                _maxRel, _sumRel / static_cast<double>(_finite));
+        }
+        std::printf(" %7zu/%-7zu", _nonFinite, _outputs);
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    double _maxUlp = 0.0;
+    double _sumUlp = 0.0;
+    double _maxRel = 0.0;
+    double _sumRel = 0.0;
+    std::size_t _components = 0;
+    std::size_t _finite = 0;
+    std::size_t _outputs = 0;
+    std::size_t _nonFinite = 0;
+
+    // Private Methods
+
+    /// @brief The spacing of floats around a value; the denormal spacing near zero.
+    static double Spacing(const double value)
+    {
+        const float f = std::fabs(static_cast<float>(value));
+        if (!std::isfinite(f)) return static_cast<double>(std::numeric_limits<float>::max()) * 0x1p-23;
+        if (f < std::numeric_limits<float>::min()) return static_cast<double>(std::numeric_limits<float>::denorm_min());
+        return static_cast<double>(std::nextafter(f, std::numeric_limits<float>::infinity()) - f);
+    }
+};
+
+/// @brief Times fn() over count elements, repeated until at least 20 ms have passed.
+double NanosecondsPerElement(const std::size_t count, const std::function<void()>& fn)
+{
+    fn();
+    std::size_t reps = 0;
+    const Clock::time_point start = Clock::now();
+    do {
+        fn();
+        ++reps;
+    } while (NanosecondsSince(start) < 20e6);
+    return NanosecondsSince(start) / static_cast<double>(reps * count);
+}
+
+/// @class Report
+/// @brief Prints one row per (operation, path, input class).
+class Report {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    explicit Report(std::string filter) : _filter(std::move(filter)) {}
+
+    // Public Methods
+
+    bool Wants(const std::string& op) const { return _filter.empty() || op.find(_filter) != std::string::npos; }
+
+    void PrintHeader() const
+    {
+        std::printf("%-26s %-22s %-16s %10s %10s %10s %10s %15s %9s %8s\n",
+            "operation", "path", "inputs", "max ULP", "mean ULP", "max rel", "mean rel", "non-fin/total", "ns/elem", "speedup");
+    }
+
+    /// @brief Prints a row.
+    /// @param ns The time per element, or a negative value if not timed for this class.
+    /// @param baselineNs The time of the scalar path, or a negative value for the scalar path itself.
+    void Row(const std::string& op, const std::string& path, const std::string& inputs, const ErrorStats& stats, const double ns, const double baselineNs) const
+    {
+        std::printf("%-26s %-22s %-16s ", op.c_str(), path.c_str(), inputs.c_str());
+        stats.Print();
+        if (ns < 0.0) std::printf(" %9s %8s\n", "", "");
+        else if (baselineNs < 0.0) std::printf(" %9.2f %8s\n", ns, "1.00x");
+        else std::printf(" %9.2f %7.2fx\n", ns, baselineNs / ns);
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::string _filter;
+
+    // Private Methods
+};
+
+// Double-precision references
+
+DVec3 ToDouble(const Vec3 v) { return { v.x, v.y, v.z }; }
+
+DMat4 ToDouble(const Mat4& m)
+{
+    DMat4 result;
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            result[c][r] = m.internal_mat[c][r];
+        }
+    }
+    return result;
+}
+
+void Flatten(const Mat4& m, float (&out)[16])
+{
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            out[c * 4 + r] = m.internal_mat[c][r];
+        }
+    }
+}
+
+void Flatten(const DMat4& m, double (&out)[16])
+{
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            out[c * 4 + r] = m[c][r];
+        }
+    }
+}
+
+DVec3 RefNormalize(const DVec3& v)
+{
+    const double length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (length == 0.0) return { 0.0, 0.0, 0.0 };
+    return { v[0] / length, v[1] / length, v[2] / length };
+}
+
+double RefAngle(const DVec3& a, const DVec3& b)
+{
+    const DVec3 cross = { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+    const double sinPart = std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+    const double cosPart = a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    return std::atan2(sinPart, cosPart);
+}
+
+/// @brief The quaternion for XYZ Euler angles, in the library's (GLM's) convention.
+DQuat RefFromEuler(const DVec3& e)
+{
+    const double cx = std::cos(e[0] * 0.5), cy = std::cos(e[1] * 0.5), cz = std::cos(e[2] * 0.5);
+    const double sx = std::sin(e[0] * 0.5), sy = std::sin(e[1] * 0.5), sz = std::sin(e[2] * 0.5);
+    return {
+        sx * cy * cz - cx * sy * sz,
+        cx * sy * cz + sx * cy * sz,
+        cx * cy * sz - sx * sy * cz,
+        cx * cy * cz + sx * sy * sz,
+    };
+}
+
+DMat4 RefQuatToMatrix(const DQuat& q)
+{
+    const double x = q[0], y = q[1], z = q[2], w = q[3];
+    DMat4 m{};
+    m[0] = { 1 - 2 * (y * y + z * z), 2 * (x * y + w * z), 2 * (x * z - w * y), 0 };
+    m[1] = { 2 * (x * y - w * z), 1 - 2 * (x * x + z * z), 2 * (y * z + w * x), 0 };
+    m[2] = { 2 * (x * z + w * y), 2 * (y * z - w * x), 1 - 2 * (x * x + y * y), 0 };
+    m[3] = { 0, 0, 0, 1 };
+    return m;
+}
+
+DQuat RefSlerp(const DQuat& a, DQuat b, const double t)
+{
+    double d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    if (d < 0.0) {
+        d = -d;
+        for (double& c : b) c = -c;
+    }
+    const double theta = std::acos(std::min(1.0, d));
+    const double s = std::sin(theta);
+    const double ka = s < 1e-12 ? 1.0 - t : std::sin((1.0 - t) * theta) / s;
+    const double kb = s < 1e-12 ? t : std::sin(t * theta) / s;
+    return { ka * a[0] + kb * b[0], ka * a[1] + kb * b[1], ka * a[2] + kb * b[2], ka * a[3] + kb * b[3] };
+}
+
+/// @brief Gauss-Jordan inverse with partial pivoting; NaN if singular in double.
+DMat4 RefInverse(const DMat4& m)
+{
+    double a[4][8];
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            a[r][c] = m[c][r];
+            a[r][c + 4] = r == c ? 1.0 : 0.0;
+        }
+    }
+    for (int col = 0; col < 4; ++col) {
+        int pivot = col;
+        for (int r = col + 1; r < 4; ++r) {
+            if (std::fabs(a[r][col]) > std::fabs(a[pivot][col])) pivot = r;
+        }
+        if (a[pivot][col] == 0.0) {
+            DMat4 nan;
+            for (auto& column : nan) column.fill(std::numeric_limits<double>::quiet_NaN());
+            return nan;
+        }
+        std::swap(a[col], a[pivot]);
+        const double inv = 1.0 / a[col][col];
+        for (double& v : a[col]) v *= inv;
+        for (int r = 0; r < 4; ++r) {
+            if (r == col) continue;
+            const double f = a[r][col];
+            for (int c = 0; c < 8; ++c) a[r][c] -= f * a[col][c];
+        }
+    }
+    DMat4 result;
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            result[c][r] = a[r][c + 4];
+        }
+    }
+    return result;
+}
+
+DMat4 RefPerspective(const double fov, const double aspect, const double nearPlane, const double farPlane)
+{
+    const double focal = 1.0 / std::tan(fov * 0.5);
+    const double a = farPlane / (farPlane - nearPlane);
+    DMat4 m{};
+    m[0][0] = focal / aspect;
+    m[1][1] = -focal;
+    m[2][2] = -a;
+    m[2][3] = -1.0;
+    m[3][2] = -nearPlane * a;
+    return m;
+}
+
+DMat4 RefOrthographic(const double l, const double r, const double b, const double t, const double n, const double f)
+{
+    DMat4 m{};
+    m[0][0] = 2.0 / (r - l);
+    m[1][1] = -2.0 / (t - b);
+    m[2][2] = -1.0 / (f - n);
+    m[3][0] = -(r + l) / (r - l);
+    m[3][1] = -(t + b) / (t - b);
+    m[3][2] = -n / (f - n);
+    m[3][3] = 1.0;
+    return m;
+}
+
+// Input classes
+
+using Vec3Class = std::pair<const char*, std::function<Vec3(Random&)>>;
+using MatClass = std::pair<const char*, std::function<Mat4(Random&)>>;
+
+std::vector<Vec3Class> VectorClasses()
+{
+    return {
+        { "random", [](Random& r) { return r.NextVec3(10.0f); } },
+        { "tiny 1e-20", [](Random& r) { return r.NextVec3(1.0f) * 1e-20f; } },
+        { "denormal", [](Random& r) { return r.NextVec3(1.0f) * 1e-39f; } },
+        { "huge 1e20", [](Random& r) { return r.NextVec3(1.0f) * 1e20f; } },
+        { "axis + 1e-7", [](Random& r) { return Vec3(1.0f, r.Float(-1e-7f, 1e-7f), r.Float(-1e-7f, 1e-7f)); } },
+    };
+}
+
+std::vector<MatClass> MatrixClasses()
+{
+    return {
+        { "random affine", [](Random& r) { return r.NextAffine(); } },
+        { "near-singular", [](Random& r) { return r.NextAffine() * Mat4::FromScale(Vec3(1.0f, 1.0f, r.Float(1e-6f, 1e-5f))); } },
+        { "scale 1e3:1e-3", [](Random& r) { return r.NextQuat().ToMatrix() * Mat4::FromScale(Vec3(1e3f, 1.0f, 1e-3f)); } },
+        { "translate 1e5", [](Random& r) { return Mat4::FromPosition(r.NextVec3(1e5f)) * r.NextQuat().ToMatrix(); } },
+    };
+}
+
+void CheckNormalize(const Report& report, const std::size_t count)
+{
+    if (!report.Wants("Vec3::Normalize")) return;
+    for (const auto& [name, make] : VectorClasses()) {
+        Random random;
+        std::vector<Vec3> in, scalar(count, Vec3::ZERO), batch(count, Vec3::ZERO);
+        for (std::size_t i = 0; i < count; ++i) in.push_back(make(random));
+
+        for (std::size_t i = 0; i < count; ++i) scalar[i] = in[i].Normalize();
+        NormalizeMany(in, batch);
+
+        ErrorStats scalarStats, batchStats;
+        for (std::size_t i = 0; i < count; ++i) {
+            const DVec3 ref = RefNormalize(ToDouble(in[i]));
+            scalarStats.Add(&scalar[i].x, ref.data(), 3);
+            batchStats.Add(&batch[i].x, ref.data(), 3);
+        }
+
+        const bool timed = std::string(name) == "random";
+        const double scalarNs = timed ? NanosecondsPerElement(count, [&] {
+            for (std::size_t i = 0; i < count; ++i) scalar[i] = in[i].Normalize();
+            DoNotOptimize(scalar.data());
+        }) : -1.0;
+        const double batchNs = timed ? NanosecondsPerElement(count, [&] {
+            NormalizeMany(in, batch);
+            DoNotOptimize(batch.data());
+        }) : -1.0;
+        report.Row("Vec3::Normalize", "scalar", name, scalarStats, scalarNs, -1.0);
+        report.Row("Vec3::Normalize", "NormalizeMany (SIMD)", name, batchStats, batchNs, scalarNs);
+    }
+}
+
+void CheckAngle(const Report& report, const std::size_t count)
+{
+    if (!report.Wants("Vec3::Angle")) return;
+    const std::pair<const char*, std::function<std::pair<Vec3, Vec3>(Random&)>> classes[] = {
+        { "random", [](Random& r) { return std::make_pair(r.NextVec3(), r.NextVec3()); } },
+        { "near-parallel", [](Random& r) { const Vec3 a = r.NextVec3(); return std::make_pair(a, a + r.NextVec3(1e-4f)); } },
+        { "near-opposite", [](Random& r) { const Vec3 a = r.NextVec3(); return std::make_pair(a, -a + r.NextVec3(1e-4f)); } },
+        { "tiny 1e-20", [](Random& r) { return std::make_pair(r.NextVec3() * 1e-20f, r.NextVec3() * 1e-20f); } },
+    };
+    for (const auto& [name, make] : classes) {
+        Random random;
+        std::vector<std::pair<Vec3, Vec3>> in;
+        std::vector<float> out(count);
+        for (std::size_t i = 0; i < count; ++i) in.push_back(make(random));
+        for (std::size_t i = 0; i < count; ++i) out[i] = Vec3::Angle(in[i].first, in[i].second);
+
+        ErrorStats stats;
+        for (std::size_t i = 0; i < count; ++i) {
+            const double ref = RefAngle(ToDouble(in[i].first), ToDouble(in[i].second));
+            stats.Add(&out[i], &ref, 1);
+        }
+        const double ns = std::string(name) == "random" ? NanosecondsPerElement(count, [&] {
+            for (std::size_t i = 0; i < count; ++i) out[i] = Vec3::Angle(in[i].first, in[i].second);
+            DoNotOptimize(out.data());
+        }) : -1.0;
+        report.Row("Vec3::Angle", "scalar", name, stats, ns, -1.0);
+    }
+}
+
+void CheckEuler(const Report& report, const std::size_t count)
+{
+    if (!report.Wants("Quat::FromEulerAnglesRad")) return;
+    const std::pair<const char*, std::function<Vec3(Random&)>> classes[] = {
+        { "random", [](Random& r) { return r.NextVec3(3.14159f); } },
+        { "gimbal lock", [](Random& r) { return Vec3(r.Float(-3.0f, 3.0f), (r.Float() < 0.5f ? -1.0f : 1.0f) * (1.5707964f + r.Float(-1e-4f, 1e-4f)), r.Float(-3.0f, 3.0f)); } },
+        { "large 1e4 rad", [](Random& r) { return r.NextVec3(1e4f); } },
+        { "tiny 1e-30", [](Random& r) { return r.NextVec3(1e-30f); } },
+    };
+    for (const auto& [name, make] : classes) {
+        Random random;
+        std::vector<Vec3> in;
+        std::vector<Quat> out(count, Quat::IDENTITY);
+        for (std::size_t i = 0; i < count; ++i) in.push_back(make(random));
+        for (std::size_t i = 0; i < count; ++i) out[i] = Quat::FromEulerAnglesRad(in[i]);
+
+        ErrorStats stats;
+        for (std::size_t i = 0; i < count; ++i) {
+            const DQuat ref = RefFromEuler(ToDouble(in[i]));
+            const detail::QuatStorage& q = out[i].internal_quat;
+            const float got[4] = { q.x, q.y, q.z, q.w };
+            stats.Add(got, ref.data(), 4);
+        }
+        const double ns = std::string(name) == "random" ? NanosecondsPerElement(count, [&] {
+            for (std::size_t i = 0; i < count; ++i) out[i] = Quat::FromEulerAnglesRad(in[i]);
+            DoNotOptimize(out.data());
+        }) : -1.0;
+        report.Row("Quat::FromEulerAnglesRad", "scalar", name, stats, ns, -1.0);
+    }
+}
+
+void CheckQuatToMatrix(const Report& report, const std::size_t count)
+{
+    if (!report.Wants("Quat::ToMatrix")) return;
+    Random random;
+    std::vector<Quat> in;
+    std::vector<Mat4> scalar(count, Mat4::IDENTITY), batch(count, Mat4::IDENTITY);
+    for (std::size_t i = 0; i < count; ++i) in.push_back(random.NextQuat());
+    for (std::size_t i = 0; i < count; ++i) scalar[i] = in[i].ToMatrix();
+    Quat::ToMatrixMany(in, batch);
+
+    ErrorStats scalarStats, batchStats;
+    for (std::size_t i = 0; i < count; ++i) {
+        const detail::QuatStorage& q = in[i].internal_quat;
+        double ref[16];
+        Flatten(RefQuatToMatrix({ q.x, q.y, q.z, q.w }), ref);
+        float got[16];
+        Flatten(scalar[i], got);
+        scalarStats.Add(got, ref, 16);
+        Flatten(batch[i], got);
+        batchStats.Add(got, ref, 16);
+    }
+    const double scalarNs = NanosecondsPerElement(count, [&] {
+        for (std::size_t i = 0; i < count; ++i) scalar[i] = in[i].ToMatrix();
+        DoNotOptimize(scalar.data());
+    });
+    const double batchNs = NanosecondsPerElement(count, [&] {
+        Quat::ToMatrixMany(in, batch);
+        DoNotOptimize(batch.data());
+    });
+    report.Row("Quat::ToMatrix", "scalar", "random unit", scalarStats, scalarNs, -1.0);
+    report.Row("Quat::ToMatrix", "ToMatrixMany (SIMD)", "random unit", batchStats, batchNs, scalarNs);
+}
+
+void CheckSlerp(const Report& report, const std::size_t count)
+{
+    if (!report.Wants("Quat::Slerp")) return;
+    const std::pair<const char*, float> classes[] = {
+        { "random", 1.0f },
+        { "close (1e-3)", 1e-3f },
+    };
+    for (const auto& [name, spread] : classes) {
+        Random random;
+        std::vector<Quat> a, b, scalar(count, Quat::IDENTITY), nlerp(count, Quat::IDENTITY);
+        std::vector<float> t;
+        for (std::size_t i = 0; i < count; ++i) {
+            a.push_back(random.NextQuat());
+            const Vec3 delta = random.NextVec3(3.14159f * spread);
+            b.push_back(Quat::FromRotationMatrix(a[i].ToMatrix() * Quat::FromEulerAnglesRad(delta).ToMatrix()));
+            t.push_back(random.Float());
+        }
+        for (std::size_t i = 0; i < count; ++i) scalar[i] = Quat::Slerp(a[i], b[i], t[i]);
+        for (std::size_t i = 0; i < count; ++i) LerpMany(Span<const Quat>(&a[i], 1), Span<const Quat>(&b[i], 1), t[i], Span<Quat>(&nlerp[i], 1));
+
+        ErrorStats scalarStats, nlerpStats;
+        for (std::size_t i = 0; i < count; ++i) {
+            const detail::QuatStorage& qa = a[i].internal_quat;
+            const detail::QuatStorage& qb = b[i].internal_quat;
+            const DQuat ref = RefSlerp({ qa.x, qa.y, qa.z, qa.w }, { qb.x, qb.y, qb.z, qb.w }, t[i]);
+            const detail::QuatStorage& s = scalar[i].internal_quat;
+            const float gotScalar[4] = { s.x, s.y, s.z, s.w };
+            scalarStats.Add(gotScalar, ref.data(), 4);
+            const detail::QuatStorage& n = nlerp[i].internal_quat;
+            const float gotNlerp[4] = { n.x, n.y, n.z, n.w };
+            nlerpStats.Add(gotNlerp, ref.data(), 4);
+        }
+
+        // The batch timing uses one t for the whole span, as LerpMany does.
+        const bool timed = std::string(name) == "random";
+        const double scalarNs = timed ? NanosecondsPerElement(count, [&] {
+            for (std::size_t i = 0; i < count; ++i) scalar[i] = Quat::Slerp(a[i], b[i], 0.3f);
+            DoNotOptimize(scalar.data());
+        }) : -1.0;
+        const double nlerpNs = timed ? NanosecondsPerElement(count, [&] {
+            LerpMany(a, b, 0.3f, nlerp);
+            DoNotOptimize(nlerp.data());
+        }) : -1.0;
+        report.Row("Quat::Slerp", "scalar", name, scalarStats, scalarNs, -1.0);
+        report.Row("Quat::Slerp", "LerpMany (nlerp)", name, nlerpStats, nlerpNs, scalarNs);
+    }
+}
+
+void CheckInverse(const Report& report, const std::size_t count)
+{
+    if (!report.Wants("Mat4::WithInverse")) return;
+    for (const auto& [name, make] : MatrixClasses()) {
+        Random random;
+        std::vector<Mat4> in, general(count, Mat4::IDENTITY), generalMany(count, Mat4::IDENTITY), affine(count, Mat4::IDENTITY), affineMany(count, Mat4::IDENTITY);
+        for (std::size_t i = 0; i < count; ++i) in.push_back(make(random));
+
+        for (std::size_t i = 0; i < count; ++i) general[i] = in[i].WithInverse();
+        for (std::size_t i = 0; i < count; ++i) affine[i] = in[i].WithAffineInverse();
+        Mat4::InverseMany(in, generalMany);
+        Mat4::AffineInverseMany(in, affineMany);
+
+        ErrorStats stats[4];
+        for (std::size_t i = 0; i < count; ++i) {
+            double ref[16];
+            Flatten(RefInverse(ToDouble(in[i])), ref);
+            const Mat4* outputs[4] = { &general[i], &generalMany[i], &affine[i], &affineMany[i] };
+            for (int k = 0; k < 4; ++k) {
+                float got[16];
+                Flatten(*outputs[k], got);
+                stats[k].Add(got, ref, 16);
+            }
+        }
+
+        double ns[4] = { -1.0, -1.0, -1.0, -1.0 };
+        if (std::string(name) == "random affine") {
+            ns[0] = NanosecondsPerElement(count, [&] {
+                for (std::size_t i = 0; i < count; ++i) general[i] = in[i].WithInverse();
+                DoNotOptimize(general.data());
+            });
+            ns[1] = NanosecondsPerElement(count, [&] {
+                Mat4::InverseMany(in, generalMany);
+                DoNotOptimize(generalMany.data());
+            });
+            ns[2] = NanosecondsPerElement(count, [&] {
+                for (std::size_t i = 0; i < count; ++i) affine[i] = in[i].WithAffineInverse();
+                DoNotOptimize(affine.data());
+            });
+            ns[3] = NanosecondsPerElement(count, [&] {
+                Mat4::AffineInverseMany(in, affineMany);
+                DoNotOptimize(affineMany.data());
+            });
+        }
+        report.Row("Mat4::WithInverse", "scalar", name, stats[0], ns[0], -1.0);
+        report.Row("Mat4::WithInverse", "InverseMany (SIMD)", name, stats[1], ns[1], ns[0]);
+        report.Row("Mat4::WithInverse", "WithAffineInverse", name, stats[2], ns[2], ns[0]);
+        report.Row("Mat4::WithInverse", "AffineInverseMany", name, stats[3], ns[3], ns[0]);
+    }
+}
+
+void CheckTransformPoints(const Report& report, const std::size_t count)
+{
+    if (!report.Wants("Mat4 * Point3")) return;
+    for (const auto& [name, make] : MatrixClasses()) {
+        Random random;
+        const Mat4 mat = make(random);
+        std::vector<Vec3> in, scalar(count, Vec3::ZERO), batch(count, Vec3::ZERO);
+        for (std::size_t i = 0; i < count; ++i) in.push_back(random.NextVec3(100.0f));
+        for (std::size_t i = 0; i < count; ++i) scalar[i] = (mat * Point3(in[i])).ToVec3();
+        TransformPointsMany(mat, in, batch);
+
+        const DMat4 m = ToDouble(mat);
+        ErrorStats scalarStats, batchStats;
+        for (std::size_t i = 0; i < count; ++i) {
+            const DVec3 p = ToDouble(in[i]);
+            double ref[3];
+            for (int r = 0; r < 3; ++r) {
+                ref[r] = m[0][r] * p[0] + m[1][r] * p[1] + m[2][r] * p[2] + m[3][r];
+            }
+            scalarStats.Add(&scalar[i].x, ref, 3);
+            batchStats.Add(&batch[i].x, ref, 3);
+        }
+
+        const bool timed = std::string(name) == "random affine";
+        const double scalarNs = timed ? NanosecondsPerElement(count, [&] {
+            for (std::size_t i = 0; i < count; ++i) scalar[i] = (mat * Point3(in[i])).ToVec3();
+            DoNotOptimize(scalar.data());
+        }) : -1.0;
+        const double batchNs = timed ? NanosecondsPerElement(count, [&] {
+            TransformPointsMany(mat, in, batch);
+            DoNotOptimize(batch.data());
+        }) : -1.0;
+        report.Row("Mat4 * Point3", "scalar", name, scalarStats, scalarNs, -1.0);
+        report.Row("Mat4 * Point3", "TransformPointsMany", name, batchStats, batchNs, scalarNs);
+    }
+}
+
+void CheckProjections(const Report& report, const std::size_t count)
+{
+    if (report.Wants("Mat4::FromPerspectiveRad")) {
+        const std::pair<const char*, std::function<std::array<float, 4>(Random&)>> classes[] = {
+            { "typical", [](Random& r) { return std::array<float, 4>{ r.Float(0.5f, 2.0f), r.Float(0.5f, 3.0f), r.Float(0.01f, 1.0f), r.Float(100.0f, 1e4f) }; } },
+            { "near 1e-5 far 1e7", [](Random& r) { return std::array<float, 4>{ r.Float(0.5f, 2.0f), r.Float(0.5f, 3.0f), r.Float(1e-6f, 1e-5f), r.Float(1e6f, 1e7f) }; } },
+            { "fov 0.01-179 deg", [](Random& r) { return std::array<float, 4>{ r.Float() < 0.5f ? r.Float(1.7e-4f, 1e-3f) : r.Float(3.12f, 3.1241f), 1.0f, 0.1f, 1000.0f }; } },
+            { "near ~= far", [](Random& r) { const float n = r.Float(1.0f, 10.0f); return std::array<float, 4>{ 1.0f, 1.0f, n, n * (1.0f + 1e-5f) }; } },
+        };
+        for (const auto& [name, make] : classes) {
+            Random random;
+            ErrorStats stats;
+            std::vector<std::array<float, 4>> in;
+            for (std::size_t i = 0; i < count; ++i) in.push_back(make(random));
+            for (const std::array<float, 4>& p : in) {
+                double ref[16];
+                Flatten(RefPerspective(p[0], p[1], p[2], p[3]), ref);
+                float got[16];
+                Flatten(Mat4::FromPerspectiveRad(p[0], p[1], p[2], p[3]), got);
+                stats.Add(got, ref, 16);
+            }
+            const double ns = std::string(name) == "typical" ? NanosecondsPerElement(count, [&] {
+                for (const std::array<float, 4>& p : in) DoNotOptimize(Mat4::FromPerspectiveRad(p[0], p[1], p[2], p[3]));
+            }) : -1.0;
+            report.Row("Mat4::FromPerspectiveRad", "scalar", name, stats, ns, -1.0);
+        }
+    }
+
+    if (report.Wants("Mat4::FromOrthographic")) {
+        const std::pair<const char*, float> classes[] = {
+            { "typical", 1.0f },
+            { "offset 1e6", 1e6f },
+        };
+        for (const auto& [name, offset] : classes) {
+            Random random;
+            ErrorStats stats;
+            for (std::size_t i = 0; i < count; ++i) {
+                const float l = offset + random.Float(-100.0f, -1.0f), r = offset + random.Float(1.0f, 100.0f);
+                const float b = offset + random.Float(-100.0f, -1.0f), t = offset + random.Float(1.0f, 100.0f);
+                const float n = random.Float(0.01f, 1.0f), f = random.Float(100.0f, 1e4f);
+                double ref[16];
+                Flatten(RefOrthographic(l, r, b, t, n, f), ref);
+                float got[16];
+                Flatten(Mat4::FromOrthographic(l, r, b, t, n, f), got);
+                stats.Add(got, ref, 16);
+            }
+            report.Row("Mat4::FromOrthographic", "scalar", name, stats, -1.0, -1.0);
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t count = std::max<std::size_t>(1, SizeOption(argc, argv, "count", 100000));
+    const Report report(Option(argc, argv, "filter", ""));
+
+    report.PrintHeader();
+    CheckNormalize(report, count);
+    CheckAngle(report, count);
+    CheckEuler(report, count);
+    CheckQuatToMatrix(report, count);
+    CheckSlerp(report, count);
+    CheckInverse(report, count);
+    CheckTransformPoints(report, count);
+    CheckProjections(report, count);
+    return EXIT_SUCCESS;
+}
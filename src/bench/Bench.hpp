@@ -0,0 +1,139 @@
+/// @file    Bench.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 03:31:44
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Helpers shared by the benchmark drivers: keeping results alive past the optimizer,
+/// deterministic input data, percentiles and command-line options.
+
+#pragma once
+
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+#include "velecs/math/Quat.hpp"
+#include "velecs/math/Mat4.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace velecs::math::bench {
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief Forces a value to be computed even if it is never used.
+template<typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/// @brief Nanoseconds elapsed since a point in time.
+inline double NanosecondsSince(const Clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+/// @brief The p-th percentile (0-100) of a set of samples, by nearest rank.
+inline double Percentile(std::vector<double> samples, const double p)
+{
+    if (samples.empty()) return 0.0;
+    const std::size_t rank = static_cast<std::size_t>(p / 100.0 * static_cast<double>(samples.size() - 1) + 0.5);
+    std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+    return samples[rank];
+}
+
+/// @class Random
+/// @brief A small deterministic generator, so runs are comparable across machines.
+class Random {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    inline explicit Random(const std::uint64_t seed = 0x9E3779B97F4A7C15ull) : _state(seed) {}
+
+    // Public Methods
+
+    /// @brief A uniform float in [min, max).
+    inline float Float(const float min = 0.0f, const float max = 1.0f)
+    {
+        _state ^= _state << 13;
+        _state ^= _state >> 7;
+        _state ^= _state << 17;
+        return min + (max - min) * static_cast<float>(_state >> 40) * (1.0f / 16777216.0f);
+    }
+
+    inline Vec3 NextVec3(const float range = 10.0f) { return Vec3(Float(-range, range), Float(-range, range), Float(-range, range)); }
+    inline Vec4 NextVec4(const float range = 10.0f) { return Vec4(Float(-range, range), Float(-range, range), Float(-range, range), Float(-range, range)); }
+    inline Quat NextQuat() { return Quat::FromEulerAnglesRad(Float(-3.14f, 3.14f), Float(-3.14f, 3.14f), Float(-3.14f, 3.14f)); }
+
+    /// @brief A random rotation, translation and positive scale.
+    inline Mat4 NextAffine()
+    {
+        return Mat4::FromPosition(NextVec3()) * NextQuat().ToMatrix() * Mat4::FromScale(Vec3(Float(0.5f, 2.0f), Float(0.5f, 2.0f), Float(0.5f, 2.0f)));
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::uint64_t _state;
+
+    // Private Methods
+};
+
+/// @brief Reads "--name=value" from the command line.
+/// @returns The value, or fallback if the option is absent.
+inline std::string Option(const int argc, char** argv, const std::string& name, const std::string& fallback)
+{
+    const std::string prefix = "--" + name + "=";
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.compare(0, prefix.size(), prefix) == 0) return arg.substr(prefix.size());
+    }
+    return fallback;
+}
+
+/// @brief Reads a numeric "--name=value" option.
+inline std::size_t SizeOption(const int argc, char** argv, const std::string& name, const std::size_t fallback)
+{
+    const std::string value = Option(argc, argv, name, "");
+    return value.empty() ? fallback : static_cast<std::size_t>(std::strtoull(value.c_str(), nullptr, 10));
+}
+
+/// @brief Reads a comma-separated list of sizes.
+inline std::vector<std::size_t> SizeListOption(const int argc, char** argv, const std::string& name, const std::string& fallback)
+{
+    std::vector<std::size_t> sizes;
+    const std::string list = Option(argc, argv, name, fallback);
+    std::size_t begin = 0;
+    while (begin <= list.size()) {
+        const std::size_t end = std::min(list.find(',', begin), list.size());
+        if (end > begin) sizes.push_back(static_cast<std::size_t>(std::strtoull(list.substr(begin, end - begin).c_str(), nullptr, 10)));
+        begin = end + 1;
+    }
+    return sizes;
+}
+
+} // namespace velecs::math::bench
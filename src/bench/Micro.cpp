@@ -0,0 +1,456 @@
+/// @file    Micro.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 03:36:15
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Per-operation benchmarks of the scalar and batch paths of Vec3, Vec4, Mat4 and Quat.
+///
+/// Every case streams an input array through one operation into an output array, so
+/// scalar and batch rows of the same operation move the same bytes and are directly
+/// comparable. Each row reports wall time and, where perf_event_open is allowed, hardware
+/// counters per element. A low IPC together with a bandwidth close to the machine's limit
+/// means the kernel is memory-bound; compare the rows of a small size (cache resident) with
+/// a large one to see where that happens.
+///
+/// Usage: velecs-math-bench [--filter=substring] [--sizes=4096,1048576] [--min-ms=50] [--trials=5]
+
+#include "Bench.hpp"
+#include "PerfCounters.hpp"
+
+#include "velecs/math/Batch.hpp"
+#include "velecs/math/KdTree.hpp"
+#include "velecs/math/LooseOctree.hpp"
+#include "velecs/math/Point3.hpp"
+#include "velecs/math/Quadtree.hpp"
+#include "velecs/math/UniformGrid2D.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace velecs::math;
+using namespace velecs::math::bench;
+
+namespace {
+
+/// @class Runner
+/// @brief Times a pass over the data often enough to be measurable and prints one row.
+class Runner {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    Runner(std::string filter, const double minTimeNs, const std::size_t trials)
+        : _filter(std::move(filter)), _minTimeNs(minTimeNs), _trials(trials == 0 ? 1 : trials) {}
+
+    // Public Methods
+
+    void PrintHeader() const
+    {
+        if (!_counters.Diagnostic().empty()) {
+            std::printf("note: %s\n", _counters.Diagnostic().c_str());
+        }
+        std::printf("%-34s %9s %9s %7s %8s %6s %9s %9s %9s %9s\n",
+            "operation", "elements", "ns/elem", "B/elem", "GB/s", "IPC", "cyc/elem", "L1D/elem", "LLC/elem", "brm/elem");
+    }
+
+    /// @brief Measures a pass over elements elements.
+    /// @param name The row label.
+    /// @param elements Elements processed by one call of pass.
+    /// @param bytesPerElement Bytes read plus written per element.
+    /// @param pass Processes every element once.
+    template<typename Pass>
+    void Run(const std::string& name, const std::size_t elements, const std::size_t bytesPerElement, Pass&& pass)
+    {
+        if (!_filter.empty() && name.find(_filter) == std::string::npos) return;
+
+        pass(); // Warm the caches and page in the output.
+
+        Clock::time_point start = Clock::now();
+        pass();
+        const double once = std::max(NanosecondsSince(start), 1.0);
+        const std::size_t reps = std::max<std::size_t>(1, static_cast<std::size_t>(_minTimeNs / once));
+
+        double best = 0.0;
+        PerfSample bestSample;
+        for (std::size_t trial = 0; trial < _trials; ++trial) {
+            _counters.Start();
+            start = Clock::now();
+            for (std::size_t r = 0; r < reps; ++r) {
+                pass();
+            }
+            const double ns = NanosecondsSince(start);
+            const PerfSample sample = _counters.Stop();
+            if (trial == 0 || ns < best) {
+                best = ns;
+                bestSample = sample;
+            }
+        }
+
+        const double perElement = 1.0 / (static_cast<double>(elements) * static_cast<double>(reps));
+        const double nsPerElement = best * perElement;
+        std::printf("%-34s %9zu %9.2f %7zu %8.2f ", name.c_str(), elements, nsPerElement, bytesPerElement,
+            static_cast<double>(bytesPerElement) / nsPerElement);
+        PrintIpc(bestSample.Ipc());
+        PrintPerElement(bestSample, PerfSample::CYCLES, perElement);
+        PrintPerElement(bestSample, PerfSample::L1D_MISSES, perElement);
+        PrintPerElement(bestSample, PerfSample::LLC_MISSES, perElement);
+        PrintPerElement(bestSample, PerfSample::BRANCH_MISSES, perElement);
+        std::printf("\n");
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::string _filter;
+    double _minTimeNs;
+    std::size_t _trials;
+    PerfCounters _counters;
+
+    // Private Methods
+
+    static void PrintIpc(const double ipc)
+    {
+        if (ipc < 0.0) std::printf("%6s ", "-");
+        else std::printf("%6.2f ", ipc);
+    }
+
+    static void PrintPerElement(const PerfSample& sample, const PerfSample::Counter counter, const double perElement)
+    {
+        if (!sample.valid[counter]) std::printf("%9s ", "-");
+        else std::printf("%9.3f ", sample.values[counter] * perElement);
+    }
+};
+
+void RunVec3(Runner& runner, const std::size_t n, Random& random)
+{
+    std::vector<Vec3> a, b, out(n, Vec3::ZERO);
+    std::vector<float> scalars(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a.push_back(random.NextVec3());
+        b.push_back(random.NextVec3());
+    }
+    const Mat4 mat = random.NextAffine();
+
+    runner.Run("Vec3::Dot", n, 28, [&] {
+        for (std::size_t i = 0; i < n; ++i) scalars[i] = Vec3::Dot(a[i], b[i]);
+        DoNotOptimize(scalars.data());
+    });
+    runner.Run("Vec3::Cross", n, 36, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = Vec3::Cross(a[i], b[i]);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Vec3::Normalize", n, 24, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = a[i].Normalize();
+        DoNotOptimize(out.data());
+    });
+    runner.Run("NormalizeMany(Vec3)", n, 24, [&] {
+        NormalizeMany(a, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Vec3::Lerp", n, 36, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = Vec3::Lerp(a[i], b[i], 0.25f);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("LerpMany(Vec3)", n, 36, [&] {
+        LerpMany(a, b, 0.25f, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Mat4 * Point3", n, 24, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = (mat * Point3(a[i])).ToVec3();
+        DoNotOptimize(out.data());
+    });
+    runner.Run("TransformPointsMany", n, 24, [&] {
+        TransformPointsMany(mat, a, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("TransformDirectionsMany", n, 24, [&] {
+        TransformDirectionsMany(mat, a, out);
+        DoNotOptimize(out.data());
+    });
+}
+
+void RunVec4(Runner& runner, const std::size_t n, Random& random)
+{
+    std::vector<Vec4> a, b, out(n, Vec4::ZERO);
+    for (std::size_t i = 0; i < n; ++i) {
+        a.push_back(random.NextVec4());
+        b.push_back(random.NextVec4());
+    }
+    const Mat4 mat = random.NextAffine();
+
+    runner.Run("Vec4::Normalize", n, 32, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = a[i].Normalize();
+        DoNotOptimize(out.data());
+    });
+    runner.Run("NormalizeMany(Vec4)", n, 32, [&] {
+        NormalizeMany(a, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Vec4::Lerp", n, 48, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = Vec4::Lerp(a[i], b[i], 0.25f);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("LerpMany(Vec4)", n, 48, [&] {
+        LerpMany(a, b, 0.25f, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Mat4 * Vec4", n, 32, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = mat * a[i];
+        DoNotOptimize(out.data());
+    });
+    runner.Run("TransformMany(Vec4)", n, 32, [&] {
+        TransformMany(mat, a, out);
+        DoNotOptimize(out.data());
+    });
+}
+
+void RunMat4(Runner& runner, const std::size_t n, Random& random)
+{
+    std::vector<Mat4> a, out(n, Mat4::IDENTITY);
+    std::vector<Vec3> translations(n, Vec3::ZERO), scales(n, Vec3::ZERO);
+    std::vector<Quat> rotations(n, Quat::IDENTITY);
+    for (std::size_t i = 0; i < n; ++i) {
+        a.push_back(random.NextAffine());
+    }
+    const Mat4 parent = random.NextAffine();
+
+    runner.Run("Mat4 * Mat4", n, 128, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = parent * a[i];
+        DoNotOptimize(out.data());
+    });
+    runner.Run("TransformMany(Mat4)", n, 128, [&] {
+        TransformMany(parent, a, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Mat4::WithInverse", n, 128, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = a[i].WithInverse();
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Mat4::InverseMany", n, 128, [&] {
+        Mat4::InverseMany(a, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Mat4::WithAffineInverse", n, 128, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = a[i].WithAffineInverse();
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Mat4::AffineInverseMany", n, 128, [&] {
+        Mat4::AffineInverseMany(a, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Mat4::Decompose", n, 104, [&] {
+        for (std::size_t i = 0; i < n; ++i) a[i].Decompose(translations[i], rotations[i], scales[i]);
+        DoNotOptimize(rotations.data());
+    });
+    runner.Run("Mat4::DecomposeMany", n, 104, [&] {
+        Mat4::DecomposeMany(a, translations, rotations, scales);
+        DoNotOptimize(rotations.data());
+    });
+}
+
+void RunQuat(Runner& runner, const std::size_t n, Random& random)
+{
+    std::vector<Quat> a, b, out(n, Quat::IDENTITY);
+    std::vector<Vec3> angles;
+    std::vector<Mat4> matrices(n, Mat4::IDENTITY);
+    for (std::size_t i = 0; i < n; ++i) {
+        a.push_back(random.NextQuat());
+        b.push_back(random.NextQuat());
+        angles.push_back(random.NextVec3(3.14f));
+    }
+
+    runner.Run("Quat::FromEulerAnglesRad", n, 28, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = Quat::FromEulerAnglesRad(angles[i]);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("Quat::ToEulerAnglesRad", n, 28, [&] {
+        for (std::size_t i = 0; i < n; ++i) angles[i] = a[i].ToEulerAnglesRad();
+        DoNotOptimize(angles.data());
+    });
+    runner.Run("Quat::ToMatrix", n, 80, [&] {
+        for (std::size_t i = 0; i < n; ++i) matrices[i] = a[i].ToMatrix();
+        DoNotOptimize(matrices.data());
+    });
+    runner.Run("Quat::ToMatrixMany", n, 80, [&] {
+        Quat::ToMatrixMany(a, matrices);
+        DoNotOptimize(matrices.data());
+    });
+    runner.Run("Quat::Slerp", n, 48, [&] {
+        for (std::size_t i = 0; i < n; ++i) out[i] = Quat::Slerp(a[i], b[i], 0.25f);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("LerpMany(Quat)", n, 48, [&] {
+        LerpMany(a, b, 0.25f, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("NormalizeMany(Quat)", n, 32, [&] {
+        NormalizeMany(a, out);
+        DoNotOptimize(out.data());
+    });
+}
+
+void RunKdTree(Runner& runner, const std::size_t n, Random& random)
+{
+    // Elements are queries; the tree holds n points.
+    const std::size_t queryCount = 4096;
+    const std::size_t k = 8;
+    std::vector<Vec3> points, queries;
+    for (std::size_t i = 0; i < n; ++i) points.push_back(random.NextVec3());
+    for (std::size_t i = 0; i < queryCount; ++i) queries.push_back(random.NextVec3());
+    std::vector<KdNeighbor> out(queryCount * k);
+
+    runner.Run("KdTree build", n, 16, [&] {
+        KdTree tree(points);
+        DoNotOptimize(&tree);
+    });
+    const KdTree tree(points);
+    runner.Run("KdTree::NearestMany", queryCount, 20, [&] {
+        tree.NearestMany(queries, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("KdTree::KNearestMany(k=8)", queryCount, 76, [&] {
+        tree.KNearestMany(queries, k, out);
+        DoNotOptimize(out.data());
+    });
+    runner.Run("KdTree::KNearestMany(k=8, eps=0.5)", queryCount, 76, [&] {
+        tree.KNearestMany(queries, k, out, 0.5f);
+        DoNotOptimize(out.data());
+    });
+    if (n <= 65536) {
+        runner.Run("Nearest by brute force", queryCount, 20, [&] {
+            for (std::size_t q = 0; q < queryCount; ++q) {
+                KdNeighbor best;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const Vec3 offset = points[i] - queries[q];
+                    const float distanceSq = Vec3::Dot(offset, offset);
+                    if (distanceSq < best.distanceSq) best = KdNeighbor{static_cast<std::uint32_t>(i), distanceSq};
+                }
+                out[q] = best;
+            }
+            DoNotOptimize(out.data());
+        });
+    }
+}
+
+void RunLooseOctree(Runner& runner, const std::size_t n, Random& random)
+{
+    // Objects drift a little per frame, so most moves stay within their node.
+    std::vector<Vec3> centers, drift;
+    std::vector<float> radii;
+    for (std::size_t i = 0; i < n; ++i) {
+        centers.push_back(random.NextVec3(100.0f));
+        drift.push_back(random.NextVec3(0.05f));
+        radii.push_back(random.Float(0.1f, 2.0f));
+    }
+
+    LooseOctree tree(Aabb(Vec3(-100.0f, -100.0f, -100.0f), Vec3(100.0f, 100.0f, 100.0f)));
+    std::vector<std::uint32_t> ids;
+    for (std::size_t i = 0; i < n; ++i) ids.push_back(tree.Insert(centers[i], radii[i]));
+
+    runner.Run("LooseOctree::Move", n, 16, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            centers[i] = centers[i] + drift[i];
+            drift[i] = drift[i] * -1.0f;
+            tree.Move(ids[i], centers[i], radii[i]);
+        }
+    });
+
+    // Elements are queries, each a sphere about 1% of the world's edge.
+    const std::size_t queryCount = 1024;
+    std::vector<Vec3> queries;
+    for (std::size_t i = 0; i < queryCount; ++i) queries.push_back(random.NextVec3(100.0f));
+    std::vector<std::uint32_t> found;
+    runner.Run("LooseOctree::QuerySphere", queryCount, 16, [&] {
+        for (const Vec3& query : queries) {
+            tree.QuerySphere(query, 2.0f, found);
+            DoNotOptimize(found.data());
+        }
+    });
+}
+
+void RunSpatial2D(Runner& runner, const std::size_t n, Random& random)
+{
+    // UI-like items: mostly small rectangles over a 1000-unit square, a few large panels.
+    std::vector<Rect> items;
+    for (std::size_t i = 0; i < n; ++i) {
+        const float size = random.Float() < 0.02f ? random.Float(50.0f, 400.0f) : random.Float(4.0f, 24.0f);
+        const Vec2 position(random.Float(0.0f, 1000.0f), random.Float(0.0f, 1000.0f));
+        items.push_back(Rect::FromPositionSize(position, Vec2(size, size * random.Float(0.25f, 1.0f))));
+    }
+
+    // Elements are hit tests.
+    const std::size_t queryCount = 4096;
+    std::vector<Vec2> points;
+    for (std::size_t i = 0; i < queryCount; ++i) points.push_back(Vec2(random.Float(0.0f, 1000.0f), random.Float(0.0f, 1000.0f)));
+    std::vector<std::uint32_t> hits(queryCount);
+
+    runner.Run("Quadtree build", n, 16, [&] {
+        Quadtree tree(items);
+        DoNotOptimize(&tree);
+    });
+    runner.Run("UniformGrid2D build", n, 16, [&] {
+        UniformGrid2D grid(items, 16.0f);
+        DoNotOptimize(&grid);
+    });
+    const Quadtree tree(items);
+    const UniformGrid2D grid(items, 16.0f);
+    runner.Run("Quadtree::HitTest", queryCount, 12, [&] {
+        for (std::size_t i = 0; i < queryCount; ++i) hits[i] = tree.HitTest(points[i]);
+        DoNotOptimize(hits.data());
+    });
+    runner.Run("UniformGrid2D::HitTest", queryCount, 12, [&] {
+        for (std::size_t i = 0; i < queryCount; ++i) hits[i] = grid.HitTest(points[i]);
+        DoNotOptimize(hits.data());
+    });
+    if (n <= 65536) {
+        runner.Run("HitTest by brute force", queryCount, 12, [&] {
+            for (std::size_t i = 0; i < queryCount; ++i) {
+                std::uint32_t top = Quadtree::INVALID;
+                for (std::size_t id = 0; id < n; ++id) {
+                    if (items[id].Contains(points[i])) top = static_cast<std::uint32_t>(id);
+                }
+                hits[i] = top;
+            }
+            DoNotOptimize(hits.data());
+        });
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::string filter = Option(argc, argv, "filter", "");
+    const std::vector<std::size_t> sizes = SizeListOption(argc, argv, "sizes", "4096,1048576");
+    const double minTimeNs = static_cast<double>(SizeOption(argc, argv, "min-ms", 50)) * 1e6;
+    const std::size_t trials = SizeOption(argc, argv, "trials", 5);
+
+    Runner runner(filter, minTimeNs, trials);
+    runner.PrintHeader();
+    for (const std::size_t n : sizes) {
+        if (n == 0) continue;
+        Random random;
+        RunVec3(runner, n, random);
+        RunVec4(runner, n, random);
+        RunMat4(runner, n, random);
+        RunQuat(runner, n, random);
+        RunKdTree(runner, n, random);
+        RunLooseOctree(runner, n, random);
+        RunSpatial2D(runner, n, random);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,166 @@
+/// @file    PerfCounters.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 03:25:02
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "PerfCounters.hpp"
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+
+    #include <cerrno>
+    #include <cstring>
+#endif
+
+namespace velecs::math::bench {
+
+namespace {
+
+#if defined(__linux__)
+
+struct CounterConfig {
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr std::uint64_t CacheConfig(const std::uint64_t cache, const std::uint64_t op, const std::uint64_t result)
+{
+    return cache | (op << 8) | (result << 16);
+}
+
+constexpr CounterConfig CONFIGS[PerfSample::COUNT] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, CacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+};
+
+int OpenCounter(const CounterConfig& counter)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = counter.type;
+    attr.config = counter.config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+/// @brief Reads a counter's value, time enabled and time running, in that order.
+bool ReadCounter(const int fd, std::array<std::uint64_t, 3>& data)
+{
+    return read(fd, data.data(), sizeof(std::uint64_t) * data.size()) == static_cast<ssize_t>(sizeof(std::uint64_t) * data.size());
+}
+
+#endif
+
+} // namespace
+
+// PerfSample
+
+const char* PerfSample::Name(const Counter counter)
+{
+    switch (counter) {
+        case CYCLES: return "cycles";
+        case INSTRUCTIONS: return "instructions";
+        case L1D_MISSES: return "L1D read misses";
+        case LLC_MISSES: return "LLC misses";
+        case BRANCH_MISSES: return "branch misses";
+        default: return "?";
+    }
+}
+
+// PerfCounters
+
+PerfCounters::PerfCounters()
+{
+    _fds.fill(-1);
+
+#if defined(__linux__)
+    for (int i = 0; i < PerfSample::COUNT; ++i) {
+        _fds[i] = OpenCounter(CONFIGS[i]);
+        if (_fds[i] < 0) {
+            _diagnostic += std::string(_diagnostic.empty() ? "" : ", ") + PerfSample::Name(static_cast<PerfSample::Counter>(i))
+                + " (" + std::strerror(errno) + ")";
+        }
+    }
+    if (!_diagnostic.empty()) {
+        _diagnostic = "unavailable counters: " + _diagnostic + "; check /proc/sys/kernel/perf_event_paranoid";
+    }
+#else
+    _diagnostic = "hardware counters are only supported on Linux";
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#if defined(__linux__)
+    for (const int fd : _fds) {
+        if (fd >= 0) close(fd);
+    }
+#endif
+}
+
+bool PerfCounters::Available() const
+{
+    for (const int fd : _fds) {
+        if (fd >= 0) return true;
+    }
+    return false;
+}
+
+void PerfCounters::Start()
+{
+#if defined(__linux__)
+    // PERF_EVENT_IOC_RESET only zeroes the value, not the enabled and running times, so all
+    // three are recorded here and Stop works from the deltas.
+    for (int i = 0; i < PerfSample::COUNT; ++i) {
+        if (_fds[i] < 0) continue;
+        _started[i] = ReadCounter(_fds[i], _starts[i]);
+    }
+    for (const int fd : _fds) {
+        if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+PerfSample PerfCounters::Stop()
+{
+    PerfSample sample;
+
+#if defined(__linux__)
+    for (const int fd : _fds) {
+        if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+    for (int i = 0; i < PerfSample::COUNT; ++i) {
+        if (_fds[i] < 0 || !_started[i]) continue;
+
+        std::array<std::uint64_t, 3> data{};
+        if (!ReadCounter(_fds[i], data)) continue;
+        const std::uint64_t value = data[0] - _starts[i][0];
+        const std::uint64_t enabled = data[1] - _starts[i][1];
+        const std::uint64_t running = data[2] - _starts[i][2];
+        if (running == 0) continue;
+
+        // Scale up counters the kernel only ran part of the region because of multiplexing.
+        sample.values[i] = static_cast<double>(value) * static_cast<double>(enabled) / static_cast<double>(running);
+        sample.valid[i] = true;
+    }
+#endif
+
+    return sample;
+}
+
+} // namespace velecs::math::bench
@@ -0,0 +1,120 @@
+/// @file    PerfCounters.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 03:24:10
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Hardware performance counters for the benchmark drivers, read through perf_event_open
+/// on Linux. Each counter is opened on its own, so a machine or container that exposes only
+/// some of them (or none, e.g. with perf_event_paranoid > 2 or inside most VMs) still
+/// reports the rest; unavailable counters read as not valid.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace velecs::math::bench {
+
+/// @struct PerfSample
+/// @brief Counter deltas over one measured region.
+struct PerfSample {
+public:
+    // Enums
+
+    /// @enum Counter
+    /// @brief The counters that are sampled.
+    enum Counter : std::uint8_t {
+        CYCLES,
+        INSTRUCTIONS,
+        L1D_MISSES,
+        LLC_MISSES,
+        BRANCH_MISSES,
+        COUNT,
+    };
+
+    // Public Fields
+
+    std::array<double, COUNT> values{};  /// @brief The delta of each counter, scaled up if the kernel multiplexed it.
+    std::array<bool, COUNT> valid{};     /// @brief Whether each counter could be read.
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+    /// @brief The printable name of a counter.
+    static const char* Name(const Counter counter);
+
+    /// @brief Instructions per cycle, or a negative value if either counter is missing.
+    inline double Ipc() const
+    {
+        return valid[CYCLES] && valid[INSTRUCTIONS] && values[CYCLES] > 0.0 ? values[INSTRUCTIONS] / values[CYCLES] : -1.0;
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @class PerfCounters
+/// @brief Opens the counters for the calling thread and samples them around a region.
+class PerfCounters {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Opens every counter that the system allows.
+    PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /// @brief Closes the counters.
+    ~PerfCounters();
+
+    // Public Methods
+
+    /// @brief Whether at least one counter is open.
+    bool Available() const;
+
+    /// @brief Why counters are missing, for printing once; empty if all are open.
+    inline const std::string& Diagnostic() const { return _diagnostic; }
+
+    /// @brief Records the counters' current readings and enables them.
+    void Start();
+
+    /// @brief Disables the counters and reads them.
+    PerfSample Stop();
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::array<int, PerfSample::COUNT> _fds;
+    std::array<std::array<std::uint64_t, 3>, PerfSample::COUNT> _starts{}; /// @brief Value, time enabled and time running at Start.
+    std::array<bool, PerfSample::COUNT> _started{};                        /// @brief Whether Start could read each counter.
+    std::string _diagnostic;
+
+    // Private Methods
+};
+
+} // namespace velecs::math::bench
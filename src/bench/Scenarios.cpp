@@ -0,0 +1,284 @@
+/// @file    Scenarios.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 03:58:20
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// End-to-end benchmarks of engine-like frame workloads built from the library's types:
+///
+///     hierarchy   Update the world matrices of a transform hierarchy after animating
+///                 a fraction of its local rotations.
+///     cull        Build a view-projection from an orbiting camera and cull bounding
+///                 spheres against its frustum.
+///     animation   Sample two-key animations for every bone of every character, update the
+///                 skeletons, build skinning matrices and skin each character's vertices.
+///     particles   Integrate particles under gravity and drag with a ground bounce, then
+///                 compute their bounds.
+///
+/// Each scenario runs a number of frames after a short warm-up and reports throughput
+/// over the mean frame together with p50, p99 and worst frame times, so library changes
+/// can be judged on both average and tail cost.
+///
+/// Usage: velecs-math-scenarios [--scenario=substring] [--frames=300] [--parallel=1]
+///            [--nodes=100000] [--objects=50000] [--characters=10000] [--bones=32]
+///            [--vertices=64] [--particles=1000000]
+
+#include "Bench.hpp"
+
+#include "velecs/math/Batch.hpp"
+#include "velecs/math/Consts.hpp"
+#include "velecs/math/Frustum.hpp"
+#include "velecs/math/Skinning.hpp"
+#include "velecs/math/TransformHierarchy.hpp"
+#include "velecs/math/Vec3xN.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace velecs::math;
+using namespace velecs::math::bench;
+
+namespace {
+
+constexpr std::size_t WARMUP_FRAMES = 10;
+
+/// @struct Settings
+/// @brief The command-line configuration shared by every scenario.
+struct Settings {
+public:
+    std::size_t frames;
+    BatchExecution execution;
+    std::size_t nodes;
+    std::size_t objects;
+    std::size_t characters;
+    std::size_t bones;
+    std::size_t vertices;
+    std::size_t particles;
+};
+
+/// @brief Runs frame(index) for the warm-up and measured frames and prints one row.
+/// @param name The scenario.
+/// @param elements The unit of work per frame, for the throughput column.
+/// @param unit What an element is.
+void Measure(const char* name, const std::size_t elements, const char* unit, const std::size_t frames, const std::function<void(std::size_t)>& frame)
+{
+    for (std::size_t i = 0; i < WARMUP_FRAMES; ++i) {
+        frame(i);
+    }
+
+    std::vector<double> times;
+    times.reserve(frames);
+    for (std::size_t i = 0; i < frames; ++i) {
+        const Clock::time_point start = Clock::now();
+        frame(WARMUP_FRAMES + i);
+        times.push_back(NanosecondsSince(start) * 1e-6);
+    }
+
+    const double mean = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size());
+    const double worst = *std::max_element(times.begin(), times.end());
+    std::printf("%-10s %10zu %-11s %12.2f %9.3f %9.3f %9.3f %9.3f\n", name, elements, unit,
+        static_cast<double>(elements) / (mean * 1e-3) * 1e-6, mean, Percentile(times, 50.0), Percentile(times, 99.0), worst);
+}
+
+/// @brief A random tree in which each node's parent is one of the 64 nodes before it, giving
+///        a bushy hierarchy a few dozen levels deep.
+std::vector<std::uint32_t> RandomParents(const std::size_t count, Random& random, const std::size_t roots)
+{
+    std::vector<std::uint32_t> parents(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i < roots) {
+            parents[i] = TransformHierarchy::NO_PARENT;
+            continue;
+        }
+        const std::size_t window = std::min<std::size_t>(i, 64);
+        parents[i] = static_cast<std::uint32_t>(i - 1 - static_cast<std::size_t>(random.Float(0.0f, static_cast<float>(window) - 0.001f)));
+    }
+    return parents;
+}
+
+void Hierarchy(const Settings& settings)
+{
+    const std::size_t n = settings.nodes;
+    Random random;
+    const std::vector<std::uint32_t> parents = RandomParents(n, random, 16);
+    const TransformHierarchy hierarchy{ Span<const std::uint32_t>(parents) };
+
+    std::vector<Vec3> positions, scales(n, Vec3::ONE);
+    std::vector<Quat> rotations;
+    std::vector<Mat4> world(n, Mat4::IDENTITY);
+    for (std::size_t i = 0; i < n; ++i) {
+        positions.push_back(random.NextVec3(2.0f));
+        rotations.push_back(random.NextQuat());
+    }
+
+    // A tenth of the nodes are animated each frame, as with a few skeletons among props.
+    const std::size_t animated = std::max<std::size_t>(1, n / 10);
+    Measure("hierarchy", n, "nodes", settings.frames, [&](const std::size_t frame) {
+        const float angle = static_cast<float>(frame) * 0.01f;
+        for (std::size_t i = 0; i < animated; ++i) {
+            rotations[(i * 7919) % n] = Quat::FromEulerAnglesRad(angle, angle * 0.5f, 0.0f);
+        }
+        hierarchy.UpdateWorld(positions, rotations, scales, world);
+        DoNotOptimize(world.data());
+    });
+}
+
+void Cull(const Settings& settings)
+{
+    const std::size_t n = settings.objects;
+    Random random;
+    std::vector<Vec4> spheres;
+    for (std::size_t i = 0; i < n; ++i) {
+        const Vec3 center = random.NextVec3(500.0f);
+        spheres.push_back(Vec4(center.x, center.y, center.z, random.Float(0.5f, 5.0f)));
+    }
+    std::vector<std::uint32_t> visible(n);
+
+    const Mat4 projection = Mat4::FromPerspectiveRad(60.0f * DEG_TO_RAD, 16.0f / 9.0f, 0.1f, 1000.0f);
+    std::size_t lastVisible = 0;
+    Measure("cull", n, "objects", settings.frames, [&](const std::size_t frame) {
+        const float yaw = static_cast<float>(frame) * 0.02f;
+        const Mat4 camera = Mat4::FromPosition(Vec3(0.0f, 20.0f, 0.0f)) * Mat4::FromRotationRad(Vec3(0.0f, yaw, 0.0f));
+        const Frustum frustum = Frustum::FromMatrix(projection * camera.WithRigidInverse());
+        lastVisible = CullSpheres(frustum, spheres, visible);
+        DoNotOptimize(visible.data());
+    });
+    std::printf("%-10s %zu of %zu objects visible in the last frame\n", "", lastVisible, n);
+}
+
+void Animation(const Settings& settings)
+{
+    const std::size_t characters = settings.characters;
+    const std::size_t bones = std::max<std::size_t>(1, settings.bones);
+    const std::size_t vertices = settings.vertices;
+    const std::size_t totalBones = characters * bones;
+    Random random;
+
+    // Every character shares one skeleton shape: a chain of spines with limbs hanging off.
+    std::vector<std::uint32_t> parents(totalBones);
+    for (std::size_t c = 0; c < characters; ++c) {
+        for (std::size_t b = 0; b < bones; ++b) {
+            const std::size_t parent = b == 0 ? 0 : b < 4 ? b - 1 : (b % 4 == 0 ? 3 : b - 1);
+            parents[c * bones + b] = b == 0 ? TransformHierarchy::NO_PARENT : static_cast<std::uint32_t>(c * bones + parent);
+        }
+    }
+    const TransformHierarchy skeletons{ Span<const std::uint32_t>(parents) };
+
+    std::vector<Quat> keyA, keyB, rotations(totalBones, Quat::IDENTITY);
+    std::vector<Vec3> offsetA, offsetB, offsets(totalBones, Vec3::ZERO), scales(totalBones, Vec3::ONE);
+    std::vector<Mat4> world(totalBones, Mat4::IDENTITY), inverseBind, skinning(totalBones, Mat4::IDENTITY);
+    for (std::size_t i = 0; i < totalBones; ++i) {
+        keyA.push_back(random.NextQuat());
+        keyB.push_back(random.NextQuat());
+        offsetA.push_back(random.NextVec3(0.5f));
+        offsetB.push_back(random.NextVec3(0.5f));
+        inverseBind.push_back(random.NextAffine().WithAffineInverse());
+    }
+
+    std::vector<Vec3> bindPose, skinned(characters * vertices, Vec3::ZERO);
+    std::vector<BoneInfluence> influences;
+    for (std::size_t v = 0; v < vertices; ++v) {
+        bindPose.push_back(random.NextVec3(1.0f));
+        const std::uint32_t bone = static_cast<std::uint32_t>(v % bones);
+        const float w = random.Float(0.5f, 1.0f);
+        influences.push_back(BoneInfluence{ { bone, static_cast<std::uint32_t>((bone + 1) % bones), 0, 0 }, { w, 1.0f - w, 0.0f, 0.0f } });
+    }
+
+    Measure("animation", characters * vertices, "vertices", settings.frames, [&](const std::size_t frame) {
+        const float t = 0.5f + 0.5f * std::sin(static_cast<float>(frame) * 0.05f);
+        LerpMany(keyA, keyB, t, rotations, settings.execution);
+        LerpMany(offsetA, offsetB, t, offsets, settings.execution);
+        skeletons.UpdateWorld(offsets, rotations, scales, world);
+        for (std::size_t i = 0; i < totalBones; ++i) {
+            skinning[i] = Mat4::MultiplyAffine(world[i], inverseBind[i]);
+        }
+        for (std::size_t c = 0; c < characters; ++c) {
+            SkinPointsMany(Span<const Mat4>(skinning.data() + c * bones, bones), influences, bindPose,
+                Span<Vec3>(skinned.data() + c * vertices, vertices), settings.execution);
+        }
+        DoNotOptimize(skinned.data());
+    });
+}
+
+void Particles(const Settings& settings)
+{
+    const std::size_t n = settings.particles;
+    Random random;
+    std::vector<Vec3> positions, velocities;
+    for (std::size_t i = 0; i < n; ++i) {
+        positions.push_back(Vec3(random.Float(-50.0f, 50.0f), random.Float(0.0f, 100.0f), random.Float(-50.0f, 50.0f)));
+        velocities.push_back(random.NextVec3(5.0f));
+    }
+
+    const float dt = 1.0f / 60.0f;
+    const Vec3x4 gravity(Vec3(0.0f, -9.81f * dt, 0.0f));
+    const Float4 damping(1.0f - 0.1f * dt);
+    const Float4 step(dt);
+    const Float4 restitution(-0.6f);
+    const Float4 ground(0.0f);
+
+    Aabb bounds = Aabb::EMPTY;
+    Measure("particles", n, "particles", settings.frames, [&](const std::size_t) {
+        std::size_t i = 0;
+        for (; i + Float4::WIDTH <= n; i += Float4::WIDTH) {
+            Vec3x4 p = Vec3x4::Load(positions.data() + i);
+            Vec3x4 v = Vec3x4::Load(velocities.data() + i);
+            v = (v + gravity) * damping;
+            p += v * step;
+            const Float4 below = Float4::Less(p.y, ground);
+            p.y = Float4::Select(below, -p.y, p.y);
+            v.y = Float4::Select(below, v.y * restitution, v.y);
+            p.Store(positions.data() + i);
+            v.Store(velocities.data() + i);
+        }
+        for (; i < n; ++i) {
+            velocities[i] = (velocities[i] + Vec3(0.0f, -9.81f * dt, 0.0f)) * (1.0f - 0.1f * dt);
+            positions[i] += velocities[i] * dt;
+            if (positions[i].y < 0.0f) {
+                positions[i].y = -positions[i].y;
+                velocities[i].y *= -0.6f;
+            }
+        }
+        bounds = BoundsOf(positions, settings.execution);
+        DoNotOptimize(bounds);
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Settings settings;
+    settings.frames = std::max<std::size_t>(1, SizeOption(argc, argv, "frames", 300));
+    settings.execution = SizeOption(argc, argv, "parallel", 0) != 0 ? BatchExecution::Parallel : BatchExecution::Serial;
+    settings.nodes = SizeOption(argc, argv, "nodes", 100000);
+    settings.objects = SizeOption(argc, argv, "objects", 50000);
+    settings.characters = SizeOption(argc, argv, "characters", 10000);
+    settings.bones = SizeOption(argc, argv, "bones", 32);
+    settings.vertices = SizeOption(argc, argv, "vertices", 64);
+    settings.particles = SizeOption(argc, argv, "particles", 1000000);
+    const std::string filter = Option(argc, argv, "scenario", "");
+
+    std::printf("%-10s %10s %-11s %12s %9s %9s %9s %9s\n", "scenario", "elements", "", "M elem/s", "mean ms", "p50 ms", "p99 ms", "max ms");
+
+    const std::pair<const char*, void (*)(const Settings&)> scenarios[] = {
+        { "hierarchy", Hierarchy },
+        { "cull", Cull },
+        { "animation", Animation },
+        { "particles", Particles },
+    };
+    for (const auto& [name, run] : scenarios) {
+        if (filter.empty() || std::string(name).find(filter) != std::string::npos) {
+            run(settings);
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,189 @@
+/// @file    MatrixKernels.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 20:26:51
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Internal header. Matrix kernels written once against a lane type T, which is either
+/// float (one object) or Float4 (four objects in transposed SIMD lanes). Matrices are
+/// T[col][row], matching glm's column-major indexing.
+
+#pragma once
+
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Simd.hpp"
+
+#include <cstddef>
+
+namespace velecs::math::detail {
+
+template<typename T>
+using Lanes4x4 = T[4][4];
+
+/// @brief Loads one matrix into scalar lanes.
+inline void LoadLanes(const Mat4& mat, Lanes4x4<float>& m)
+{
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            m[col][row] = mat.internal_mat[col][row];
+        }
+    }
+}
+
+/// @brief Stores scalar lanes into one matrix.
+inline void StoreLanes(const Lanes4x4<float>& m, Mat4& mat)
+{
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            mat.internal_mat[col][row] = m[col][row];
+        }
+    }
+}
+
+/// @brief Loads four consecutive matrices into transposed lanes; lane i holds src[i].
+inline void LoadLanes(const Mat4* src, Lanes4x4<Float4>& m)
+{
+    for (int col = 0; col < 4; ++col) {
+        Float4 r0 = Float4::Load(&src[0].internal_mat[col][0]);
+        Float4 r1 = Float4::Load(&src[1].internal_mat[col][0]);
+        Float4 r2 = Float4::Load(&src[2].internal_mat[col][0]);
+        Float4 r3 = Float4::Load(&src[3].internal_mat[col][0]);
+        Float4::Transpose(r0, r1, r2, r3);
+        m[col][0] = r0;
+        m[col][1] = r1;
+        m[col][2] = r2;
+        m[col][3] = r3;
+    }
+}
+
+/// @brief Stores transposed lanes into four consecutive matrices.
+inline void StoreLanes(const Lanes4x4<Float4>& m, Mat4* dst)
+{
+    for (int col = 0; col < 4; ++col) {
+        Float4 r0 = m[col][0];
+        Float4 r1 = m[col][1];
+        Float4 r2 = m[col][2];
+        Float4 r3 = m[col][3];
+        Float4::Transpose(r0, r1, r2, r3);
+        r0.Store(&dst[0].internal_mat[col][0]);
+        r1.Store(&dst[1].internal_mat[col][0]);
+        r2.Store(&dst[2].internal_mat[col][0]);
+        r3.Store(&dst[3].internal_mat[col][0]);
+    }
+}
+
+/// @brief General 4x4 inverse via 2x2 sub-determinants (cofactor expansion).
+template<typename T>
+inline void Inverse(const Lanes4x4<T>& a, Lanes4x4<T>& b)
+{
+    const T s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+    const T s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+    const T s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+    const T s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+    const T s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+    const T s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+
+    const T c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+    const T c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+    const T c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+    const T c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+    const T c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+    const T c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+
+    const T invDet = T(1.0f) / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+    b[0][0] = ( a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3) * invDet;
+    b[0][1] = (-a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3) * invDet;
+    b[0][2] = ( a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3) * invDet;
+    b[0][3] = (-a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3) * invDet;
+
+    b[1][0] = (-a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1) * invDet;
+    b[1][1] = ( a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1) * invDet;
+    b[1][2] = (-a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1) * invDet;
+    b[1][3] = ( a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1) * invDet;
+
+    b[2][0] = ( a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0) * invDet;
+    b[2][1] = (-a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0) * invDet;
+    b[2][2] = ( a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0) * invDet;
+    b[2][3] = (-a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0) * invDet;
+
+    b[3][0] = (-a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0) * invDet;
+    b[3][1] = ( a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0) * invDet;
+    b[3][2] = (-a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0) * invDet;
+    b[3][3] = ( a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0) * invDet;
+}
+
+/// @brief Affine inverse: inverts the upper 3x3 and derives the translation from it.
+template<typename T>
+inline void AffineInverse(const Lanes4x4<T>& m, Lanes4x4<T>& b)
+{
+    // Cofactors of the upper 3x3, laid out as the columns of its adjugate
+    const T c00 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+    const T c01 = m[2][1] * m[0][2] - m[0][1] * m[2][2];
+    const T c02 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+    const T c10 = m[2][0] * m[1][2] - m[1][0] * m[2][2];
+    const T c11 = m[0][0] * m[2][2] - m[2][0] * m[0][2];
+    const T c12 = m[1][0] * m[0][2] - m[0][0] * m[1][2];
+    const T c20 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+    const T c21 = m[2][0] * m[0][1] - m[0][0] * m[2][1];
+    const T c22 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+
+    const T invDet = T(1.0f) / (m[0][0] * c00 + m[1][0] * c01 + m[2][0] * c02);
+
+    b[0][0] = c00 * invDet; b[0][1] = c01 * invDet; b[0][2] = c02 * invDet;
+    b[1][0] = c10 * invDet; b[1][1] = c11 * invDet; b[1][2] = c12 * invDet;
+    b[2][0] = c20 * invDet; b[2][1] = c21 * invDet; b[2][2] = c22 * invDet;
+
+    const T tx = m[3][0];
+    const T ty = m[3][1];
+    const T tz = m[3][2];
+    for (int row = 0; row < 3; ++row) {
+        b[3][row] = -(b[0][row] * tx + b[1][row] * ty + b[2][row] * tz);
+    }
+
+    b[0][3] = T(0.0f);
+    b[1][3] = T(0.0f);
+    b[2][3] = T(0.0f);
+    b[3][3] = T(1.0f);
+}
+
+/// @brief Rotation matrix from a unit quaternion (x, y, z, w).
+template<typename T>
+inline void QuatToMatrix(const T x, const T y, const T z, const T w, Lanes4x4<T>& b)
+{
+    const T two(2.0f);
+    const T one(1.0f);
+    const T zero(0.0f);
+
+    const T xx = x * x, yy = y * y, zz = z * z;
+    const T xy = x * y, xz = x * z, yz = y * z;
+    const T wx = w * x, wy = w * y, wz = w * z;
+
+    b[0][0] = one - two * (yy + zz); b[0][1] = two * (xy + wz);       b[0][2] = two * (xz - wy);       b[0][3] = zero;
+    b[1][0] = two * (xy - wz);       b[1][1] = one - two * (xx + zz); b[1][2] = two * (yz + wx);       b[1][3] = zero;
+    b[2][0] = two * (xz + wy);       b[2][1] = two * (yz - wx);       b[2][2] = one - two * (xx + yy); b[2][3] = zero;
+    b[3][0] = zero;                  b[3][1] = zero;                  b[3][2] = zero;                  b[3][3] = one;
+}
+
+/// @brief Runs a lane kernel over count elements: four at a time in Float4 lanes, then the
+///        remainder one at a time in float lanes.
+/// @param count The number of elements.
+/// @param wide Callable taking the index of the first of four elements.
+/// @param narrow Callable taking the index of a single element.
+template<typename Wide, typename Narrow>
+inline void ForEachLanes(const std::size_t count, Wide&& wide, Narrow&& narrow)
+{
+    std::size_t i = 0;
+    for (; i + Float4::WIDTH <= count; i += Float4::WIDTH) {
+        wide(i);
+    }
+    for (; i < count; ++i) {
+        narrow(i);
+    }
+}
+
+} // namespace velecs::math::detail
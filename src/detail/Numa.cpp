@@ -0,0 +1,134 @@
+/// @file    Numa.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 01:03:10
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "Numa.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace velecs::math::detail {
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+NumaTopology NumaTopology::Detect(const std::string& sysfsRoot)
+{
+    NumaTopology topology;
+
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    const bool haveAllowed = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    // Node ids can have gaps (e.g. after hot-unplug), so probe past the first missing one.
+    constexpr int MAX_NODES = 64;
+    for (int node = 0; node < MAX_NODES; ++node) {
+        std::ifstream file(sysfsRoot + "/node" + std::to_string(node) + "/cpulist");
+        if (!file) continue;
+
+        std::string list;
+        std::getline(file, list);
+        std::vector<int> cpus = ParseCpuList(list);
+        if (haveAllowed) {
+            cpus.erase(std::remove_if(cpus.begin(), cpus.end(), [&allowed](const int cpu) {
+                return cpu < 0 || cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &allowed);
+            }), cpus.end());
+        }
+        if (!cpus.empty()) {
+            topology.nodeCpus.push_back(std::move(cpus));
+        }
+    }
+#else
+    (void)sysfsRoot;
+#endif
+
+    return topology;
+}
+
+std::size_t NumaTopology::NodeOfCpu(const int cpu) const
+{
+    for (std::size_t node = 0; node < nodeCpus.size(); ++node) {
+        const std::vector<int>& cpus = nodeCpus[node];
+        if (std::find(cpus.begin(), cpus.end(), cpu) != cpus.end()) return node;
+    }
+    return 0;
+}
+
+int NumaTopology::CurrentCpu()
+{
+#if defined(__linux__)
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+bool NumaTopology::PinCurrentThread(const std::vector<int>& cpus)
+{
+    if (cpus.empty()) return false;
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+std::vector<int> NumaTopology::ParseCpuList(const std::string& list)
+{
+    std::vector<int> cpus;
+    std::istringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n") continue;
+
+        const std::size_t dash = range.find('-');
+        try {
+            if (dash == std::string::npos) {
+                cpus.push_back(std::stoi(range));
+            }
+            else {
+                const int first = std::stoi(range.substr(0, dash));
+                const int last = std::stoi(range.substr(dash + 1));
+                for (int cpu = first; cpu <= last; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        catch (const std::exception&) {
+            // A malformed entry only loses that entry; the node is still usable.
+        }
+    }
+    return cpus;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::math::detail
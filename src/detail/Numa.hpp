@@ -0,0 +1,69 @@
+/// @file    Numa.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 01:02:44
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Internal header. NUMA topology discovery and thread pinning for the worker pool.
+/// Implemented for Linux through sysfs and the affinity syscalls; everywhere else the
+/// machine is reported as a single node and pinning does nothing.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace velecs::math::detail {
+
+/// @struct NumaTopology
+/// @brief The CPUs of each NUMA node that the process is allowed to run on.
+struct NumaTopology {
+public:
+    // Enums
+
+    // Public Fields
+
+    std::vector<std::vector<int>> nodeCpus; /// @brief The usable CPUs of each node. Nodes without any are dropped.
+
+    // Constructors and Destructors
+
+    // Public Methods
+
+    /// @brief Reads the topology of this machine.
+    /// @param sysfsRoot The directory holding the node<N>/cpulist files.
+    /// @returns The nodes, or a single node with no CPU list when the topology is unknown.
+    static NumaTopology Detect(const std::string& sysfsRoot = "/sys/devices/system/node");
+
+    /// @brief The number of nodes; always at least 1.
+    inline std::size_t NodeCount() const { return nodeCpus.empty() ? 1 : nodeCpus.size(); }
+
+    /// @brief The node a CPU belongs to, or 0 if it is not listed.
+    std::size_t NodeOfCpu(const int cpu) const;
+
+    /// @brief The CPU the calling thread is running on, or -1 if unknown.
+    static int CurrentCpu();
+
+    /// @brief Restricts the calling thread to a set of CPUs. Does nothing if cpus is empty.
+    /// @returns Whether the affinity was applied.
+    static bool PinCurrentThread(const std::vector<int>& cpus);
+
+    /// @brief Parses a sysfs CPU list such as "0-3,8,10-11".
+    static std::vector<int> ParseCpuList(const std::string& list);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::math::detail
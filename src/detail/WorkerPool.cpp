@@ -0,0 +1,178 @@
+/// @file    WorkerPool.cpp
+/// @author  Matthew Green
+/// @date    2026-10-17 23:32:05
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "WorkerPool.hpp"
+
+namespace velecs::math::detail {
+
+// Public Fields
+
+// Constructors and Destructors
+
+WorkerPool::WorkerPool(const std::size_t workers)
+{
+    _threads.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) {
+        _threads.emplace_back([this] { WorkerLoop(0); });
+    }
+}
+
+WorkerPool::WorkerPool(const std::size_t workers, const NumaTopology& topology)
+{
+    // A single node gains nothing from pinning; leave the scheduler free to migrate threads.
+    if (topology.nodeCpus.size() > 1) {
+        _topology = topology;
+    }
+
+    std::vector<std::size_t> cpuNodes;
+    for (std::size_t node = 0; node < _topology.nodeCpus.size(); ++node) {
+        cpuNodes.insert(cpuNodes.end(), _topology.nodeCpus[node].size(), node);
+    }
+
+    _threads.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) {
+        // Spread workers over the CPUs in node order, counting the caller as the first slot.
+        const std::size_t node = cpuNodes.empty() ? 0 : cpuNodes[(i + 1) * cpuNodes.size() / (workers + 1)];
+        _threads.emplace_back([this, node] {
+            if (!_topology.nodeCpus.empty()) {
+                NumaTopology::PinCurrentThread(_topology.nodeCpus[node]);
+            }
+            WorkerLoop(node);
+        });
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wake.notify_all();
+    for (std::thread& thread : _threads) {
+        thread.join();
+    }
+}
+
+// Public Methods
+
+WorkerPool& WorkerPool::Shared()
+{
+    static WorkerPool pool([] {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? static_cast<std::size_t>(hardware - 1) : std::size_t(0);
+    }(), NumaTopology::Detect());
+    return pool;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+thread_local bool WorkerPool::t_inWorker = false;
+
+// Private Methods
+
+void WorkerPool::Run(const std::size_t count, const std::size_t grain, const Invoke invoke, void* context)
+{
+    std::lock_guard<std::mutex> runLock(_runMutex);
+
+    Job job;
+    job.invoke = invoke;
+    job.context = context;
+    job.count = count;
+    job.grain = grain;
+
+    // Node n owns the chunks whose first element lies in the n-th slice of [0, count).
+    const std::size_t chunks = (count + grain - 1) / grain;
+    const std::size_t nodes = NodeCount();
+    job.queues = std::vector<NodeQueue>(nodes);
+    for (std::size_t node = 0; node < nodes; ++node) {
+        const std::size_t first = (node * count + nodes * grain - 1) / (nodes * grain);
+        job.queues[node].next.store(first < chunks ? first : chunks, std::memory_order_relaxed);
+    }
+    for (std::size_t node = 0; node < nodes; ++node) {
+        job.queues[node].end = node + 1 < nodes ? job.queues[node + 1].next.load(std::memory_order_relaxed) : chunks;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _job = &job;
+        ++_generation;
+    }
+    _wake.notify_all();
+
+    const std::size_t home = nodes > 1 ? _topology.NodeOfCpu(NumaTopology::CurrentCpu()) : 0;
+    t_inWorker = true;
+    Work(job, home);
+    t_inWorker = false;
+
+    // Unpost the job so late wakers skip it, then wait for the workers that did pick it up.
+    // Every chunk is finished once they have all left, since each claims until none remain.
+    std::unique_lock<std::mutex> lock(_mutex);
+    _job = nullptr;
+    _idle.wait(lock, [this] { return _busy == 0; });
+    lock.unlock();
+
+    // The workers' writes to job.error happened before they left, under _mutex.
+    if (job.error) std::rethrow_exception(job.error);
+}
+
+void WorkerPool::Work(Job& job, const std::size_t homeNode)
+{
+    const std::size_t nodes = job.queues.size();
+    for (std::size_t k = 0; k < nodes; ++k) {
+        NodeQueue& queue = job.queues[(homeNode + k) % nodes];
+        for (;;) {
+            const std::size_t chunk = queue.next.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= queue.end) break;
+
+            // Keep claiming after a failure so the queues drain quickly, but run nothing more.
+            if (job.failed.load(std::memory_order_relaxed)) continue;
+
+            const std::size_t begin = chunk * job.grain;
+            const std::size_t end = begin + job.grain < job.count ? begin + job.grain : job.count;
+            try {
+                job.invoke(job.context, begin, end);
+            } catch (...) {
+                if (!job.failed.exchange(true, std::memory_order_relaxed)) {
+                    job.error = std::current_exception();
+                }
+            }
+        }
+    }
+}
+
+void WorkerPool::WorkerLoop(const std::size_t node)
+{
+    t_inWorker = true;
+    std::uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(_mutex);
+    for (;;) {
+        _wake.wait(lock, [this, seen] { return _stop || _generation != seen; });
+        if (_stop) return;
+
+        seen = _generation;
+        Job* job = _job;
+        if (job == nullptr) continue;
+
+        ++_busy;
+        lock.unlock();
+        Work(*job, node);
+        lock.lock();
+        if (--_busy == 0) {
+            _idle.notify_one();
+        }
+    }
+}
+
+} // namespace velecs::math::detail
@@ -0,0 +1,152 @@
+/// @file    WorkerPool.hpp
+/// @author  Matthew Green
+/// @date    2026-10-17 23:31:40
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Internal header. A small fork-join thread pool for splitting batch kernels across cores.
+/// The calling thread always takes part in the work, so a pool with zero workers simply
+/// runs everything inline.
+///
+/// On NUMA machines every worker is pinned to the CPUs of one node, and each loop is
+/// partitioned so that node n owns the chunks starting in the n-th of NodeCount() equal
+/// slices of [0, count). Threads drain their own node's chunks before stealing from other
+/// nodes. The partition depends only on the element range, not on the grain, so memory
+/// first touched by one loop (see NumaArray) is processed on the same node by the next.
+
+#pragma once
+
+#include "Numa.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace velecs::math::detail {
+
+/// @class WorkerPool
+/// @brief Persistent worker threads that execute one parallel loop at a time.
+class WorkerPool {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Starts unpinned worker threads that all belong to one node.
+    /// @param workers The number of threads to start in addition to the caller.
+    explicit WorkerPool(const std::size_t workers);
+
+    /// @brief Starts worker threads spread across the nodes of a topology, pinned to them.
+    /// @param workers The number of threads to start in addition to the caller.
+    /// @param topology The nodes to spread the workers over, in proportion to their CPUs.
+    WorkerPool(const std::size_t workers, const NumaTopology& topology);
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// @brief Stops and joins the worker threads.
+    ~WorkerPool();
+
+    // Public Methods
+
+    /// @brief The process-wide pool, with one worker per hardware thread beyond the first.
+    static WorkerPool& Shared();
+
+    /// @brief The number of threads that take part in a loop, including the caller.
+    inline std::size_t Concurrency() const { return _threads.size() + 1; }
+
+    /// @brief The number of NUMA nodes loops are partitioned across.
+    inline std::size_t NodeCount() const { return _topology.NodeCount(); }
+
+    /// @brief Calls fn(begin, end) over [0, count) in chunks of at most grain elements,
+    ///        spread across the workers and the calling thread. Returns once every chunk is done.
+    /// @details Runs inline when there is only one chunk, no workers, or when called from
+    ///          inside another loop of this pool.
+    /// @throws The first exception thrown by fn, on the calling thread once every worker has
+    ///         left the loop. Chunks not yet started when it was thrown are skipped.
+    template<typename Fn>
+    void ParallelFor(const std::size_t count, const std::size_t grain, Fn&& fn)
+    {
+        if (count == 0) return;
+        const std::size_t step = grain == 0 ? 1 : grain;
+        if (count <= step || _threads.empty() || t_inWorker) {
+            fn(std::size_t(0), count);
+            return;
+        }
+
+        using Body = std::remove_reference_t<Fn>;
+        Run(count, step, [](void* context, const std::size_t begin, const std::size_t end) {
+            (*static_cast<Body*>(context))(begin, end);
+        }, const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    using Invoke = void(*)(void*, std::size_t, std::size_t);
+
+    /// @struct NodeQueue
+    /// @brief The chunks of one job owned by one node.
+    struct NodeQueue {
+        alignas(64) std::atomic<std::size_t> next{0}; /// @brief The next chunk to claim.
+        std::size_t end = 0;                          /// @brief One past the node's last chunk.
+    };
+
+    /// @struct Job
+    /// @brief One ParallelFor call, shared by every participating thread.
+    struct Job {
+        Invoke invoke;
+        void* context;
+        std::size_t count;
+        std::size_t grain;
+        std::vector<NodeQueue> queues; /// @brief One per node.
+        std::atomic<bool> failed{false}; /// @brief Set by the first chunk that throws; later chunks are skipped.
+        std::exception_ptr error;        /// @brief The exception of that chunk, written only by its thread.
+    };
+
+    // Private Fields
+
+    static thread_local bool t_inWorker; /// @brief Set while the current thread runs a chunk.
+
+    std::vector<std::thread> _threads;
+    NumaTopology _topology;          /// @brief The nodes workers are pinned to; empty when unpinned.
+
+    std::mutex _runMutex;            /// @brief Serializes ParallelFor calls from different threads.
+    std::mutex _mutex;               /// @brief Guards _job, _generation, _busy and _stop.
+    std::condition_variable _wake;   /// @brief Signals workers that a job was posted or the pool is stopping.
+    std::condition_variable _idle;   /// @brief Signals the caller that a worker left the job.
+    Job* _job = nullptr;
+    std::uint64_t _generation = 0;
+    std::size_t _busy = 0;           /// @brief Workers currently holding a pointer to _job.
+    bool _stop = false;
+
+    // Private Methods
+
+    /// @brief Posts a job, helps with it, and waits until no worker still references it.
+    ///        Rethrows the job's exception, if any, after that wait.
+    void Run(const std::size_t count, const std::size_t grain, const Invoke invoke, void* context);
+
+    /// @brief Claims and runs chunks of a job until none are left, own node first. Never
+    ///        throws; an exception from a chunk is stored in the job.
+    static void Work(Job& job, const std::size_t homeNode);
+
+    /// @brief The body of each worker thread.
+    void WorkerLoop(const std::size_t node);
+};
+
+} // namespace velecs::math::detail
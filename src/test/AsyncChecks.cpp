@@ -0,0 +1,124 @@
+/// @file    AsyncChecks.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:02:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// The coroutine batch API against the synchronous batch functions. Only built as C++20.
+
+#include "Check.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+#include "bench/Bench.hpp"
+
+#include "velecs/math/Async.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace velecs::math;
+using velecs::math::bench::Random;
+
+namespace {
+
+/// @brief Resumes scheduled coroutines on one background thread.
+struct ThreadExecutor {
+    std::mutex mutex;
+    std::deque<std::coroutine_handle<>> queue;
+    std::atomic<bool> stop{false};
+    std::thread thread;
+
+    inline ThreadExecutor()
+        : thread([this] {
+            while (!stop.load()) {
+                std::coroutine_handle<> handle;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!queue.empty()) {
+                        handle = queue.front();
+                        queue.pop_front();
+                    }
+                }
+                if (handle) handle.resume();
+                else std::this_thread::yield();
+            }
+        }) {}
+
+    inline ~ThreadExecutor()
+    {
+        stop.store(true);
+        thread.join();
+    }
+
+    inline void Schedule(const std::coroutine_handle<> handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(handle);
+    }
+};
+
+template<typename T>
+inline T Wait(Task<T>& task)
+{
+    task.Start();
+    while (!task.IsDone()) std::this_thread::yield();
+    return task.Result();
+}
+
+} // namespace
+
+VELECS_CHECK_CASE(async, TransformAndCullMatchBatch)
+{
+    Random random(8);
+    std::vector<Vec3> points;
+    std::vector<Vec4> spheres;
+    for (int i = 0; i < 5000; ++i) {
+        points.push_back(random.NextVec3());
+        spheres.push_back(Vec4(random.Float(-50.0f, 50.0f), random.Float(-50.0f, 50.0f), random.Float(-50.0f, 50.0f), random.Float(0.0f, 2.0f)));
+    }
+    const Mat4 mat = random.NextAffine();
+    const Frustum frustum = Frustum::FromMatrix(Mat4::FromPerspectiveRad(1.0f, 1.0f, 0.5f, 60.0f));
+
+    ThreadExecutor executor;
+
+    std::vector<Vec3> asyncOut(points.size(), Vec3::ZERO);
+    std::vector<Vec3> syncOut(points.size(), Vec3::ZERO);
+    Task<> transform = TransformPointsAsync(mat, Span<const Vec3>(points.data(), points.size()), Span<Vec3>(asyncOut.data(), asyncOut.size()), executor, 512);
+    Wait(transform);
+    TransformPointsMany(mat, Span<const Vec3>(points.data(), points.size()), Span<Vec3>(syncOut.data(), syncOut.size()));
+    // Chunk boundaries move the scalar tails, so allow for the different rounding.
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        VELECS_CHECK_NEAR(asyncOut[i].x, syncOut[i].x, 1e-4f);
+        VELECS_CHECK_NEAR(asyncOut[i].y, syncOut[i].y, 1e-4f);
+        VELECS_CHECK_NEAR(asyncOut[i].z, syncOut[i].z, 1e-4f);
+    }
+
+    std::vector<std::uint32_t> asyncVisible(spheres.size());
+    std::vector<std::uint32_t> syncVisible(spheres.size());
+    Task<std::size_t> cull = CullAsync(frustum, Span<const Vec4>(spheres.data(), spheres.size()), Span<std::uint32_t>(asyncVisible.data(), asyncVisible.size()), executor, 700);
+    const std::size_t asyncCount = Wait(cull);
+    const std::size_t syncCount = CullSpheres(frustum, Span<const Vec4>(spheres.data(), spheres.size()), Span<std::uint32_t>(syncVisible.data(), syncVisible.size()));
+    VELECS_CHECK(asyncCount == syncCount);
+    VELECS_CHECK(std::equal(asyncVisible.begin(), asyncVisible.begin() + asyncCount, syncVisible.begin()));
+}
+
+VELECS_CHECK_CASE(async, ErrorsSurfaceWhenAwaited)
+{
+    ThreadExecutor executor;
+    std::vector<Vec3> points(10, Vec3::ONE);
+    std::vector<Vec3> out(5, Vec3::ZERO);
+    Task<> task = TransformPointsAsync(Mat4::IDENTITY, Span<const Vec3>(points.data(), points.size()), Span<Vec3>(out.data(), out.size()), executor);
+    VELECS_CHECK_THROWS(Wait(task), std::invalid_argument);
+}
+
+#endif
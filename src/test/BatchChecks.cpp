@@ -0,0 +1,121 @@
+/// @file    BatchChecks.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:41:15
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// The batch operations against their scalar counterparts, for results and for speed. The
+/// timing checks only run in optimized builds and are skipped otherwise.
+
+#include "Check.hpp"
+#include "bench/Bench.hpp"
+
+#include "velecs/math/Batch.hpp"
+#include "velecs/math/Mat4.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace velecs::math;
+using velecs::math::bench::Clock;
+using velecs::math::bench::DoNotOptimize;
+using velecs::math::bench::NanosecondsSince;
+using velecs::math::bench::Random;
+
+namespace {
+
+/// @brief The fastest of several timed runs of pass, in nanoseconds per call.
+template<typename Pass>
+double BestTime(Pass&& pass)
+{
+    constexpr int TRIALS = 15;
+    constexpr int REPS = 50;
+    pass();
+    double best = 0.0;
+    for (int trial = 0; trial < TRIALS; ++trial) {
+        const Clock::time_point start = Clock::now();
+        for (int r = 0; r < REPS; ++r) pass();
+        const double ns = NanosecondsSince(start) / REPS;
+        if (trial == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+inline void RequireOptimizedBuild()
+{
+#if !defined(NDEBUG)
+    throw test::CheckSkipped("timings are meaningless in an unoptimized build");
+#endif
+}
+
+} // namespace
+
+VELECS_CHECK_CASE(batch, TransformManyMat4MatchesOperator)
+{
+    Random random(9);
+    std::vector<Mat4> matrices;
+    for (int i = 0; i < 67; ++i) matrices.push_back(random.NextAffine());
+    const Mat4 parent = random.NextAffine();
+
+    std::vector<Mat4> out(matrices.size(), Mat4::IDENTITY);
+    TransformMany(parent, Span<const Mat4>(matrices.data(), matrices.size()), Span<Mat4>(out.data(), out.size()));
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        VELECS_CHECK(out[i].ApproxEqual(parent * matrices[i], 1e-3f));
+    }
+
+    // In place: out may alias the input.
+    TransformMany(parent, Span<const Mat4>(matrices.data(), matrices.size()), Span<Mat4>(matrices.data(), matrices.size()));
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        VELECS_CHECK(matrices[i].ApproxEqual(out[i], 1e-6f));
+    }
+}
+
+VELECS_CHECK_CASE(perf, TransformManyMat4NotSlowerThanOperator)
+{
+    RequireOptimizedBuild();
+
+    Random random(10);
+    constexpr std::size_t COUNT = 1024;
+    std::vector<Mat4> matrices;
+    for (std::size_t i = 0; i < COUNT; ++i) matrices.push_back(random.NextAffine());
+    const Mat4 parent = random.NextAffine();
+    std::vector<Mat4> out(COUNT, Mat4::IDENTITY);
+
+    const double scalar = BestTime([&] {
+        for (std::size_t i = 0; i < COUNT; ++i) out[i] = parent * matrices[i];
+        DoNotOptimize(out.data());
+    });
+    const double batch = BestTime([&] {
+        TransformMany(parent, Span<const Mat4>(matrices.data(), matrices.size()), Span<Mat4>(out.data(), out.size()));
+        DoNotOptimize(out.data());
+    });
+
+    // Allow for timer noise, but not for a slower kernel.
+    VELECS_CHECK(batch <= scalar * 1.15);
+}
+
+VELECS_CHECK_CASE(perf, WithAffineInverseNotSlowerThanWithInverse)
+{
+    RequireOptimizedBuild();
+
+    Random random(11);
+    constexpr std::size_t COUNT = 1024;
+    std::vector<Mat4> matrices;
+    for (std::size_t i = 0; i < COUNT; ++i) matrices.push_back(random.NextAffine());
+    std::vector<Mat4> out(COUNT, Mat4::IDENTITY);
+
+    const double general = BestTime([&] {
+        for (std::size_t i = 0; i < COUNT; ++i) out[i] = matrices[i].WithInverse();
+        DoNotOptimize(out.data());
+    });
+    const double affine = BestTime([&] {
+        for (std::size_t i = 0; i < COUNT; ++i) out[i] = matrices[i].WithAffineInverse();
+        DoNotOptimize(out.data());
+    });
+
+    VELECS_CHECK(affine <= general * 1.15);
+}
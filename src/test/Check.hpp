@@ -0,0 +1,98 @@
+/// @file    Check.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:02:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// A minimal check harness for velecs-math-checks. Each VELECS_CHECK_CASE registers a
+/// function under a suite name; the driver in Checks.cpp runs one suite per ctest entry.
+
+#pragma once
+
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace velecs::math::test {
+
+/// @brief Thrown by a failed check; caught by the driver, which reports the case as failed.
+struct CheckFailure : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+/// @brief Thrown to skip the rest of a case, e.g. a timing check in an unoptimized build.
+struct CheckSkipped : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+/// @struct CheckCase
+/// @brief One registered check.
+struct CheckCase {
+    const char* suite;
+    const char* name;
+    void (*run)();
+};
+
+/// @brief Every registered check, in registration order.
+inline std::vector<CheckCase>& Cases()
+{
+    static std::vector<CheckCase> cases;
+    return cases;
+}
+
+/// @brief Registers a check during static initialization.
+struct RegisterCheck {
+    inline RegisterCheck(const char* suite, const char* name, void (*run)())
+    {
+        Cases().push_back(CheckCase{ suite, name, run });
+    }
+};
+
+/// @brief Builds the message of a failed check.
+inline std::string FailureMessage(const char* file, const int line, const std::string& what)
+{
+    std::ostringstream out;
+    out << file << ":" << line << ": " << what;
+    return out.str();
+}
+
+} // namespace velecs::math::test
+
+/// @brief Defines and registers a check function.
+#define VELECS_CHECK_CASE(suite, name) \
+    static void suite##_##name(); \
+    static const ::velecs::math::test::RegisterCheck suite##_##name##_registration(#suite, #name, &suite##_##name); \
+    static void suite##_##name()
+
+/// @brief Fails the current check unless cond holds.
+#define VELECS_CHECK(cond) \
+    do { \
+        if (!(cond)) throw ::velecs::math::test::CheckFailure(::velecs::math::test::FailureMessage(__FILE__, __LINE__, "check failed: " #cond)); \
+    } while (false)
+
+/// @brief Fails the current check unless |a - b| <= tolerance.
+#define VELECS_CHECK_NEAR(a, b, tolerance) \
+    do { \
+        const double velecsCheckA = static_cast<double>(a); \
+        const double velecsCheckB = static_cast<double>(b); \
+        if (!(std::abs(velecsCheckA - velecsCheckB) <= static_cast<double>(tolerance))) { \
+            std::ostringstream velecsCheckOut; \
+            velecsCheckOut << #a " = " << velecsCheckA << ", " #b " = " << velecsCheckB << ", tolerance " << (tolerance); \
+            throw ::velecs::math::test::CheckFailure(::velecs::math::test::FailureMessage(__FILE__, __LINE__, velecsCheckOut.str())); \
+        } \
+    } while (false)
+
+/// @brief Fails the current check unless the statement throws the given exception type.
+#define VELECS_CHECK_THROWS(statement, exception) \
+    do { \
+        bool velecsCheckThrew = false; \
+        try { statement; } catch (const exception&) { velecsCheckThrew = true; } \
+        if (!velecsCheckThrew) throw ::velecs::math::test::CheckFailure(::velecs::math::test::FailureMessage(__FILE__, __LINE__, #statement " did not throw " #exception)); \
+    } while (false)
@@ -0,0 +1,58 @@
+/// @file    Checks.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:02:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Driver for the behavioral checks. Runs every case of the suite named on the command
+/// line, or of all suites when none is given.
+///
+/// Exit codes: 0 if every case passed, 1 if any failed, 77 if every case that ran was
+/// skipped (ctest reports that as a skip).
+
+#include "Check.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+
+using namespace velecs::math::test;
+
+int main(int argc, char** argv)
+{
+    const char* suite = argc > 1 ? argv[1] : nullptr;
+
+    std::size_t passed = 0;
+    std::size_t failed = 0;
+    std::size_t skipped = 0;
+    for (const CheckCase& check : Cases()) {
+        if (suite != nullptr && std::strcmp(suite, check.suite) != 0) continue;
+
+        try {
+            check.run();
+            ++passed;
+            std::printf("[pass] %s.%s\n", check.suite, check.name);
+        } catch (const CheckSkipped& skip) {
+            ++skipped;
+            std::printf("[skip] %s.%s: %s\n", check.suite, check.name, skip.what());
+        } catch (const CheckFailure& failure) {
+            ++failed;
+            std::printf("[FAIL] %s.%s: %s\n", check.suite, check.name, failure.what());
+        } catch (const std::exception& error) {
+            ++failed;
+            std::printf("[FAIL] %s.%s: unexpected exception: %s\n", check.suite, check.name, error.what());
+        }
+    }
+
+    std::printf("%zu passed, %zu failed, %zu skipped\n", passed, failed, skipped);
+    if (passed + failed + skipped == 0) {
+        std::printf("no checks in suite '%s'\n", suite != nullptr ? suite : "");
+        return 1;
+    }
+    if (failed != 0) return 1;
+    return passed == 0 ? 77 : 0;
+}
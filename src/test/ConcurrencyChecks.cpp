@@ -0,0 +1,145 @@
+/// @file    ConcurrencyChecks.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:02:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// The snapshot handoff between a writer and a reader thread, and the worker pool's error
+/// handling. Run these under ThreadSanitizer as well when touching either.
+
+#include "Check.hpp"
+#include "detail/WorkerPool.hpp"
+
+#include "velecs/math/TransformSnapshotBuffer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace velecs::math;
+
+namespace {
+
+constexpr std::size_t SNAPSHOT_SIZE = 64;
+
+/// @brief The range of transforms the writer changes at a tick; a pure function of the tick
+///        so the reader can recompute what every snapshot must hold.
+inline DirtyRange WrittenAt(const std::uint64_t tick)
+{
+    std::uint64_t h = tick * 0x9E3779B97F4A7C15ull;
+    h ^= h >> 29;
+    const std::size_t first = static_cast<std::size_t>(h % SNAPSHOT_SIZE);
+    const std::size_t count = 1 + static_cast<std::size_t>((h >> 8) % 8);
+    return DirtyRange{ first, std::min(first + count, SNAPSHOT_SIZE) };
+}
+
+/// @brief Replays the writes of ticks (from, to] onto a model of the writer's transforms.
+inline void Replay(std::vector<Vec3>& model, const std::uint64_t from, const std::uint64_t to)
+{
+    for (std::uint64_t tick = from + 1; tick <= to; ++tick) {
+        const DirtyRange range = WrittenAt(tick);
+        for (std::size_t i = range.begin; i < range.end; ++i) {
+            model[i] = Vec3(static_cast<float>(tick), static_cast<float>(i), 0.0f);
+        }
+    }
+}
+
+} // namespace
+
+VELECS_CHECK_CASE(concurrency, SnapshotBufferWriterReaderStress)
+{
+    constexpr std::uint64_t TICKS = 20000;
+    TransformSnapshotBuffer buffer(SNAPSHOT_SIZE);
+
+    std::thread writer([&buffer] {
+        for (std::uint64_t tick = 1; tick <= TICKS; ++tick) {
+            TransformSnapshot& next = buffer.BeginWrite();
+            const DirtyRange range = WrittenAt(tick);
+            for (std::size_t i = range.begin; i < range.end; ++i) {
+                next.positions[i] = Vec3(static_cast<float>(tick), static_cast<float>(i), 0.0f);
+            }
+            buffer.MarkDirty(range.begin, range.Count());
+            buffer.Publish(static_cast<double>(tick));
+            // Let the reader in between ticks so it sees many snapshots, not just the last.
+            if (tick % 4 == 0) std::this_thread::yield();
+        }
+    });
+
+    // Check on the reader thread, but only report after joining the writer.
+    std::string failure;
+    std::uint64_t acquired = 0;
+    std::uint64_t last = 0;
+    std::vector<Vec3> model(SNAPSHOT_SIZE, Vec3::ZERO);
+    while (last < TICKS && failure.empty()) {
+        if (!buffer.AcquireLatest()) {
+            std::this_thread::yield();
+            continue;
+        }
+        ++acquired;
+        const TransformSnapshot& current = buffer.Current();
+        const TransformSnapshot& previous = buffer.Previous();
+        if (current.tick <= last) failure = "ticks did not increase";
+        else if (previous.tick != last) failure = "Previous() is not the snapshot acquired before";
+        else if (current.time != static_cast<double>(current.tick)) failure = "time does not match tick";
+        else {
+            Replay(model, last, current.tick);
+            for (std::size_t i = 0; i < SNAPSHOT_SIZE; ++i) {
+                if (current.positions[i] != model[i]) failure = "snapshot at tick " + std::to_string(current.tick) + " is torn or stale";
+            }
+            // Everything that differs from the previous snapshot lies in ChangedRange().
+            const DirtyRange changed = buffer.ChangedRange();
+            for (std::size_t i = 0; i < SNAPSHOT_SIZE; ++i) {
+                if (current.positions[i] != previous.positions[i] && (i < changed.begin || i >= changed.end)) {
+                    failure = "ChangedRange() misses transform " + std::to_string(i);
+                }
+            }
+        }
+        last = current.tick;
+    }
+    writer.join();
+
+    if (!failure.empty()) throw test::CheckFailure(failure);
+    VELECS_CHECK(last == TICKS);
+    // The reader must have seen many intermediate snapshots for this to test anything.
+    VELECS_CHECK(acquired > 100);
+}
+
+VELECS_CHECK_CASE(concurrency, SnapshotBufferRejectsBadWrites)
+{
+    TransformSnapshotBuffer buffer(SNAPSHOT_SIZE);
+    VELECS_CHECK_THROWS(buffer.Publish(0.0), std::logic_error);
+    buffer.BeginWrite();
+    VELECS_CHECK_THROWS(buffer.MarkDirty(SNAPSHOT_SIZE - 1, 2), std::out_of_range);
+    VELECS_CHECK(!buffer.AcquireLatest());
+}
+
+VELECS_CHECK_CASE(concurrency, WorkerPoolRethrowsOnCaller)
+{
+    detail::WorkerPool pool(3);
+    for (std::size_t failing = 0; failing < 64; failing += 7) {
+        std::atomic<std::size_t> started{0};
+        bool caught = false;
+        try {
+            pool.ParallelFor(64 * 16, 16, [&](const std::size_t begin, const std::size_t) {
+                ++started;
+                if (begin / 16 == failing) throw std::runtime_error("chunk failed");
+            });
+        } catch (const std::runtime_error& error) {
+            caught = std::string(error.what()) == "chunk failed";
+        }
+        VELECS_CHECK(caught);
+        VELECS_CHECK(started.load() <= 64);
+    }
+
+    // The pool is still usable and runs every chunk exactly once.
+    std::atomic<std::size_t> covered{0};
+    pool.ParallelFor(10000, 64, [&](const std::size_t begin, const std::size_t end) { covered += end - begin; });
+    VELECS_CHECK(covered.load() == 10000);
+}
@@ -0,0 +1,107 @@
+/// @file    PackingChecks.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:02:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// GPU buffer layouts against the std140, std430 and scalar block layout rules.
+
+#include "Check.hpp"
+
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Packing.hpp"
+#include "velecs/math/Vec2.hpp"
+#include "velecs/math/Vec3.hpp"
+#include "velecs/math/Vec4.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace velecs::math;
+
+namespace {
+
+inline PackOptions Options(const BufferLayout layout, const MatrixPacking matrix = MatrixPacking::Full, const bool halfPrecision = false)
+{
+    PackOptions options;
+    options.layout = layout;
+    options.matrix = matrix;
+    options.halfPrecision = halfPrecision;
+    return options;
+}
+
+inline float FloatAt(const std::vector<std::uint8_t>& bytes, const std::size_t offset)
+{
+    float value;
+    std::memcpy(&value, bytes.data() + offset, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+VELECS_CHECK_CASE(packing, LayoutsFollowTheGlslRules)
+{
+    const PackedLayout vec3Std140 = LayoutOf<Vec3>(Options(BufferLayout::Std140));
+    VELECS_CHECK(vec3Std140.stride == 16 && vec3Std140.alignment == 16);
+    const PackedLayout vec3Scalar = LayoutOf<Vec3>(Options(BufferLayout::Scalar));
+    VELECS_CHECK(vec3Scalar.stride == 12 && vec3Scalar.alignment == 4);
+
+    // std140 pads every array element to 16 bytes; std430 does not.
+    VELECS_CHECK(LayoutOf<Vec2>(Options(BufferLayout::Std140)).stride == 16);
+    VELECS_CHECK(LayoutOf<Vec2>(Options(BufferLayout::Std430)).stride == 8);
+    VELECS_CHECK(LayoutOf<Vec4>(Options(BufferLayout::Scalar)).stride == 16);
+
+    const PackedLayout mat4 = LayoutOf<Mat4>(Options(BufferLayout::Std430));
+    VELECS_CHECK(mat4.stride == 64 && mat4.columnStride == 16);
+    VELECS_CHECK(LayoutOf<Mat4>(Options(BufferLayout::Std430, MatrixPacking::Affine3x4)).stride == 48);
+    const PackedLayout normal = LayoutOf<Mat4>(Options(BufferLayout::Std430, MatrixPacking::Normal3x3));
+    VELECS_CHECK(normal.stride == 48 && normal.columnStride == 16);
+    const PackedLayout normalScalar = LayoutOf<Mat4>(Options(BufferLayout::Scalar, MatrixPacking::Normal3x3));
+    VELECS_CHECK(normalScalar.stride == 36 && normalScalar.columnStride == 12);
+}
+
+VELECS_CHECK_CASE(packing, PackIntoWritesValuesAndZeroPadding)
+{
+    const std::vector<Vec3> points = { Vec3(1.0f, 2.0f, 3.0f), Vec3(4.0f, 5.0f, 6.0f), Vec3(7.0f, 8.0f, 9.0f) };
+    std::vector<std::uint8_t> bytes(64, 0xCD);
+    const std::size_t written = PackInto(bytes.data(), Span<const Vec3>(points.data(), points.size()), Options(BufferLayout::Std430));
+    VELECS_CHECK(written == 48);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        VELECS_CHECK(FloatAt(bytes, i * 16 + 0) == points[i].x);
+        VELECS_CHECK(FloatAt(bytes, i * 16 + 4) == points[i].y);
+        VELECS_CHECK(FloatAt(bytes, i * 16 + 8) == points[i].z);
+        VELECS_CHECK(FloatAt(bytes, i * 16 + 12) == 0.0f);
+    }
+    VELECS_CHECK(bytes[48] == 0xCD);
+
+    const Mat4 translation = Mat4::FromPosition(Vec3(10.0f, 20.0f, 30.0f));
+    PackInto(bytes.data(), Span<const Mat4>(&translation, 1), Options(BufferLayout::Std430, MatrixPacking::Affine3x4));
+    // Rows of the 3x4 matrix: the translation is the last element of each.
+    VELECS_CHECK(FloatAt(bytes, 0) == 1.0f && FloatAt(bytes, 12) == 10.0f);
+    VELECS_CHECK(FloatAt(bytes, 20) == 1.0f && FloatAt(bytes, 28) == 20.0f);
+    VELECS_CHECK(FloatAt(bytes, 40) == 1.0f && FloatAt(bytes, 44) == 30.0f);
+}
+
+VELECS_CHECK_CASE(packing, HalfPrecisionConversions)
+{
+    VELECS_CHECK(FloatToHalf(1.0f) == 0x3C00);
+    VELECS_CHECK(FloatToHalf(-2.0f) == 0xC000);
+    VELECS_CHECK(FloatToHalf(65504.0f) == 0x7BFF);
+    VELECS_CHECK(FloatToHalf(1e6f) == 0x7C00);
+    // 1 + 2^-11 lies halfway between two halves and rounds to the even one.
+    VELECS_CHECK(FloatToHalf(1.0f + 1.0f / 2048.0f) == 0x3C00);
+    for (std::uint32_t bits = 0; bits < 0x7C00; bits += 7) {
+        const std::uint16_t half = static_cast<std::uint16_t>(bits);
+        VELECS_CHECK(FloatToHalf(HalfToFloat(half)) == half);
+    }
+
+    const Vec4 value(1.0f, -2.0f, 0.5f, 0.0f);
+    std::uint16_t halves[4] = {};
+    VELECS_CHECK(PackInto(halves, Span<const Vec4>(&value, 1), Options(BufferLayout::Scalar, MatrixPacking::Full, true)) == 8);
+    VELECS_CHECK(halves[0] == 0x3C00 && halves[1] == 0xC000 && halves[2] == 0x3800 && halves[3] == 0);
+}
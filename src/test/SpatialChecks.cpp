@@ -0,0 +1,271 @@
+/// @file    SpatialChecks.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:02:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// The spatial indexes against brute-force searches over the same data.
+
+#include "Check.hpp"
+#include "bench/Bench.hpp"
+
+#include "velecs/math/Aabb.hpp"
+#include "velecs/math/Frustum.hpp"
+#include "velecs/math/KdTree.hpp"
+#include "velecs/math/LooseOctree.hpp"
+#include "velecs/math/Quadtree.hpp"
+#include "velecs/math/Rect.hpp"
+#include "velecs/math/UniformGrid2D.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace velecs::math;
+using velecs::math::bench::Random;
+
+namespace {
+
+inline float DistanceSq(const Vec3 a, const Vec3 b)
+{
+    const float dx = a.x - b.x;
+    const float dy = a.y - b.y;
+    const float dz = a.z - b.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+inline std::vector<std::uint32_t> Sorted(std::vector<std::uint32_t> ids)
+{
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+/// @brief Random rectangles of mixed sizes, with a few empty ones.
+std::vector<Rect> RandomRects(Random& random, const std::size_t count)
+{
+    std::vector<Rect> rects;
+    rects.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vec2 position(random.Float(-500.0f, 500.0f), random.Float(-500.0f, 500.0f));
+        const float scale = i % 10 == 0 ? 200.0f : 20.0f;
+        const Vec2 size(random.Float(0.0f, scale), random.Float(0.0f, scale));
+        rects.push_back(i % 97 == 0 ? Rect::EMPTY : Rect::FromPositionSize(position, size));
+    }
+    return rects;
+}
+
+std::vector<std::uint32_t> BruteRect(const std::vector<Rect>& rects, const Rect& query)
+{
+    std::vector<std::uint32_t> ids;
+    for (std::uint32_t i = 0; i < rects.size(); ++i) {
+        if (!rects[i].IsEmpty() && rects[i].Intersects(query)) ids.push_back(i);
+    }
+    return ids;
+}
+
+std::vector<std::uint32_t> BrutePoint(const std::vector<Rect>& rects, const Vec2 point)
+{
+    std::vector<std::uint32_t> ids;
+    for (std::uint32_t i = 0; i < rects.size(); ++i) {
+        if (rects[i].Contains(point)) ids.push_back(i);
+    }
+    return ids;
+}
+
+std::vector<std::uint32_t> BruteCircle(const std::vector<Rect>& rects, const Vec2 center, const float radius)
+{
+    std::vector<std::uint32_t> ids;
+    for (std::uint32_t i = 0; i < rects.size(); ++i) {
+        if (!rects[i].IsEmpty() && rects[i].IntersectsCircle(center, radius)) ids.push_back(i);
+    }
+    return ids;
+}
+
+/// @brief Runs the same queries against a 2D index and brute force.
+template<typename Index>
+void Check2D(const Index& index, const std::vector<Rect>& rects, Random& random)
+{
+    std::vector<std::uint32_t> found;
+    for (int q = 0; q < 300; ++q) {
+        const Vec2 point(random.Float(-550.0f, 550.0f), random.Float(-550.0f, 550.0f));
+        const Rect rect = Rect::FromPositionSize(point, Vec2(random.Float(0.0f, 150.0f), random.Float(0.0f, 150.0f)));
+        const float radius = random.Float(0.0f, 100.0f);
+
+        index.QueryPoint(point, found);
+        const std::vector<std::uint32_t> atPoint = BrutePoint(rects, point);
+        VELECS_CHECK(Sorted(found) == atPoint);
+        VELECS_CHECK(index.HitTest(point) == (atPoint.empty() ? Index::INVALID : atPoint.back()));
+
+        index.QueryRect(rect, found);
+        VELECS_CHECK(Sorted(found) == BruteRect(rects, rect));
+
+        index.QueryRadius(point, radius, found);
+        VELECS_CHECK(Sorted(found) == BruteCircle(rects, point, radius));
+    }
+}
+
+} // namespace
+
+VELECS_CHECK_CASE(spatial, KdTreeMatchesBruteForce)
+{
+    Random random(1);
+    std::vector<Vec3> points;
+    for (int i = 0; i < 2000; ++i) points.push_back(random.NextVec3(100.0f));
+    // Duplicates must not confuse the median split.
+    for (int i = 0; i < 50; ++i) points.push_back(points[static_cast<std::size_t>(i)]);
+
+    const KdTree tree{ Span<const Vec3>(points.data(), points.size()) };
+    VELECS_CHECK(tree.Size() == points.size());
+
+    constexpr std::size_t K = 8;
+    KdNeighbor neighbors[K];
+    std::vector<KdNeighbor> inRadius;
+    for (int q = 0; q < 300; ++q) {
+        const Vec3 query = random.NextVec3(120.0f);
+
+        std::vector<float> distances;
+        for (const Vec3& point : points) distances.push_back(DistanceSq(point, query));
+        std::vector<float> sorted = distances;
+        std::sort(sorted.begin(), sorted.end());
+
+        const KdNeighbor nearest = tree.Nearest(query);
+        VELECS_CHECK(nearest.index < points.size());
+        VELECS_CHECK_NEAR(nearest.distanceSq, sorted[0], 1e-5f * (1.0f + sorted[0]));
+        VELECS_CHECK_NEAR(distances[nearest.index], sorted[0], 1e-5f * (1.0f + sorted[0]));
+
+        VELECS_CHECK(tree.KNearest(query, Span<KdNeighbor>(neighbors, K)) == K);
+        for (std::size_t k = 0; k < K; ++k) {
+            VELECS_CHECK_NEAR(neighbors[k].distanceSq, sorted[k], 1e-5f * (1.0f + sorted[k]));
+        }
+
+        const float radius = random.Float(0.0f, 30.0f);
+        tree.Radius(query, radius, inRadius);
+        std::vector<std::uint32_t> found;
+        for (const KdNeighbor& n : inRadius) found.push_back(n.index);
+        found = Sorted(found);
+        // Points within rounding of the boundary may go either way.
+        const float radiusSq = radius * radius;
+        const float slack = 1e-5f * (1.0f + radiusSq);
+        for (std::uint32_t i = 0; i < points.size(); ++i) {
+            const bool expected = distances[i] <= radiusSq;
+            const bool reported = std::binary_search(found.begin(), found.end(), i);
+            VELECS_CHECK(expected == reported || std::abs(distances[i] - radiusSq) <= slack);
+        }
+    }
+}
+
+VELECS_CHECK_CASE(spatial, LooseOctreeMatchesBruteForce)
+{
+    Random random(2);
+    LooseOctree tree(Aabb(Vec3(-100.0f, -100.0f, -100.0f), Vec3(100.0f, 100.0f, 100.0f)), 6);
+
+    struct Sphere {
+        Vec3 center;
+        float radius;
+        bool live;
+    };
+    std::vector<Sphere> spheres;
+    for (int i = 0; i < 1500; ++i) {
+        // Some objects lie outside the world bounds or are larger than any cell.
+        const float range = i % 20 == 0 ? 150.0f : 100.0f;
+        const float radius = i % 50 == 0 ? random.Float(50.0f, 150.0f) : random.Float(0.0f, 4.0f);
+        const Vec3 center = random.NextVec3(range);
+        const std::uint32_t id = tree.Insert(center, radius);
+        VELECS_CHECK(id == spheres.size());
+        spheres.push_back(Sphere{ center, radius, true });
+    }
+
+    std::vector<std::uint32_t> found;
+    std::vector<std::uint32_t> expected;
+    const Mat4 view = Mat4::FromPosition(Vec3(0.0f, 0.0f, -20.0f));
+    const Frustum frustum = Frustum::FromMatrix(Mat4::FromPerspectiveRad(1.0f, 1.5f, 0.5f, 120.0f) * view);
+
+    for (int frame = 0; frame < 20; ++frame) {
+        // Move most objects a little, some far, and remove and re-add a few.
+        for (std::uint32_t id = 0; id < spheres.size(); ++id) {
+            Sphere& sphere = spheres[id];
+            if (!sphere.live) continue;
+            if (id % 37 == static_cast<std::uint32_t>(frame)) {
+                tree.Remove(id);
+                sphere.live = false;
+                continue;
+            }
+            sphere.center = id % 11 == 0 ? random.NextVec3(100.0f) : sphere.center + random.NextVec3(1.0f);
+            tree.Move(id, sphere.center, sphere.radius);
+        }
+        for (int i = 0; i < 10; ++i) {
+            const Vec3 center = random.NextVec3(100.0f);
+            const float radius = random.Float(0.0f, 4.0f);
+            const std::uint32_t id = tree.Insert(center, radius);
+            if (id == spheres.size()) spheres.push_back(Sphere{ center, radius, true });
+            else {
+                VELECS_CHECK(id < spheres.size() && !spheres[id].live);
+                spheres[id] = Sphere{ center, radius, true };
+            }
+        }
+
+        std::size_t live = 0;
+        for (const Sphere& sphere : spheres) live += sphere.live ? 1 : 0;
+        VELECS_CHECK(tree.Size() == live);
+
+        for (int q = 0; q < 20; ++q) {
+            const Vec3 center = random.NextVec3(110.0f);
+            const float radius = random.Float(0.0f, 25.0f);
+            tree.QuerySphere(center, radius, found);
+            expected.clear();
+            for (std::uint32_t id = 0; id < spheres.size(); ++id) {
+                const Sphere& s = spheres[id];
+                const float reach = s.radius + radius;
+                if (s.live && DistanceSq(s.center, center) <= reach * reach) expected.push_back(id);
+            }
+            VELECS_CHECK(Sorted(found) == expected);
+
+            const Aabb box = Aabb::FromCenterExtents(center, Vec3(radius, radius * 0.5f, radius * 2.0f));
+            tree.QueryAabb(box, found);
+            expected.clear();
+            for (std::uint32_t id = 0; id < spheres.size(); ++id) {
+                const Sphere& s = spheres[id];
+                const float dx = std::max({ box.min.x - s.center.x, 0.0f, s.center.x - box.max.x });
+                const float dy = std::max({ box.min.y - s.center.y, 0.0f, s.center.y - box.max.y });
+                const float dz = std::max({ box.min.z - s.center.z, 0.0f, s.center.z - box.max.z });
+                if (s.live && dx * dx + dy * dy + dz * dz <= s.radius * s.radius) expected.push_back(id);
+            }
+            VELECS_CHECK(Sorted(found) == expected);
+        }
+
+        tree.QueryFrustum(frustum, found);
+        expected.clear();
+        for (std::uint32_t id = 0; id < spheres.size(); ++id) {
+            if (spheres[id].live && frustum.IntersectsSphere(spheres[id].center, spheres[id].radius)) expected.push_back(id);
+        }
+        VELECS_CHECK(Sorted(found) == expected);
+    }
+
+    tree.Clear();
+    VELECS_CHECK(tree.Size() == 0);
+    tree.QuerySphere(Vec3(0.0f, 0.0f, 0.0f), 1000.0f, found);
+    VELECS_CHECK(found.empty());
+}
+
+VELECS_CHECK_CASE(spatial, QuadtreeMatchesBruteForce)
+{
+    Random random(3);
+    const std::vector<Rect> rects = RandomRects(random, 3000);
+    const Quadtree tree(Span<const Rect>(rects.data(), rects.size()));
+    VELECS_CHECK(tree.Size() == rects.size());
+    Check2D(tree, rects, random);
+}
+
+VELECS_CHECK_CASE(spatial, UniformGrid2DMatchesBruteForce)
+{
+    Random random(4);
+    const std::vector<Rect> rects = RandomRects(random, 3000);
+    const UniformGrid2D grid(Span<const Rect>(rects.data(), rects.size()), 40.0f);
+    VELECS_CHECK(grid.Size() == rects.size());
+    Check2D(grid, rects, random);
+    VELECS_CHECK_THROWS(UniformGrid2D(Span<const Rect>(rects.data(), rects.size()), 0.0f), std::invalid_argument);
+}
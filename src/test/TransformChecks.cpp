@@ -0,0 +1,178 @@
+/// @file    TransformChecks.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:02:37
+///
+/// @section LICENSE
+///
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+///
+/// Matrix decomposition and the hierarchy update against naive composition.
+
+#include "Check.hpp"
+#include "bench/Bench.hpp"
+
+#include "velecs/math/Mat4.hpp"
+#include "velecs/math/Quat.hpp"
+#include "velecs/math/TransformHierarchy.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace velecs::math;
+using velecs::math::bench::Random;
+
+namespace {
+
+inline Mat4 Compose(const Vec3 translation, const Quat& rotation, const Vec3 scale)
+{
+    return Mat4::FromPosition(translation) * rotation.ToMatrix() * Mat4::FromScale(scale);
+}
+
+} // namespace
+
+VELECS_CHECK_CASE(transform, DecomposeRoundTrips)
+{
+    Random random(5);
+    for (int i = 0; i < 500; ++i) {
+        const Vec3 translation = random.NextVec3(50.0f);
+        const Quat rotation = random.NextQuat();
+        // Every fifth matrix is mirrored; Decompose reports that as a negative x scale.
+        Vec3 scale(random.Float(0.25f, 4.0f), random.Float(0.25f, 4.0f), random.Float(0.25f, 4.0f));
+        if (i % 5 == 0) scale = Vec3(-scale.x, scale.y, scale.z);
+        const Mat4 mat = Compose(translation, rotation, scale);
+
+        Vec3 t(0.0f, 0.0f, 0.0f);
+        Quat r = Quat::IDENTITY;
+        Vec3 s(0.0f, 0.0f, 0.0f);
+        VELECS_CHECK(mat.Decompose(t, r, s));
+        VELECS_CHECK(Compose(t, r, s).ApproxEqual(mat, 1e-4f * 50.0f));
+        VELECS_CHECK_NEAR(s.x, scale.x, 1e-4f);
+        VELECS_CHECK_NEAR(s.y, scale.y, 1e-4f);
+        VELECS_CHECK_NEAR(s.z, scale.z, 1e-4f);
+
+        if (scale.x > 0.0f) {
+            mat.DecomposeAffine(t, r, s);
+            VELECS_CHECK(Compose(t, r, s).ApproxEqual(mat, 1e-4f * 50.0f));
+        }
+    }
+}
+
+VELECS_CHECK_CASE(transform, DecomposeRejectsProjective)
+{
+    const Mat4 projection = Mat4::FromPerspectiveRad(1.0f, 1.0f, 0.1f, 100.0f);
+    Vec3 t(1.0f, 1.0f, 1.0f);
+    Quat r(0.5f, 0.5f, 0.5f, 0.5f);
+    Vec3 s(2.0f, 2.0f, 2.0f);
+    VELECS_CHECK(!projection.Decompose(t, r, s));
+    VELECS_CHECK(t == Vec3::ZERO);
+    VELECS_CHECK(s == Vec3::ONE);
+}
+
+VELECS_CHECK_CASE(transform, WithAffineInverseInvertsShearedMatrices)
+{
+    Random random(12);
+    for (int i = 0; i < 500; ++i) {
+        // A rotation after a non-uniform scale leaves the upper 3x3 sheared on every other matrix.
+        const Mat4 mat = (i % 2 == 0) ? random.NextAffine() : random.NextAffine() * random.NextQuat().ToMatrix();
+        const Mat4 inverse = mat.WithAffineInverse();
+        VELECS_CHECK((mat * inverse).ApproxEqual(Mat4::IDENTITY, 1e-4f));
+        VELECS_CHECK((inverse * mat).ApproxEqual(Mat4::IDENTITY, 1e-4f));
+        VELECS_CHECK(inverse.ApproxEqual(mat.WithInverse(), 1e-4f));
+    }
+}
+
+VELECS_CHECK_CASE(transform, DecomposeManyMatchesDecompose)
+{
+    Random random(6);
+    std::vector<Mat4> matrices;
+    for (int i = 0; i < 37; ++i) matrices.push_back(random.NextAffine());
+    std::vector<Vec3> translations(matrices.size(), Vec3::ZERO);
+    std::vector<Quat> rotations(matrices.size(), Quat::IDENTITY);
+    std::vector<Vec3> scales(matrices.size(), Vec3::ZERO);
+
+    const std::size_t failures = Mat4::DecomposeMany(
+        Span<const Mat4>(matrices.data(), matrices.size()),
+        Span<Vec3>(translations.data(), translations.size()),
+        Span<Quat>(rotations.data(), rotations.size()),
+        Span<Vec3>(scales.data(), scales.size()));
+    VELECS_CHECK(failures == 0);
+    for (std::size_t i = 0; i < matrices.size(); ++i) {
+        VELECS_CHECK(Compose(translations[i], rotations[i], scales[i]).ApproxEqual(matrices[i], 1e-3f));
+    }
+}
+
+VELECS_CHECK_CASE(transform, HierarchyMatchesNaiveComposition)
+{
+    Random random(7);
+    constexpr std::uint32_t COUNT = 1000;
+
+    // Build a random forest with parents before children, then shuffle the node order so
+    // parents also appear after their children.
+    std::vector<std::uint32_t> built(COUNT);
+    for (std::uint32_t i = 0; i < COUNT; ++i) {
+        built[i] = i % 50 == 0 ? TransformHierarchy::NO_PARENT : static_cast<std::uint32_t>(random.Float(0.0f, static_cast<float>(i)));
+    }
+    std::vector<std::uint32_t> order(COUNT);
+    std::iota(order.begin(), order.end(), 0u);
+    for (std::uint32_t i = COUNT - 1; i > 0; --i) {
+        std::swap(order[i], order[static_cast<std::uint32_t>(random.Float(0.0f, static_cast<float>(i + 1))) % (i + 1)]);
+    }
+    std::vector<std::uint32_t> slotOf(COUNT);
+    for (std::uint32_t slot = 0; slot < COUNT; ++slot) slotOf[order[slot]] = slot;
+    std::vector<std::uint32_t> parents(COUNT);
+    for (std::uint32_t node = 0; node < COUNT; ++node) {
+        parents[slotOf[node]] = built[node] == TransformHierarchy::NO_PARENT ? TransformHierarchy::NO_PARENT : slotOf[built[node]];
+    }
+
+    std::vector<Vec3> positions;
+    std::vector<Quat> rotations;
+    std::vector<Vec3> scales;
+    for (std::uint32_t i = 0; i < COUNT; ++i) {
+        positions.push_back(random.NextVec3(2.0f));
+        rotations.push_back(random.NextQuat());
+        scales.push_back(Vec3(random.Float(0.8f, 1.25f), random.Float(0.8f, 1.25f), random.Float(0.8f, 1.25f)));
+    }
+
+    const TransformHierarchy hierarchy{ Span<const std::uint32_t>(parents.data(), parents.size()) };
+    VELECS_CHECK(hierarchy.Size() == COUNT);
+    std::vector<Mat4> world(COUNT, Mat4::IDENTITY);
+    hierarchy.UpdateWorld(
+        Span<const Vec3>(positions.data(), positions.size()),
+        Span<const Quat>(rotations.data(), rotations.size()),
+        Span<const Vec3>(scales.data(), scales.size()),
+        Span<Mat4>(world.data(), world.size()));
+
+    // Naive: compose in the original parents-first order.
+    std::vector<Mat4> expected(COUNT, Mat4::IDENTITY);
+    for (std::uint32_t node = 0; node < COUNT; ++node) {
+        const std::uint32_t slot = slotOf[node];
+        const Mat4 local = Compose(positions[slot], rotations[slot], scales[slot]);
+        expected[slot] = built[node] == TransformHierarchy::NO_PARENT ? local : expected[slotOf[built[node]]] * local;
+    }
+    for (std::uint32_t slot = 0; slot < COUNT; ++slot) {
+        VELECS_CHECK(world[slot].ApproxEqual(expected[slot], 1e-3f));
+    }
+
+    // Every node sits one level below its parent.
+    std::vector<std::size_t> depth(COUNT, 0);
+    for (std::size_t level = 0; level < hierarchy.LevelCount(); ++level) {
+        for (const std::uint32_t node : hierarchy.Level(level)) depth[node] = level;
+    }
+    for (std::uint32_t slot = 0; slot < COUNT; ++slot) {
+        if (parents[slot] == TransformHierarchy::NO_PARENT) VELECS_CHECK(depth[slot] == 0);
+        else VELECS_CHECK(depth[slot] == depth[parents[slot]] + 1);
+    }
+}
+
+VELECS_CHECK_CASE(transform, HierarchyRejectsCyclesAndBadParents)
+{
+    const std::uint32_t cycle[] = { 1, 2, 0 };
+    VELECS_CHECK_THROWS(TransformHierarchy(Span<const std::uint32_t>(cycle, 3)), std::invalid_argument);
+    const std::uint32_t outOfRange[] = { TransformHierarchy::NO_PARENT, 5 };
+    VELECS_CHECK_THROWS(TransformHierarchy(Span<const std::uint32_t>(outOfRange, 2)), std::invalid_argument);
+}
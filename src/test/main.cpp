@@ -6,9 +6,7 @@
 #include "velecs/math/Vec4.hpp"
 #include "velecs/math/Quat.hpp"
 #include "velecs/math/Mat4.hpp"
-
-#include <glm/common.hpp>
-#include <glm/mat4x4.hpp>
+#include "velecs/math/Io.hpp"
 
 using namespace velecs::math;
 
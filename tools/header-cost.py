@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# @file    header-cost.py
+# @author  Matthew Green
+# @date    2026-10-18 05:02:44
+#
+# @section LICENSE
+#
+# Copyright (c) 2025 Matthew Green - All rights reserved
+# Unauthorized copying of this file, via any medium is strictly prohibited
+# Proprietary and confidential
+#
+# Measures what including each public header costs a translation unit.
+#
+# For every header in include/velecs/math (or the ones given with --headers), a TU that
+# includes only that header is checked for syntax only (-fsyntax-only, or /Zs with MSVC)
+# several times. The script reports the median compile time, the same time over an empty TU,
+# the preprocessed line count, and whether <iostream> was pulled in (which also adds an
+# ios_base::Init static initializer to the TU). The time over the empty TU is clamped at zero,
+# since headers cheaper than the timer's noise otherwise show up with a negative cost.
+#
+# The compiler, standard, include directories, definitions and options are read from a
+# configured build directory (velecs-math-usage.json, written by CMake from the velecs-math
+# target), so each header is compiled exactly as a consumer of that configuration would.
+#
+# Usage: tools/header-cost.py [--build=build] [--cxx=...] [--std=...] [--runs=5]
+#                             [--headers=Vec3.hpp,Mat4.hpp] [-- extra compiler flags]
+#
+# --cxx and --std override the configured compiler and standard. The compiler may be GCC or
+# Clang (g++, clang++, c++) or an MSVC-style driver (cl, clang-cl), which is recognized by its
+# name and given /std:, /I, /D, /E and /Zs instead. Extra flags are passed through unchanged,
+# so they must be in the chosen compiler's syntax. The exit code is 1 if any header fails to
+# compile on its own, other than through one of the library's #error configuration guards.
+
+import json
+import os
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE = os.path.join(ROOT, "include")
+HEADERS = os.path.join(INCLUDE, "velecs", "math")
+
+
+def option(name, fallback):
+    prefix = "--" + name + "="
+    for arg in sys.argv[1:]:
+        if arg == "--":
+            break
+        if arg.startswith(prefix):
+            return arg[len(prefix):]
+    return fallback
+
+
+def extra_flags():
+    return sys.argv[sys.argv.index("--") + 1:] if "--" in sys.argv else []
+
+
+def is_msvc(cxx):
+    name = os.path.splitext(os.path.basename(cxx))[0].lower()
+    return name in ("cl", "clang-cl")
+
+
+def load_usage(build):
+    path = os.path.join(build, "velecs-math-usage.json")
+    if not os.path.isfile(path):
+        sys.exit("%s not found; configure the library with CMake first (--build=<dir>)" % path)
+    with open(path) as f:
+        usage = json.load(f)
+    # An empty property comes through as a single empty string.
+    for key in ("include_directories", "compile_definitions", "compile_options"):
+        usage[key] = [value for value in usage[key] if value]
+    return usage
+
+
+def usage_flags(cxx, usage):
+    msvc = is_msvc(cxx)
+    flags = [("/I" if msvc else "-I") + d for d in usage["include_directories"]]
+    flags += [("/D" if msvc else "-D") + d for d in usage["compile_definitions"]]
+    return flags + usage["compile_options"]
+
+
+def command(cxx, std, source, flags):
+    if is_msvc(cxx):
+        return [cxx, "/nologo", "/EHsc", "/std:" + std] + flags + [source]
+    return [cxx, "-std=" + std] + flags + [source]
+
+
+def includes_iostream(preprocessed):
+    # GCC and Clang mark included files with '# 1 "path"', MSVC with '#line 1 "path"'.
+    for line in preprocessed.splitlines():
+        line = line.rstrip().replace("\\\\", "/").replace("\\", "/")
+        if line.startswith("#") and line.endswith('/iostream"'):
+            return True
+    return "ios_base::Init __ioinit" in preprocessed
+
+
+def measure(cxx, std, runs, flags, header):
+    with tempfile.TemporaryDirectory() as tmp:
+        source = os.path.join(tmp, "tu.cpp")
+        with open(source, "w") as f:
+            if header:
+                f.write('#include "velecs/math/%s"\n' % header)
+
+        msvc = is_msvc(cxx)
+        base = command(cxx, std, source, flags)
+        pre = subprocess.run(base + ["/E" if msvc else "-E"], capture_output=True, text=True)
+        if pre.returncode != 0:
+            # cl reports errors on stdout, GCC and Clang on stderr.
+            output = pre.stdout if msvc else pre.stderr
+            errors = [l for l in output.splitlines() if "error" in l] or ["does not compile on its own"]
+            raise RuntimeError(re.split(r"error(?: C\d+)?:", errors[0], maxsplit=1)[-1].strip())
+        lines = pre.stdout.count("\n")
+        iostream = includes_iostream(pre.stdout)
+
+        times = []
+        for _ in range(runs):
+            start = time.perf_counter()
+            subprocess.run(base + ["/Zs" if msvc else "-fsyntax-only"], check=True,
+                           stdout=subprocess.DEVNULL if msvc else None)
+            times.append((time.perf_counter() - start) * 1000.0)
+        return statistics.median(times), lines, iostream
+
+
+def main():
+    usage = load_usage(os.path.abspath(option("build", os.path.join(ROOT, "build"))))
+    cxx = option("cxx", usage["compiler"])
+    std = option("std", "c++" + usage["std"])
+    runs = int(option("runs", "5"))
+    flags = usage_flags(cxx, usage) + extra_flags()
+    selected = option("headers", "")
+    headers = selected.split(",") if selected else sorted(
+        h for h in os.listdir(HEADERS) if h.endswith(".hpp"))
+
+    empty_ms, empty_lines, _ = measure(cxx, std, runs, flags, None)
+    print("%-28s %10s %10s %12s %9s" % ("header", "ms/TU", "+ms", "lines", "iostream"))
+    print("%-28s %10.1f %10s %12d %9s" % ("(empty TU)", empty_ms, "-", empty_lines, "no"))
+    total = 0.0
+    failed = 0
+    for header in headers:
+        try:
+            ms, lines, iostream = measure(cxx, std, runs, flags, header)
+        except RuntimeError as error:
+            # An #error is one of the library's own guards (e.g. Async.hpp outside C++20):
+            # the header is unavailable in this configuration rather than broken.
+            print("%-28s %10s %10s %12s %9s  (%s)" % (header, "-", "-", "-", "-", error))
+            failed += 0 if str(error).startswith("#error") else 1
+            continue
+        cost = max(ms - empty_ms, 0.0)
+        total += cost
+        print("%-28s %10.1f %10.1f %12d %9s" % (header, ms, cost, lines - empty_lines, "yes" if iostream else "no"))
+    print("%-28s %10s %10.1f" % ("total", "", total))
+    print("(medians of %d runs; +ms is over the empty TU, clamped at zero; lines are over the empty TU)" % runs)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())